@@ -401,14 +401,17 @@ auto VPPiece::StickyPosition(qreal &dx, qreal &dy) const -> bool
 //---------------------------------------------------------------------------------------------------------------------
 auto VPPiece::PathsSuperposition(const QVector<QPointF> &path1, const QVector<QPointF> &path2) -> bool
 {
-    const QRectF path1Rect = VLayoutPiece::BoundingRect(path1);
-    const QPainterPath path1Path = VGObject::PainterPath(path1);
+    return PathsSuperposition(VPolygonEdges(path1), VPolygonEdges(path2));
+}
 
-    const QRectF path2Rect = VLayoutPiece::BoundingRect(path2);
-    const QPainterPath path2Path = VGObject::PainterPath(path2);
+//---------------------------------------------------------------------------------------------------------------------
+auto VPPiece::PathsSuperposition(const VPolygonEdges &path1, const VPolygonEdges &path2) -> bool
+{
+    const QRectF path1Rect = path1.BoundingRect();
+    const QRectF path2Rect = path2.BoundingRect();
 
     return (path1Rect.intersects(path2Rect) || path2Rect.contains(path1Rect) || path1Rect.contains(path2Rect)) &&
-           (path1Path.contains(path2Path) || path2Path.contains(path1Path) || path1Path.intersects(path2Path));
+           (PolygonContains(path1, path2) || PolygonContains(path2, path1) || PolygonBoundariesIntersect(path1, path2));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -34,6 +34,7 @@
 #include <QVector>
 
 #include "../layout/layoutdef.h"
+#include "../vgeometry/vpolygonintersection.h"
 #include "../vlayout/vlayoutpiece.h"
 #include "vpiecegrainline.h"
 
@@ -116,6 +117,7 @@ public:
     auto StickyPosition(qreal &dx, qreal &dy) const -> bool;
 
     static auto PathsSuperposition(const QVector<QPointF> &path1, const QVector<QPointF> &path2) -> bool;
+    static auto PathsSuperposition(const VPolygonEdges &path1, const VPolygonEdges &path2) -> bool;
     static auto PrepareStickyPath(const QVector<QPointF> &path) -> QVector<QPointF>;
     static auto ClosestDistance(const QVector<QPointF> &path1, const QVector<QPointF> &path2) -> QLineF;
     static void CleanPosition(const VPPiecePtr &piece);
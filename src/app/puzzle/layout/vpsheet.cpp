@@ -49,6 +49,7 @@ struct VSheetPiece
     QLineF seamMirrorLine{};
     QLineF seamAllowanceMirrorLine{};
     QVector<QPointF> externalContourPoints{};
+    VPolygonEdges externalContour{};
 };
 
 struct VPiecesValidationData
@@ -113,7 +114,7 @@ void ValidateSuperpositionOfPieces(const VPiecesValidationData &data,
                 continue;
             }
 
-            if (VPPiece::PathsSuperposition(piece.externalContourPoints, p.externalContourPoints))
+            if (VPPiece::PathsSuperposition(piece.externalContour, p.externalContour))
             {
                 hasSuperposition = true;
                 invalidPiece = p;
@@ -837,7 +838,8 @@ void VPSheet::CheckPiecesPositionValidity() const
                                 .showFullPiece = piece->IsShowFullPiece(),
                                 .seamMirrorLine = piece->GetMappedSeamMirrorLine(),
                                 .seamAllowanceMirrorLine = piece->GetMappedSeamAllowanceMirrorLine(),
-                                .externalContourPoints = points});
+                                .externalContourPoints = points,
+                                .externalContour = VPolygonEdges(points)});
         }
 
         const VPiecesValidationData data
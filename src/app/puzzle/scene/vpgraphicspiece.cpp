@@ -36,6 +36,7 @@
 #include <QMenu>
 #include <QPainter>
 #include <QPen>
+#include <QScopeGuard>
 #include <QStyleOptionGraphicsItem>
 #include <QtMath>
 
@@ -53,6 +54,7 @@
 #include "../vmisc/svgfont/vsvgfontdatabase.h"
 #include "../vmisc/svgfont/vsvgfontengine.h"
 #include "../vmisc/theme/vscenestylesheet.h"
+#include "../vmisc/vtextpathcache.h"
 #include "../vpapplication.h"
 #include "../vpatterndb/vpiecepath.h"
 #include "undocommands/vpundomovepieceonsheet.h"
@@ -164,7 +166,8 @@ VPGraphicsPiece::VPGraphicsPiece(const VPPiecePtr &piece, QGraphicsItem *parent)
     m_piece(piece)
 {
     // set some infos
-    setFlags(ItemIsSelectable | ItemSendsGeometryChanges);
+    // Extended option gives the exposed rect, see paint()
+    setFlags(ItemIsSelectable | ItemSendsGeometryChanges | ItemUsesExtendedStyleOption);
     setAcceptHoverEvents(true);
     setCursor(Qt::OpenHandCursor);
 
@@ -219,12 +222,16 @@ auto VPGraphicsPiece::shape() const -> QPainterPath
 void VPGraphicsPiece::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
     Q_UNUSED(widget);
-    Q_UNUSED(option);
 
     VPSettings  const*settings = VPApplication::VApp()->PuzzleSettings();
     QPen const pen(PieceColor(), settings->GetLayoutLineWidth(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin);
     painter->setPen(pen);
 
+    // Only a part of the piece may be exposed. For example, each page of a tiled PDF file shows one tile of a sheet.
+    // Elements outside of this part are not sent to the paint device.
+    m_exposedRect = option != nullptr ? option->exposedRect : QRectF();
+    auto ResetExposedRect = qScopeGuard([this]() { m_exposedRect = QRectF(); });
+
     PaintPiece(painter);
 }
 
@@ -533,7 +540,7 @@ void VPGraphicsPiece::InitPieceLabelOutlineFont(const QVector<QPointF> &labelSha
             }
             else
             {
-                path.addText(0, static_cast<qreal>(fm.ascent()), fnt, tl.qsText);
+                path.addPath(VTextPathCache::OutlineText(QPointF(0, fm.ascent()), fnt, tl.qsText));
             }
 
             auto *item = new QGraphicsPathItem(this);
@@ -686,7 +693,7 @@ void VPGraphicsPiece::PaintSeamLine(QPainter *painter, const VPPiecePtr &piece)
     {
         QPainterStateGuard const guard(painter);
         painter->setBrush(piece->IsSelected() ? SelectionBrush() : NoBrush());
-        painter->drawPath(m_seamLine);
+        DrawExposedPath(painter, m_seamLine);
     }
 }
 
@@ -721,7 +728,7 @@ void VPGraphicsPiece::PaintCuttingLine(QPainter *painter, const VPPiecePtr &piec
     {
         QPainterStateGuard const guard(painter);
         painter->setBrush(piece->IsSelected() ? SelectionBrush() : NoBrush());
-        painter->drawPath(m_cuttingLine);
+        DrawExposedPath(painter, m_cuttingLine);
     }
 }
 
@@ -750,7 +757,7 @@ void VPGraphicsPiece::PaintInternalPaths(QPainter *painter, const VPPiecePtr &pi
             QPen pen = painter->pen();
             pen.setStyle(piecePath.PenStyle());
             painter->setPen(pen);
-            painter->drawPath(path);
+            DrawExposedPath(painter, path);
         }
         m_internalPaths.addPath(path);
     }
@@ -807,7 +814,7 @@ void VPGraphicsPiece::PaintPassmarks(QPainter *painter, const VPPiecePtr &piece)
     {
         QPainterStateGuard const guard(painter);
         painter->setBrush(NoBrush());
-        painter->drawPath(m_passmarks);
+        DrawExposedPath(painter, m_passmarks);
     }
 }
 
@@ -838,7 +845,7 @@ void VPGraphicsPiece::PaintPlaceLabels(QPainter *painter, const VPPiecePtr &piec
         {
             QPainterStateGuard const guard(painter);
             painter->setBrush(NoBrush());
-            painter->drawPath(path);
+            DrawExposedPath(painter, path);
         }
 
         m_placeLabels.addPath(path);
@@ -898,7 +905,7 @@ void VPGraphicsPiece::PaintMirrorLine(QPainter *painter, const VPPiecePtr &piece
         QPen pen = painter->pen();
         pen.setStyle(Qt::DashDotLine);
         painter->setPen(pen);
-        painter->drawPath(m_mirrorLinePath);
+        DrawExposedPath(painter, m_mirrorLinePath);
     }
 }
 
@@ -1006,8 +1013,93 @@ void VPGraphicsPiece::PaintFoldLine(QPainter *painter, const VPPiecePtr &piece)
 
     if (painter != nullptr)
     {
-        DrawFoldLineMark(painter);
-        DrawFoldLineLabel(painter, piece, singleLineFont);
+        if (IsExposed(painter, m_foldLineMarkPath))
+        {
+            DrawFoldLineMark(painter);
+        }
+
+        if (IsExposed(painter, m_foldLineLabelPath))
+        {
+            DrawFoldLineLabel(painter, piece, singleLineFont);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ExposedRect exposed part of the piece extended by the pen width.
+ * @param painter painter with the pen the path will be drawn with.
+ * @return null rect if the whole piece is exposed.
+ */
+auto VPGraphicsPiece::ExposedRect(QPainter *painter) const -> QRectF
+{
+    if (m_exposedRect.isNull())
+    {
+        return {};
+    }
+
+    const qreal halfPenWidth = qMax(painter->pen().widthF(), 1.0) / 2.;
+    return m_exposedRect.adjusted(-halfPenWidth, -halfPenWidth, halfPenWidth, halfPenWidth);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsExposed check if a path may be visible in the exposed part of the piece.
+ *
+ * The test is conservative, it compares the control point rect of the path.
+ * @param painter painter with the pen the path will be drawn with.
+ * @param path path in item coordinates.
+ * @return false if the path surely is outside of the exposed rect.
+ */
+auto VPGraphicsPiece::IsExposed(QPainter *painter, const QPainterPath &path) const -> bool
+{
+    const QRectF exposedRect = ExposedRect(painter);
+    if (exposedRect.isNull())
+    {
+        return true;
+    }
+
+    if (path.isEmpty())
+    {
+        return false;
+    }
+
+    const QRectF pathRect = path.controlPointRect();
+    return pathRect.left() <= exposedRect.right() && exposedRect.left() <= pathRect.right() &&
+           pathRect.top() <= exposedRect.bottom() && exposedRect.top() <= pathRect.bottom();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DrawExposedPath draw only the part of a path that lies in the exposed part of the piece.
+ *
+ * A solid stroke is clipped to the exposed rect, so each page of a tiled export gets only the segments of its tile.
+ * Filled paths and dashed pens are drawn whole if they reach the exposed rect, clipping would change the fill and
+ * shift the dash pattern.
+ * @param painter painter with the pen and brush the path will be drawn with.
+ * @param path path in item coordinates.
+ */
+void VPGraphicsPiece::DrawExposedPath(QPainter *painter, const QPainterPath &path) const
+{
+    const QRectF exposedRect = ExposedRect(painter);
+    if (exposedRect.isNull())
+    {
+        painter->drawPath(path);
+        return;
+    }
+
+    if (painter->brush().style() != Qt::NoBrush || painter->pen().style() != Qt::SolidLine)
+    {
+        if (IsExposed(painter, path))
+        {
+            painter->drawPath(path);
+        }
+        return;
+    }
+
+    if (const QPainterPath exposedPath = VGObject::ClipPathToRect(path, exposedRect); not exposedPath.isEmpty())
+    {
+        painter->drawPath(exposedPath);
     }
 }
 
@@ -123,6 +123,8 @@ private:
 
     bool m_printMode{false};
 
+    QRectF m_exposedRect{};
+
     VGraphicsFillItem *m_grainlineItem{nullptr};
     QVector<QGraphicsPathItem *> m_labelPathItems{};
     QVector<QGraphicsSimpleTextItem *> m_labelTextItems{};
@@ -149,6 +151,10 @@ private:
     void DrawFoldLineMark(QPainter *painter) const;
     void DrawFoldLineLabel(QPainter *painter, const VPPiecePtr &piece, bool singleLineFont) const;
 
+    auto ExposedRect(QPainter *painter) const -> QRectF;
+    auto IsExposed(QPainter *painter, const QPainterPath &path) const -> bool;
+    void DrawExposedPath(QPainter *painter, const QPainterPath &path) const;
+
     void GroupMove(const QPointF &pos);
 
     auto PieceColor() const -> QColor;
@@ -34,6 +34,7 @@
 #include "../vmisc/svgfont/vsvgfontdatabase.h"
 #include "../vmisc/svgfont/vsvgfontengine.h"
 #include "../vmisc/theme/vscenestylesheet.h"
+#include "../vmisc/vtextpathcache.h"
 #include "../vptilefactory.h"
 #include "../vwidgets/global.h"
 #include "../vwidgets/vpiecegrainline.h"
@@ -545,8 +546,7 @@ auto VPGraphicsSheet::PaintHorizontalFoldTextOutlineFont(QPainter *painter, cons
     }
     else
     {
-        QPainterPath path;
-        path.addText(QPointF(), font, foldText);
+        QPainterPath path = VTextPathCache::OutlineText(QPointF(), font, foldText);
 
         QPointF const textOffset(textRect.width() / 2.0, textRect.height() / 2.0);
 
@@ -762,8 +762,7 @@ auto VPGraphicsSheet::PaintVerticalFoldTextOutlineFont(QPainter *painter, const
     }
     else
     {
-        QPainterPath path;
-        path.addText(QPointF(), font, foldText);
+        QPainterPath path = VTextPathCache::OutlineText(QPointF(), font, foldText);
 
         guard.save();
 
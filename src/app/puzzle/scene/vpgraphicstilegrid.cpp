@@ -9,6 +9,7 @@
 #include "../vmisc/svgfont/vsvgfontengine.h"
 #include "../vmisc/theme/vscenestylesheet.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vtextpathcache.h"
 #include "../vptilefactory.h"
 #include "../vwidgets/global.h"
 #include "scenedef.h"
@@ -434,8 +435,7 @@ void VPGraphicsTileGrid::PaintTileNumberOutlineFont(
     {
         const QString tileNumber = QString::number(j * nbCol + i + 1);
 
-        QPainterPath path;
-        path.addText(QPointF(), font, tileNumber);
+        QPainterPath path = VTextPathCache::OutlineText(QPointF(), font, tileNumber);
 
         QFontMetrics const fm(font);
 
@@ -3458,10 +3458,33 @@ void VPMainWindow::ZValueMove(int move)
 //---------------------------------------------------------------------------------------------------------------------
 auto VPMainWindow::ImportRawLayout(const QString &rawLayout) -> bool
 {
-    VRawLayout rawLayoutReader;
-    if (VRawLayoutData data; rawLayoutReader.ReadFile(rawLayout, data))
-    {
-        return AddLayoutPieces(data.pieces);
+    // Pieces are decoded one at a time, the file itself stays mapped. Nothing is added to the layout until every piece
+    // was read.
+    VMappedRawLayout rawLayoutReader(rawLayout);
+    if (rawLayoutReader.Open())
+    {
+        QList<VPPiecePtr> pieces;
+        bool ok = true;
+        for (vsizetype i = 0; i < rawLayoutReader.PieceCount() && ok; ++i)
+        {
+            VLayoutPiece rawPiece;
+            ok = rawLayoutReader.Piece(i, rawPiece);
+            if (ok && not CreateLayoutPieces(rawPiece, pieces))
+            {
+                return false;
+            }
+        }
+
+        if (ok)
+        {
+            for (const auto &piece : std::as_const(pieces))
+            {
+                VPLayout::AddPiece(m_layout, piece);
+            }
+
+            LayoutPiecesAdded();
+            return true;
+        }
     }
 
     qCCritical(
@@ -3477,51 +3500,52 @@ auto VPMainWindow::ImportRawLayout(const QString &rawLayout) -> bool
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VPMainWindow::AddLayoutPieces(const QVector<VLayoutPiece> &pieces) -> bool
+auto VPMainWindow::CreateLayoutPieces(const VLayoutPiece &rawPiece, QList<VPPiecePtr> &pieces) -> bool
 {
-    for (const auto &rawPiece : pieces)
+    for (quint16 i = 1; i <= rawPiece.GetQuantity(); ++i)
     {
-        for (quint16 i = 1; i <= rawPiece.GetQuantity(); ++i)
+        VPPiecePtr const piece(new VPPiece(rawPiece));
+        piece->SetCopyNumber(i);
+
+        if (QString error; not piece->IsValid(error))
         {
-            VPPiecePtr const piece(new VPPiece(rawPiece));
-            piece->SetCopyNumber(i);
+            qCCritical(pWindow) << qPrintable(tr("Piece %1 invalid. %2").arg(piece->GetName(), error));
 
-            if (QString error; not piece->IsValid(error))
+            if (m_cmd != nullptr && not m_cmd->IsGuiEnabled())
             {
-                qCCritical(pWindow) << qPrintable(tr("Piece %1 invalid. %2").arg(piece->GetName(), error));
-
-                if (m_cmd != nullptr && not m_cmd->IsGuiEnabled())
-                {
-                    QGuiApplication::exit(V_EX_DATAERR);
-                    return false;
-                }
+                QGuiApplication::exit(V_EX_DATAERR);
+                return false;
             }
+        }
 
-            piece->SetSheet(VPSheetPtr()); // just in case
+        piece->SetSheet(VPSheetPtr()); // just in case
 
-            if (rawPiece.GetQuantity() > 1 && rawPiece.IsSymmetricalCopy()
-                && (rawPiece.IsForceFlipping() || rawPiece.IsForbidFlipping()) && i % 2 == 0)
+        if (rawPiece.GetQuantity() > 1 && rawPiece.IsSymmetricalCopy()
+            && (rawPiece.IsForceFlipping() || rawPiece.IsForbidFlipping()) && i % 2 == 0)
+        {
+            // Flip every even-numbered copy
+            if (rawPiece.IsForceFlipping())
             {
-                // Flip every even-numbered copy
-                if (rawPiece.IsForceFlipping())
-                {
-                    piece->SetForbidFlipping(true);
-                }
-                else if (rawPiece.IsForbidFlipping())
-                {
-                    piece->SetForceFlipping(true);
-                }
+                piece->SetForbidFlipping(true);
+            }
+            else if (rawPiece.IsForbidFlipping())
+            {
+                piece->SetForceFlipping(true);
             }
-
-            VPLayout::AddPiece(m_layout, piece);
         }
+
+        pieces.append(piece);
     }
 
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPMainWindow::LayoutPiecesAdded()
+{
     m_carrousel->Refresh();
     m_layout->CheckPiecesPositionValidity();
     LayoutWasSaved(false);
-
-    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -529,7 +529,8 @@ private:
     void ZValueMove(int move);
 
     auto ImportRawLayout(const QString &rawLayout) -> bool;
-    auto AddLayoutPieces(const QVector<VLayoutPiece> &pieces) -> bool;
+    auto CreateLayoutPieces(const VLayoutPiece &rawPiece, QList<VPPiecePtr> &pieces) -> bool;
+    void LayoutPiecesAdded();
 
     void TranslatePieces();
     void TranslatePieceRelatively(const VPPiecePtr &piece, const QRectF &rect, vsizetype selectedPiecesCount, qreal dx,
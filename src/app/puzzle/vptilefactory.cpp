@@ -11,6 +11,7 @@
 #include "../vmisc/svgfont/vsvgfontengine.h"
 #include "../vmisc/svgfont/vsvghandler.h"
 #include "../vmisc/vcommonsettings.h"
+#include "../vmisc/vtextpathcache.h"
 #include "../vwidgets/vmaingraphicsscene.h"
 #include "layout/vplayout.h"
 #include "layout/vppiece.h"
@@ -545,8 +546,7 @@ void VPTileFactory::DrawRulerOutlineFont(QPainter *painter, qreal scale, bool te
         QFontMetrics const fm(fnt);
         qreal const unitsWidth = fm.horizontalAdvance(units);
 
-        QPainterPath path;
-        path.addText(QPointF(), fnt, units);
+        QPainterPath path = VTextPathCache::OutlineText(QPointF(), fnt, units);
 
         painter->translate(QPointF(step * 0.5 - unitsWidth * 0.6,
                                    m_drawingAreaHeight - tileStripeWidth + notchHeight + shortNotchHeight));
@@ -1024,8 +1024,7 @@ void VPTileFactory::DrawGridTextInformationOutlineFont(QPainter *painter, const
         const QFontMetrics fm(font);
         const QRectF textRect = fm.boundingRect(text);
 
-        QPainterPath path;
-        path.addText(QPointF(), font, text);
+        QPainterPath path = VTextPathCache::OutlineText(QPointF(), font, text);
 
         // Compute position to center the text
         qreal const x = UnitConvertor(1, Unit::Cm, Unit::Px);
@@ -1182,8 +1181,7 @@ void VPTileFactory::DrawPageTextInformationOutlineFont(QPainter *painter,
 
         const QRectF textRect = fm.boundingRect(page);
 
-        QPainterPath path;
-        path.addText(QPointF(), font, page);
+        QPainterPath path = VTextPathCache::OutlineText(QPointF(), font, page);
 
         painter->rotate(-90);
 
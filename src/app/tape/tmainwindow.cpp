@@ -780,6 +780,9 @@ void TMainWindow::changeEvent(QEvent *event)
     {
         WindowsLocale();
 
+        // Formulas in the table are translated, the next refresh must rebuild it
+        m_tableLayout.clear();
+
         // retranslate designer form (single inheritance approach)
         ui->retranslateUi(this);
 
@@ -2359,7 +2362,7 @@ void TMainWindow::SaveMValueAlias(const QString &text)
 
     MeasurementsWereSaved(false);
 
-    RefreshData();
+    RefreshRowTexts(row);
     m_search->RefreshList(ui->lineEditFind->text());
 
     {
@@ -2599,7 +2602,7 @@ void TMainWindow::SaveMDescription()
 
     const QTextCursor cursor = ui->plainTextEditDescription->textCursor();
 
-    RefreshData();
+    RefreshRowTexts(row);
 
     {
         const QSignalBlocker blocker(ui->tableWidget);
@@ -2644,7 +2647,7 @@ void TMainWindow::SaveMFullName()
 
         MeasurementsWereSaved(false);
 
-        RefreshData();
+        RefreshRowTexts(row);
 
         const QSignalBlocker blocker(ui->tableWidget);
         ui->tableWidget->selectRow(row);
@@ -3739,16 +3742,77 @@ void TMainWindow::RefreshData(bool freshCall)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+auto TMainWindow::SetCell(const QString &text, int row, int column, int aligment, bool ok) -> QTableWidgetItem *
+{
+    QTableWidgetItem *item = ui->tableWidget->item(row, column);
+    if (item == nullptr)
+    {
+        return AddCell(text, row, column, aligment, ok);
+    }
+
+    // The item ignores unchanged data, only changed cells are repainted
+    item->setText(text);
+    item->setToolTip(text);
+
+    if (const bool marked = item->data(Qt::ForegroundRole).isValid(); marked == ok)
+    {
+        if (ok)
+        {
+            item->setData(Qt::ForegroundRole, QVariant());
+        }
+        else
+        {
+            QBrush brush = item->foreground();
+            brush.setColor(Qt::red);
+            item->setForeground(brush);
+        }
+    }
+
+    return item;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshTable update the measurements table.
+ *
+ * If the list of rows is the same as the last time the existing items are updated in place. The table is rebuilt only
+ * when rows were added, removed or reordered, when the measurements type changed or on a fresh call.
+ * @param freshCall true if a new file was opened.
+ */
 void TMainWindow::RefreshTable(bool freshCall)
 {
     QSignalBlocker blocker(ui->tableWidget);
-    ui->tableWidget->setRowCount(0);
 
     ShowUnits();
 
     const QMap<int, QSharedPointer<VMeasurement>> orderedTable = OrderedMeasurements();
+
+    QVector<QPair<QString, VarType>> layout;
+    layout.reserve(orderedTable.size());
+    for (const auto &meash : orderedTable)
+    {
+        layout.append(qMakePair(meash->GetName(), meash->GetType()));
+    }
+
+    const bool osSeparator = VAbstractApplication::VApp()->Settings()->GetOsSeparator();
+
+    if (freshCall || layout != m_tableLayout || m_tableType != m_mType || m_tableOsSeparator != osSeparator ||
+        ui->tableWidget->rowCount() != layout.size())
+    {
+        ui->tableWidget->setRowCount(0);
+        ui->tableWidget->setRowCount(static_cast<int>(layout.size()));
+        m_tableLayout = layout;
+        m_tableType = m_mType;
+        m_tableOsSeparator = osSeparator;
+    }
+    else
+    {
+        // Items are reused, drop search highlight. Callers refresh the search list after the table.
+        m_search->Clear();
+    }
+
+    QHash<QUuid, VKnownMeasurements> knownCache;
     qint32 currentRow = -1;
-    ui->tableWidget->setRowCount(static_cast<int>(orderedTable.size()));
     for (auto iMap = orderedTable.constBegin(); iMap != orderedTable.constEnd(); ++iMap)
     {
         const QSharedPointer<VMeasurement> &meash = iMap.value();
@@ -3756,10 +3820,16 @@ void TMainWindow::RefreshTable(bool freshCall)
 
         if (meash->GetType() == VarType::Measurement)
         {
-            RefreshMeasurementData(meash, currentRow);
+            RefreshMeasurementData(meash, currentRow, knownCache);
         }
         else if (meash->GetType() == VarType::MeasurementSeparator)
         {
+            if (ui->tableWidget->item(currentRow, ColumnName) != nullptr)
+            {
+                SetCell(meash->GetDescription(), currentRow, ColumnFullName, Qt::AlignVCenter); // description
+                continue;
+            }
+
             QTableWidgetItem *item = AddSeparatorCell(meash->GetName(),
                                                       currentRow,
                                                       ColumnName,
@@ -3778,7 +3848,6 @@ void TMainWindow::RefreshTable(bool freshCall)
         }
     }
 
-    Q_UNUSED(freshCall)
     //    if (freshCall)
     //    {
     //        ui->tableWidget->resizeColumnsToContents();
@@ -3791,26 +3860,80 @@ void TMainWindow::RefreshTable(bool freshCall)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void TMainWindow::RefreshMeasurementData(const QSharedPointer<VMeasurement> &meash, qint32 currentRow)
+/**
+ * @brief RefreshRowTexts update one row after an edit of full name, description or value alias.
+ *
+ * These texts do not take part in calculation, so other measurements keep their values. Only texts of the measurement
+ * are read again and only its row is updated.
+ * @param row table row of the measurement.
+ */
+void TMainWindow::RefreshRowTexts(int row)
 {
-    VKnownMeasurementsDatabase const *db = MApplication::VApp()->KnownMeasurementsDatabase();
-    VKnownMeasurements const knownDB = db->KnownMeasurements(meash->GetKnownMeasurementsId());
-    VKnownMeasurement const known = knownDB.Measurement(meash->GetName());
+    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
+    if (m_m == nullptr || m_data == nullptr || nameField == nullptr || m_refreshInProgress)
+    {
+        RefreshData();
+        return;
+    }
 
-    if (m_mType == MeasurementsType::Individual)
+    QSharedPointer<VMeasurement> meash;
+
+    try
+    {
+        meash = m_data->GetVariable<VMeasurement>(nameField->data(Qt::UserRole).toString());
+    }
+    catch (const VExceptionBadId &)
+    {
+        RefreshData();
+        return;
+    }
+
+    m_m->ReadMeasurementTexts(meash);
+
+    const QSignalBlocker blocker(ui->tableWidget);
+
+    if (meash->GetType() == VarType::MeasurementSeparator)
+    {
+        SetCell(meash->GetDescription(), row, ColumnFullName, Qt::AlignVCenter); // description
+    }
+    else
+    {
+        QHash<QUuid, VKnownMeasurements> knownCache;
+        RefreshMeasurementData(meash, row, knownCache);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TMainWindow::RefreshMeasurementData(const QSharedPointer<VMeasurement> &meash,
+                                         qint32 currentRow,
+                                         QHash<QUuid, VKnownMeasurements> &knownCache)
+{
+    if (ui->tableWidget->item(currentRow, ColumnName) == nullptr)
     {
         QTableWidgetItem *item = AddCell(meash->GetName(), currentRow, ColumnName, Qt::AlignVCenter); // name
         item->setData(Qt::UserRole, meash->GetName());
+    }
 
-        if (meash->IsCustom())
-        {
-            AddCell(meash->GetGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
-        }
-        else
+    if (meash->IsCustom())
+    {
+        SetCell(meash->GetGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
+    }
+    else
+    {
+        // All measurements of a file usually share the same known measurements, look them up once per refresh
+        const QUuid id = meash->GetKnownMeasurementsId();
+        auto known = knownCache.constFind(id);
+        if (known == knownCache.constEnd())
         {
-            AddCell(known.fullName, currentRow, ColumnFullName, Qt::AlignVCenter);
+            VKnownMeasurementsDatabase const *db = MApplication::VApp()->KnownMeasurementsDatabase();
+            known = knownCache.insert(id, db->KnownMeasurements(id));
         }
 
+        SetCell(known->Measurement(meash->GetName()).fullName, currentRow, ColumnFullName, Qt::AlignVCenter);
+    }
+
+    if (m_mType == MeasurementsType::Individual)
+    {
         QString calculatedValue;
         if (meash->IsSpecialUnits())
         {
@@ -3826,32 +3949,27 @@ void TMainWindow::RefreshMeasurementData(const QSharedPointer<VMeasurement> &mea
             calculatedValue = QStringLiteral("%1 (%2)").arg(calculatedValue, valueAlias);
         }
 
-        AddCell(calculatedValue,
+        SetCell(calculatedValue,
                 currentRow,
                 ColumnCalcValue,
                 Qt::AlignHCenter | Qt::AlignVCenter,
                 meash->IsFormulaOk()); // calculated value
 
-        QString const formula
-            = VTranslateVars::TryFormulaToUser(meash->GetFormula(),
-                                               VAbstractApplication::VApp()->Settings()->GetOsSeparator());
-
-        AddCell(formula, currentRow, ColumnFormula, Qt::AlignVCenter); // formula
+        // Translating a formula to user view means parsing it. Skip it if the formula was not changed.
+        const QString formula = meash->GetFormula();
+        if (const QTableWidgetItem *item = ui->tableWidget->item(currentRow, ColumnFormula);
+            item == nullptr || item->data(Qt::UserRole).toString() != formula)
+        {
+            QTableWidgetItem *formulaItem =
+                SetCell(VTranslateVars::TryFormulaToUser(formula, m_tableOsSeparator),
+                        currentRow,
+                        ColumnFormula,
+                        Qt::AlignVCenter); // formula
+            formulaItem->setData(Qt::UserRole, formula);
+        }
     }
     else
     {
-        QTableWidgetItem *item = AddCell(meash->GetName(), currentRow, 0, Qt::AlignVCenter); // name
-        item->setData(Qt::UserRole, meash->GetName());
-
-        if (meash->IsCustom())
-        {
-            AddCell(meash->GetGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
-        }
-        else
-        {
-            AddCell(known.fullName, currentRow, ColumnFullName, Qt::AlignVCenter);
-        }
-
         QString calculatedValue;
         if (meash->IsSpecialUnits())
         {
@@ -3874,24 +3992,24 @@ void TMainWindow::RefreshMeasurementData(const QSharedPointer<VMeasurement> &mea
             calculatedValue = QStringLiteral("%1 (%2)").arg(calculatedValue, valueAlias);
         }
 
-        AddCell(calculatedValue,
+        SetCell(calculatedValue,
                 currentRow,
                 ColumnCalcValue,
                 Qt::AlignHCenter | Qt::AlignVCenter,
                 meash->IsFormulaOk()); // calculated value
 
-        AddCell(locale().toString(meash->GetBase()),
+        SetCell(locale().toString(meash->GetBase()),
                 currentRow,
                 ColumnBaseValue,
                 Qt::AlignHCenter | Qt::AlignVCenter); // base value
 
-        AddCell(locale().toString(meash->GetShiftA()), currentRow, ColumnShiftA, Qt::AlignHCenter | Qt::AlignVCenter);
+        SetCell(locale().toString(meash->GetShiftA()), currentRow, ColumnShiftA, Qt::AlignHCenter | Qt::AlignVCenter);
 
-        AddCell(locale().toString(meash->GetShiftB()), currentRow, ColumnShiftB, Qt::AlignHCenter | Qt::AlignVCenter);
+        SetCell(locale().toString(meash->GetShiftB()), currentRow, ColumnShiftB, Qt::AlignHCenter | Qt::AlignVCenter);
 
-        AddCell(locale().toString(meash->GetShiftC()), currentRow, ColumnShiftC, Qt::AlignHCenter | Qt::AlignVCenter);
+        SetCell(locale().toString(meash->GetShiftC()), currentRow, ColumnShiftC, Qt::AlignHCenter | Qt::AlignVCenter);
 
-        AddCell(locale().toString(meash->GetCorrection(m_currentDimensionA, m_currentDimensionB, m_currentDimensionC)),
+        SetCell(locale().toString(meash->GetCorrection(m_currentDimensionA, m_currentDimensionB, m_currentDimensionC)),
                 currentRow,
                 ColumnCorrection,
                 Qt::AlignHCenter | Qt::AlignVCenter);
@@ -167,6 +167,9 @@ private:
     VMeasurements *m_m{nullptr};
     VContainer *m_data{nullptr};
     bool m_refreshInProgress{false};
+    QVector<QPair<QString, VarType>> m_tableLayout{};
+    MeasurementsType m_tableType{MeasurementsType::Unknown};
+    bool m_tableOsSeparator{false};
     Unit m_mUnit{Unit::Cm};
     Unit m_pUnit{Unit::Cm};
     MeasurementsType m_mType{MeasurementsType::Individual};
@@ -246,10 +249,14 @@ private:
 
     auto AddCell(const QString &text, int row, int column, int aligment, bool ok = true) -> QTableWidgetItem *;
     auto AddSeparatorCell(const QString &text, int row, int column, int aligment, bool ok = true) -> QTableWidgetItem *;
+    auto SetCell(const QString &text, int row, int column, int aligment, bool ok = true) -> QTableWidgetItem *;
 
     void RefreshData(bool freshCall = false);
     void RefreshTable(bool freshCall = false);
-    void RefreshMeasurementData(const QSharedPointer<VMeasurement> &meash, qint32 currentRow);
+    void RefreshRowTexts(int row);
+    void RefreshMeasurementData(const QSharedPointer<VMeasurement> &meash,
+                                qint32 currentRow,
+                                QHash<QUuid, VKnownMeasurements> &knownCache);
 
     auto GetCustomName() const -> QString;
     static auto ClearCustomName(const QString &name) -> QString;
@@ -32,6 +32,7 @@
 #include "../ifc/xml/vdomdocument.h"
 #include "../vlayout/vlayoutgenerator.h"
 #include "../vmisc/commandoptions.h"
+#include "../vmisc/compatibility.h"
 #include "../vmisc/dialogs/dialogexporttocsv.h"
 #include "../vmisc/vsysexits.h"
 #include "../vmisc/vvalentinasettings.h"
@@ -48,6 +49,8 @@ using QTextCodec = VTextCodec;
 #include <QTextCodec>
 #endif // QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
 
+using namespace Qt::Literals::StringLiterals;
+
 VCommandLinePtr VCommandLine::instance = nullptr; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 #define translate(context, source)                                                                                     \
@@ -184,6 +187,10 @@ auto VCommandLine::DefaultGenerator() const -> VLayoutGeneratorPtr
 
     diag.DialogAccepted(); // filling VLayoutGenerator
 
+    // Console only, the dialog has no such options
+    res->SetNestingEngine(OptNestingEngine());
+    res->SetMultiStart(IsOptionSet(LONG_OPTION_MULTI_START));
+
     return res;
 }
 
@@ -275,6 +282,17 @@ auto VCommandLine::OptGroup() const -> Cases
     return static_cast<Cases>(r);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VCommandLine::OptNestingEngine() const -> NestingEngine
+{
+    int r = OptionValue(LONG_OPTION_NESTING_ENGINE).toInt();
+    if (r < 0 || r >= static_cast<int>(NestingEngine::UnknownEngine))
+    {
+        r = 0;
+    }
+    return static_cast<NestingEngine>(r);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VCommandLine::OptMeasurePath() const -> QString
 {
@@ -537,6 +555,34 @@ auto VCommandLine::OptDimensionC() const -> int
     const_cast<VCommandLine *>(this)->parser.showHelp(V_EX_USAGE);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VCommandLine::IsBatchExportEnabled() const -> bool
+{
+    return IsOptionSet(LONG_OPTION_DIMENSION_A_VALUES) || IsOptionSet(LONG_OPTION_DIMENSION_B_VALUES) ||
+           IsOptionSet(LONG_OPTION_DIMENSION_C_VALUES);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VCommandLine::OptDimensionAValues() const -> QVector<QPair<int, int>>
+{
+    return DimensionValues(LONG_OPTION_DIMENSION_A_VALUES,
+                           translate("VCommandLine", "Invalid list of dimension A values."));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VCommandLine::OptDimensionBValues() const -> QVector<QPair<int, int>>
+{
+    return DimensionValues(LONG_OPTION_DIMENSION_B_VALUES,
+                           translate("VCommandLine", "Invalid list of dimension B values."));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VCommandLine::OptDimensionCValues() const -> QVector<QPair<int, int>>
+{
+    return DimensionValues(LONG_OPTION_DIMENSION_C_VALUES,
+                           translate("VCommandLine", "Invalid list of dimension C values."));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VCommandLine::TiledPageMargins() const -> QMarginsF
 {
@@ -607,6 +653,28 @@ auto VCommandLine::TiledPageMargins() const -> QMarginsF
     return margins;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DimensionValues parse list of dimension values of the option. Shows help if the list is invalid.
+ */
+auto VCommandLine::DimensionValues(const QString &key, const QString &errorMsg) const -> QVector<QPair<int, int>>
+{
+    if (not IsOptionSet(key))
+    {
+        return {};
+    }
+
+    bool ok = false;
+    const QVector<QPair<int, int>> ranges = ParseDimensionValues(OptionValue(key), &ok);
+    if (not ok)
+    {
+        qCritical() << errorMsg << "\n";
+        const_cast<VCommandLine *>(this)->parser.showHelp(V_EX_USAGE);
+    }
+
+    return ranges;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VCommandLine::OptTiledPaperSize() const -> VAbstractLayoutDialog::PaperSizeTemplate
 {
@@ -685,6 +753,23 @@ void VCommandLine::InitCommandLineOptions()
          translate("VCommandLine", "Set base for dimension C in the multisize measurements units (export mode)."),
          translate("VCommandLine", "The dimension C base")},
 
+        {LONG_OPTION_DIMENSION_A_VALUES,
+         translate("VCommandLine",
+                   "Export every listed value of dimension A in one run (export mode). The list contains values, "
+                   "ranges <min>-<max> and the keyword 'all' separated by commas, for example 40,44-50. Each "
+                   "combination of dimension values is exported with the values appended to the base filename."),
+         translate("VCommandLine", "The dimension A values")},
+
+        {LONG_OPTION_DIMENSION_B_VALUES,
+         translate("VCommandLine", "Export every listed value of dimension B in one run (export mode). See "
+                                   "--dimensionAValues."),
+         translate("VCommandLine", "The dimension B values")},
+
+        {LONG_OPTION_DIMENSION_C_VALUES,
+         translate("VCommandLine", "Export every listed value of dimension C in one run (export mode). See "
+                                   "--dimensionAValues."),
+         translate("VCommandLine", "The dimension C values")},
+
         {LONG_OPTION_USER_MATERIAL,
          translate("VCommandLine",
                    "Use this option to override user material defined in pattern. The value must be in "
@@ -759,6 +844,16 @@ void VCommandLine::InitCommandLineOptions()
         {LONG_OPTION_MANUAL_PRIORITY,
          translate("VCommandLine", "Follow manual priority over priority by square (export mode).")},
         {LONG_OPTION_NEST_QUANTITY, translate("VCommandLine", "Nest quantity copies of each piece (export mode).")},
+        {LONG_OPTION_NESTING_ENGINE,
+         translate("VCommandLine",
+                   "Number corresponding to nesting engine (default = 0, export mode):\n\tContour sliding = "
+                   "0;\n\tNo-fit polygon of convex hulls = 1. Pieces don't go into concavities of other pieces"),
+         translate("VCommandLine", "Engine number"),
+         QChar('0')},
+        {LONG_OPTION_MULTI_START,
+         translate("VCommandLine",
+                   "Run one layout attempt per processor core with different grouping, rotation and shift, and keep "
+                   "the best result (export mode).")},
         {{SINGLE_OPTION_CROP_LENGTH, LONG_OPTION_CROP_LENGTH},
          translate("VCommandLine", "Auto crop unused length (export mode).")},
         {LONG_OPTION_CROP_WIDTH, translate("VCommandLine", "Auto crop unused width (export mode).")},
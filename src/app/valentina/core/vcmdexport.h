@@ -31,7 +31,9 @@
 
 #include <QCommandLineParser>
 #include <QCoreApplication>
+#include <QPair>
 #include <QTextStream>
+#include <QVector>
 #include <memory>
 #include <vector>
 
@@ -127,6 +129,14 @@ public:
     auto OptDimensionB() const -> int;
     auto OptDimensionC() const -> int;
 
+    //@brief tests if user asked to export several combinations of dimension values in one run
+    auto IsBatchExportEnabled() const -> bool;
+
+    //@brief returns inclusive ranges of dimension values to export or empty list if not set
+    auto OptDimensionAValues() const -> QVector<QPair<int, int>>;
+    auto OptDimensionBValues() const -> QVector<QPair<int, int>>;
+    auto OptDimensionCValues() const -> QVector<QPair<int, int>>;
+
     auto TiledPageMargins() const -> QMarginsF;
     auto OptTiledPaperSize() const -> VAbstractLayoutDialog::PaperSizeTemplate;
     auto OptTiledPageOrientation() const -> PageOrientation;
@@ -139,6 +149,8 @@ protected:
 
     auto OptGroup() const -> Cases;
 
+    auto OptNestingEngine() const -> NestingEngine;
+
     //@brief: called in destructor of application, so instance destroyed and new maybe created (never happen scenario
     // though)
     static void Reset();
@@ -154,6 +166,7 @@ private:
     friend class VApplication;
 
     auto FormatSize(const QString &key) const -> VAbstractLayoutDialog::PaperSizeTemplate;
+    auto DimensionValues(const QString &key, const QString &errorMsg) const -> QVector<QPair<int, int>>;
 
     void InitCommandLineOptions();
     auto IsOptionSet(const QString &option) const -> bool;
@@ -80,6 +80,7 @@ DialogFinalMeasurements::DialogFinalMeasurements(VPattern *doc, QWidget *parent)
     FillFinalMeasurements(freshCall);
 
     connect(m_doc, &VPattern::FullUpdateFromFile, this, &DialogFinalMeasurements::FullUpdateFromFile);
+    connect(m_doc, &VPattern::IncrementalUpdateFromFile, this, &DialogFinalMeasurements::FullUpdateFromFile);
 
     ui->lineEditName->setValidator(
         new QRegularExpressionValidator(QRegularExpression(QStringLiteral("^$|") + NameRegExp()), this));
@@ -180,6 +180,7 @@ DialogIncrements::DialogIncrements(VContainer *data, VPattern *doc, QWidget *par
     FillAnglesCurves();
 
     connect(this->m_patternDoc, &VPattern::FullUpdateFromFile, this, &DialogIncrements::FullUpdateFromFile);
+    connect(this->m_patternDoc, &VPattern::IncrementalUpdateFromFile, this, &DialogIncrements::FullUpdateFromFile);
 
     ui->tabWidget->setCurrentIndex(0);
     auto *validator = new QRegularExpressionValidator(QRegularExpression(QStringLiteral("^$|") + NameRegExp()), this);
@@ -2386,6 +2387,7 @@ void DialogIncrements::closeEvent(QCloseEvent *event)
     const QSignalBlocker blockerDescription(ui->plainTextEditDescription);
 
     disconnect(this->m_patternDoc, &VPattern::FullUpdateFromFile, this, &DialogIncrements::FullUpdateFromFile);
+    disconnect(this->m_patternDoc, &VPattern::IncrementalUpdateFromFile, this, &DialogIncrements::FullUpdateFromFile);
 
     VValentinaSettings *settings = VAbstractValApplication::VApp()->ValentinaSettings();
 
@@ -2520,6 +2522,7 @@ DialogIncrements::~DialogIncrements()
 void DialogIncrements::RestoreAfterClose()
 {
     connect(this->m_patternDoc, &VPattern::FullUpdateFromFile, this, &DialogIncrements::FullUpdateFromFile);
+    connect(this->m_patternDoc, &VPattern::IncrementalUpdateFromFile, this, &DialogIncrements::FullUpdateFromFile);
 
     ui->tabWidget->setCurrentIndex(0);
 
@@ -49,6 +49,7 @@
 #include "../vmisc/vabstractvalapplication.h"
 #include "../vmisc/vvalentinasettings.h"
 #include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/vpiece.h"
 #include "../xml/vpattern.h"
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 4, 0)
@@ -293,6 +294,8 @@ void DialogPatternProperties::SaveDescription()
         if (const bool lengthChanged = m_oldPassmarkLength != ui->lineEditPassmarkLength->text();
             lengthChanged || widthChanged)
         {
+            // Pieces keep passmarks built with the old variables
+            VPiece::InvalidateGeometryCache();
             emit UpddatePieces();
 
             if (lengthChanged)
@@ -56,6 +56,7 @@
 #include <QtConcurrent>
 #include <QtDebug>
 #include <QtGlobal>
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -2587,13 +2588,16 @@ void MainWindow::SyncMeasurements()
         // Temporarily remove the path to prevent infinite synchronization after a format conversion.
         m_watcher->removePath(path);
 
+        // Reading creates new measurement objects. Keep the old ones to find what changed.
+        const QMap<QString, QSharedPointer<VMeasurement>> measurements = pattern->DataMeasurementsWithSeparators();
+
         if (UpdateMeasurements(patternPath, path, m_currentDimensionA, m_currentDimensionB, m_currentDimensionC))
         {
             const QString msg = tr("Measurements have been synced");
             qCDebug(vMainWindow, "%s", qUtf8Printable(msg));
             statusBar()->showMessage(msg, 5000);
             VWidgetPopup::PopupMessage(this, msg);
-            doc->LiteParseTree(Document::FullLiteParse);
+            doc->IncrementalParseTree(measurements);
             StoreDimensions();
             m_mChanges = false;
             m_mChangesAsked = true;
@@ -3166,7 +3170,7 @@ void MainWindow::RefreshPieceGeometry()
     return;
   }
 
-  doc->RefreshDirtyPieceGeometry(pattern->DataPieces()->keys());
+  doc->RefreshDirtyPieceGeometry(doc->DirtyPieces());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -5407,9 +5411,20 @@ void MainWindow::GradationChanged()
         reopened = true;
     }
 
+    // Reading creates new measurement objects. Keep the old ones to find what changed.
+    const QMap<QString, QSharedPointer<VMeasurement>> measurements = pattern->DataMeasurementsWithSeparators();
+
     if (UpdateMeasurements(m_m, m_currentDimensionA, m_currentDimensionB, m_currentDimensionC, reopened))
     {
-        doc->LiteParseTree(Document::FullLiteParse);
+        if (reopened)
+        {
+            doc->LiteParseTree(Document::FullLiteParse);
+        }
+        else
+        {
+            // Only values of measurements differ between sizes, the graph stays the same.
+            doc->IncrementalParseTree(measurements);
+        }
         qCDebug(vMainWindow, "GradationChanged: lite parse tree done.");
         StoreDimensions();
         qCDebug(vMainWindow, "GradationChanged: dimensions stored.");
@@ -6618,6 +6633,8 @@ void MainWindow::InitDocksContain()
     connect(ui->view, &VMainGraphicsView::itemClicked, m_toolOptions, &VToolOptionsPropertyBrowser::itemClicked);
     connect(doc, &VPattern::FullUpdateFromFile, m_toolOptions, &VToolOptionsPropertyBrowser::UpdateOptions,
             Qt::QueuedConnection);
+    connect(doc, &VPattern::IncrementalUpdateFromFile, m_toolOptions, &VToolOptionsPropertyBrowser::UpdateOptions,
+            Qt::QueuedConnection);
 
     qCDebug(vMainWindow, "Initialization groups dock.");
     m_groupsWidget = new VWidgetGroups(doc, this);
@@ -6626,6 +6643,7 @@ void MainWindow::InitDocksContain()
 
     m_detailsWidget = new VWidgetDetails(pattern, doc, this);
     connect(doc, &VPattern::FullUpdateFromFile, m_detailsWidget, &VWidgetDetails::UpdateList);
+    connect(doc, &VPattern::IncrementalUpdateFromFile, m_detailsWidget, &VWidgetDetails::UpdateList);
     connect(doc, &VPattern::UpdateInLayoutList, m_detailsWidget, &VWidgetDetails::UpdateList);
     connect(doc, &VPattern::ShowDetail, m_detailsWidget, &VWidgetDetails::SelectDetail);
     connect(m_detailsWidget, &VWidgetDetails::Highlight, m_sceneDetails, &VMainGraphicsScene::HighlightItem);
@@ -7716,7 +7734,7 @@ void MainWindow::ZoomFirstShow()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto MainWindow::DoExport(const VCommandLinePtr &expParams) -> bool
+auto MainWindow::DoExport(const VCommandLinePtr &expParams, const QString &baseName) -> bool
 {
     QVector<DetailForLayout> details;
     if (not VAbstractValApplication::VApp()->getOpeningPattern())
@@ -7747,7 +7765,7 @@ auto MainWindow::DoExport(const VCommandLinePtr &expParams) -> bool
         try
         {
             m_dialogSaveLayout = QSharedPointer<DialogSaveLayout>(
-                new DialogSaveLayout(1, Draw::Modeling, expParams->OptBaseName(), this));
+                new DialogSaveLayout(1, Draw::Modeling, baseName, this));
             m_dialogSaveLayout->SetDestinationPath(expParams->OptDestinationPath());
             m_dialogSaveLayout->SelectFormat(static_cast<LayoutExportFormats>(expParams->OptExportType()));
             m_dialogSaveLayout->SetBinaryDXFFormat(expParams->IsBinaryDXF());
@@ -7788,7 +7806,7 @@ auto MainWindow::DoExport(const VCommandLinePtr &expParams) -> bool
             {
                 m_dialogSaveLayout = QSharedPointer<DialogSaveLayout>(
                     new DialogSaveLayout(static_cast<int>(m_layoutSettings->LayoutScenes().size()), Draw::Layout,
-                                         expParams->OptBaseName(), this));
+                                         baseName, this));
                 m_dialogSaveLayout->SetDestinationPath(expParams->OptDestinationPath());
                 m_dialogSaveLayout->SelectFormat(static_cast<LayoutExportFormats>(expParams->OptExportType()));
                 m_dialogSaveLayout->SetBinaryDXFFormat(expParams->IsBinaryDXF());
@@ -7832,12 +7850,11 @@ auto MainWindow::DoExport(const VCommandLinePtr &expParams) -> bool
 /**
  * @brief DoFMExport process export final measurements
  * @param expParams command line options
+ * @param filePath path to the csv file
  * @return true if succesfull
  */
-auto MainWindow::DoFMExport(const VCommandLinePtr &expParams) -> bool
+auto MainWindow::DoFMExport(const VCommandLinePtr &expParams, QString filePath) -> bool
 {
-    QString filePath = expParams->OptExportFMTo();
-
     if (filePath.isEmpty())
     {
         qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export final measurements error.")),
@@ -7870,6 +7887,160 @@ auto MainWindow::DoFMExport(const VCommandLinePtr &expParams) -> bool
     return ExportFMeasurementsToCSVData(filePath, expParams->IsCSVWithHeader(), mib, separator);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DoBatchExport export every requested combination of dimension values.
+ *
+ * The pattern and measurements are loaded only once. For each combination all dimensions are switched first, then the
+ * pattern is recalculated once and the layout and/or final measurements are exported. Values of each combination are
+ * appended to the base name of files.
+ * @param expParams command line options
+ * @return true if succesfull
+ */
+auto MainWindow::DoBatchExport(const VCommandLinePtr &expParams) -> bool
+{
+    if (VAbstractValApplication::VApp()->GetMeasurementsType() != MeasurementsType::Multisize)
+    {
+        qCCritical(vMainWindow, "%s",
+                   qUtf8Printable(tr("Couldn't export several sizes. Need a file with multisize measurements.")));
+        QCoreApplication::exit(V_EX_DATAERR);
+        return false;
+    }
+
+    const QVector<QVector<QPair<int, int>>> ranges{expParams->OptDimensionAValues(), expParams->OptDimensionBValues(),
+                                                   expParams->OptDimensionCValues()};
+    const QVector<QPointer<QComboBox>> controls{m_dimensionA, m_dimensionB, m_dimensionC};
+    const QVector<std::function<bool(int)>> setters{[this](int value) { return SetDimensionA(value); },
+                                                    [this](int value) { return SetDimensionB(value); },
+                                                    [this](int value) { return SetDimensionC(value); }};
+
+    // Values of the dimension that fall into requested ranges. Must be called after previous dimensions were set,
+    // because they restrict available values.
+    auto ValuesInRanges = [&ranges, &controls](int dimension) -> QVector<int>
+    {
+        QVector<int> values;
+        const QPointer<QComboBox> &control = controls.at(dimension);
+        if (control.isNull())
+        {
+            return values;
+        }
+
+        for (int i = 0; i < control->count(); ++i)
+        {
+            const int value = qRound(control->itemData(i).toDouble());
+            const bool inRange = std::any_of(ranges.at(dimension).cbegin(), ranges.at(dimension).cend(),
+                                             [value](const QPair<int, int> &range)
+                                             { return value >= range.first && value <= range.second; });
+            if (inRange && not values.contains(value))
+            {
+                values.append(value);
+            }
+        }
+        return values;
+    };
+
+    QString fmPath;
+    if (expParams->IsExportFMEnabled())
+    {
+        fmPath = expParams->OptExportFMTo();
+        if (QFileInfo const info(fmPath); not fmPath.isEmpty() && info.isRelative())
+        {
+            fmPath = QDir::currentPath() + '/'_L1 + fmPath;
+        }
+    }
+
+    const QString baseName = expParams->OptBaseName();
+    int exported = 0;
+
+    std::function<bool(int, const QString &)> ExportDimension;
+    ExportDimension = [&](int dimension, const QString &suffix) -> bool
+    {
+        if (dimension >= ranges.size())
+        {
+            ApplyPendingGradation();
+
+            if (expParams->IsExportEnabled() && not DoExport(expParams, baseName + suffix))
+            {
+                return false;
+            }
+
+            if (expParams->IsExportFMEnabled())
+            {
+                QString path = fmPath;
+                if (not path.isEmpty())
+                {
+                    const QFileInfo info(fmPath);
+                    path = info.absolutePath() + '/'_L1 + info.completeBaseName() + suffix;
+                    if (not info.suffix().isEmpty())
+                    {
+                        path += '.'_L1 + info.suffix();
+                    }
+                }
+
+                if (not DoFMExport(expParams, path))
+                {
+                    return false;
+                }
+            }
+
+            ++exported;
+            return true;
+        }
+
+        if (ranges.at(dimension).isEmpty())
+        {
+            return ExportDimension(dimension + 1, suffix);
+        }
+
+        const QVector<int> values = ValuesInRanges(dimension);
+        for (auto value : values)
+        {
+            if (not setters.at(dimension)(value))
+            {
+                QCoreApplication::exit(V_EX_DATAERR);
+                return false;
+            }
+
+            // Switching a dimension rebuilds the next dimensions' values right away. The pattern is recalculated
+            // once per combination, just before the export.
+            if (not ExportDimension(dimension + 1, suffix + '_'_L1 + QString::number(value)))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (not ExportDimension(0, QString()))
+    {
+        return false;
+    }
+
+    if (exported == 0)
+    {
+        qCCritical(vMainWindow, "%s",
+                   qUtf8Printable(tr("None of the requested dimension values is supported by this pattern file.")));
+        QCoreApplication::exit(V_EX_DATAERR);
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ApplyPendingGradation recalculate the pattern right away if a dimension value was changed.
+ *
+ * In GUI mode switching dimensions is delayed by timer. Console mode needs the result before export.
+ */
+void MainWindow::ApplyPendingGradation()
+{
+    if (m_gradation->isActive())
+    {
+        GradationChanged();
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto MainWindow::SetDimensionA(int value) -> bool
 {
@@ -8047,7 +8218,7 @@ void MainWindow::ProcessCMD()
 
         if (cmd->IsSetDimensionC())
         {
-            cSetted = SetDimensionB(cmd->OptDimensionC());
+            cSetted = SetDimensionC(cmd->OptDimensionC());
         }
 
         if (not(aSetted && bSetted && cSetted))
@@ -8056,16 +8227,28 @@ void MainWindow::ProcessCMD()
             return;
         }
 
+        ApplyPendingGradation();
+
         if (not cmd->IsTestModeEnabled())
         {
-            if (cmd->IsExportEnabled() && not DoExport(cmd))
+            if (cmd->IsBatchExportEnabled())
             {
-                return;
+                if ((cmd->IsExportEnabled() || cmd->IsExportFMEnabled()) && not DoBatchExport(cmd))
+                {
+                    return;
+                }
             }
-
-            if (cmd->IsExportFMEnabled() && not DoFMExport(cmd))
+            else
             {
-                return;
+                if (cmd->IsExportEnabled() && not DoExport(cmd, cmd->OptBaseName()))
+                {
+                    return;
+                }
+
+                if (cmd->IsExportFMEnabled() && not DoFMExport(cmd, cmd->OptExportFMTo()))
+                {
+                    return;
+                }
             }
         }
 
@@ -464,8 +464,10 @@ private:
     void ReadMeasurements(qreal baseA, qreal baseB, qreal baseC, bool rebuildGradation = true);
 
     void ReopenFilesAfterCrash(QStringList &args);
-    auto DoExport(const VCommandLinePtr &expParams) -> bool;
-    auto DoFMExport(const VCommandLinePtr &expParams) -> bool;
+    auto DoExport(const VCommandLinePtr &expParams, const QString &baseName) -> bool;
+    auto DoFMExport(const VCommandLinePtr &expParams, QString filePath) -> bool;
+    auto DoBatchExport(const VCommandLinePtr &expParams) -> bool;
+    void ApplyPendingGradation();
 
     auto SetDimensionA(int value) -> bool;
     auto SetDimensionB(int value) -> bool;
@@ -31,9 +31,11 @@
 #include "../ifc/xml/vvstconverter.h"
 #include "../vdxf/libdxfrw/drw_base.h"
 #include "../vformat/vmeasurements.h"
+#include "../vformat/vsinglelineoutlinechar.h"
 #include "../vganalytics/vganalytics.h"
 #include "../vlayout/vlayoutexporter.h"
 #include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vtextmanager.h"
 #include "../vmisc/compatibility.h"
 #include "../vmisc/dialogs/dialogexporttocsv.h"
 #include "../vmisc/qxtcsvmodel.h"
@@ -117,6 +119,94 @@ void RemoveLayoutPath(const QString &path, bool usedNotExistedDir)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+struct ExportPieceItem
+{
+    QGraphicsItem *item{nullptr};
+    QTransform matrix{}; // piece matrix moved to the item position
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareExportItems builds graphics items of pieces in a thread pool.
+ *
+ * Text to path conversion and label layout take most of the export time. Items are not bound to any scene, so each
+ * piece can be prepared separately. The result keeps the order of pieces.
+ */
+auto PrepareExportItems(const QVector<VLayoutPiece> &pieces, bool textAsPaths, bool togetherWithNotches)
+    -> QVector<ExportPieceItem>
+{
+    // Initialize everything workers would initialize lazily. Settings cache values on first read, the SVG font
+    // database and font corrections are created on first use.
+    const VCommonSettings *settings = VAbstractApplication::VApp()->Settings();
+    settings->WidthHairLine();
+
+    if (settings->GetSingleLineFonts())
+    {
+        VAbstractApplication::VApp()->SVGFontDatabase();
+    }
+
+    if (settings->GetSingleStrokeOutlineFont())
+    {
+        QSet<QString> families{settings->GetLabelFont().family()};
+        for (const auto &piece : pieces)
+        {
+            families.insert(piece.GetPieceLabelData().GetFont().family());
+            families.insert(piece.GetPatternLabelData().GetFont().family());
+        }
+
+        const QString correctionsPath = settings->GetPathFontCorrections();
+        for (const auto &family : std::as_const(families))
+        {
+            if (VSingleLineOutlineChar const corrector(QFont(family)); !corrector.IsPopulated())
+            {
+                corrector.LoadCorrections(correctionsPath);
+            }
+        }
+    }
+
+    std::function<ExportPieceItem(const VLayoutPiece &rawPiece)> const PrepareItem =
+        [textAsPaths, togetherWithNotches](const VLayoutPiece &rawPiece)
+    {
+        VLayoutPiece piece = rawPiece;
+        QGraphicsItem *item = piece.GetItem(textAsPaths, togetherWithNotches, false);
+        qreal diff = 0;
+        if (piece.IsForceFlipping())
+        {
+            const qreal x = item->boundingRect().x();
+            piece.Mirror();
+            delete item;
+            item = piece.GetItem(textAsPaths, togetherWithNotches, false);
+            diff = item->boundingRect().x() - x;
+        }
+
+        QTransform moveMatrix = piece.GetMatrix();
+        if (piece.IsForceFlipping())
+        {
+            item->setPos(piece.GetMx() - diff, piece.GetMy());
+            moveMatrix = moveMatrix.translate(-piece.GetMx() + diff, piece.GetMy());
+        }
+        else
+        {
+            item->setPos(piece.GetMx(), piece.GetMy());
+            moveMatrix = moveMatrix.translate(piece.GetMx(), piece.GetMy());
+        }
+
+        return ExportPieceItem{.item = item, .matrix = moveMatrix};
+    };
+
+    const QFuture<ExportPieceItem> future = QtConcurrent::mapped(pieces, PrepareItem);
+
+    QVector<ExportPieceItem> items;
+    items.reserve(pieces.size());
+    for (auto i = future.constBegin(); i != future.constEnd(); ++i)
+    {
+        items.append(*i);
+    }
+
+    return items;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 #if !defined(V_NO_ASSERT)
 Q_DECL_UNUSED void InsertGlobalContours(const QList<QGraphicsScene *> &scenes, const QList<QGraphicsItem *> &gcontours);
@@ -591,31 +681,14 @@ void MainWindowsNoGUI::ExportDetailsAsFlatLayout(const QVector<VLayoutPiece> &li
 
     QScopedPointer<QGraphicsScene> const scene(new QGraphicsScene());
 
+    const QVector<ExportPieceItem> items = PrepareExportItems(
+        listDetails, m_dialogSaveLayout->IsTextAsPaths(), m_dialogSaveLayout->IsBoundaryTogetherWithNotches());
+
     QList<QGraphicsItem *> list;
-    list.reserve(listDetails.count());
-    for (auto piece : listDetails)
+    list.reserve(items.size());
+    for (const auto &prepared : items)
     {
-        QGraphicsItem *item = piece.GetItem(m_dialogSaveLayout->IsTextAsPaths(),
-                                            m_dialogSaveLayout->IsBoundaryTogetherWithNotches(), false);
-        qreal diff = 0;
-        if (piece.IsForceFlipping())
-        {
-            const qreal x = item->boundingRect().x();
-            piece.Mirror();
-            item = piece.GetItem(m_dialogSaveLayout->IsTextAsPaths(),
-                                 m_dialogSaveLayout->IsBoundaryTogetherWithNotches(), false);
-            diff = item->boundingRect().x() - x;
-        }
-
-        if (piece.IsForceFlipping())
-        {
-            item->setPos(piece.GetMx() - diff, piece.GetMy());
-        }
-        else
-        {
-            item->setPos(piece.GetMx(), piece.GetMy());
-        }
-        list.append(item);
+        list.append(prepared.item);
     }
 
     for (auto *item : list)
@@ -735,37 +808,15 @@ void MainWindowsNoGUI::ExportDetailsAsApparelLayout(QVector<VLayoutPiece> listDe
 
     QScopedPointer<QGraphicsScene> const scene(new QGraphicsScene());
 
+    const QVector<ExportPieceItem> items = PrepareExportItems(
+        listDetails, m_dialogSaveLayout->IsTextAsPaths(), m_dialogSaveLayout->IsBoundaryTogetherWithNotches());
+
     QList<QGraphicsItem *> list;
-    list.reserve(listDetails.count());
-    for (int i = 0; i < listDetails.count(); ++i)
+    list.reserve(items.size());
+    for (vsizetype i = 0; i < items.size(); ++i)
     {
-        VLayoutPiece piece = listDetails.at(i);
-        QGraphicsItem *item = piece.GetItem(m_dialogSaveLayout->IsTextAsPaths(),
-                                            m_dialogSaveLayout->IsBoundaryTogetherWithNotches(), false);
-        qreal diff = 0;
-        if (piece.IsForceFlipping())
-        {
-            const qreal x = item->boundingRect().x();
-            piece.Mirror();
-            delete item;
-            item = piece.GetItem(m_dialogSaveLayout->IsTextAsPaths(),
-                                 m_dialogSaveLayout->IsBoundaryTogetherWithNotches(), false);
-            diff = item->boundingRect().x() - x;
-        }
-
-        QTransform moveMatrix = piece.GetMatrix();
-        if (piece.IsForceFlipping())
-        {
-            item->setPos(piece.GetMx() - diff, piece.GetMy());
-            moveMatrix = moveMatrix.translate(-piece.GetMx() + diff, piece.GetMy());
-        }
-        else
-        {
-            item->setPos(piece.GetMx(), piece.GetMy());
-            moveMatrix = moveMatrix.translate(piece.GetMx(), piece.GetMy());
-        }
-        listDetails[i].SetMatrix(moveMatrix);
-        list.append(item);
+        listDetails[i].SetMatrix(items.at(i).matrix);
+        list.append(items.at(i).item);
     }
 
     for (auto *item : list)
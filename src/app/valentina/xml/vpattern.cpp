@@ -55,6 +55,7 @@
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vpatterndb/variables/vincrement.h"
+#include "../vpatterndb/variables/vmeasurement.h"
 #include "../vpatterndb/vnodedetail.h"
 #include "../vpatterndb/vpiecenode.h"
 #include "../vpatterndb/vpiecepath.h"
@@ -109,6 +110,7 @@
 #include "tools/drawTools/toolcurve/vtoolparallelcurve.h"
 #include "typedef.h"
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <qstringliteral.h>
@@ -241,6 +243,36 @@ auto CollectUnionChildIds(const QDomElement &toolElement) -> QVector<vidtype>
     CollectFromUnionSection(tagChildren, VToolSeamAllowance::TagPlaceLabels, ids);
     return ids;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ElementReferencesAny check if any attribute of the element or its children mentions one of the names.
+ *
+ * Plain substring test. It can give a false positive, that costs only an extra recalculation, but never misses a
+ * formula.
+ */
+auto ElementReferencesAny(const QDomElement &element, const QSet<QString> &names) -> bool
+{
+    const QDomNamedNodeMap attributes = element.attributes();
+    for (int i = 0; i < attributes.length(); ++i)
+    {
+        const QString value = attributes.item(i).nodeValue();
+        if (std::any_of(names.cbegin(), names.cend(), [&value](const QString &name) { return value.contains(name); }))
+        {
+            return true;
+        }
+    }
+
+    for (QDomElement child = element.firstChildElement(); not child.isNull(); child = child.nextSiblingElement())
+    {
+        if (ElementReferencesAny(child, names))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
 } // anonymous namespace
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -354,6 +386,7 @@ void VPattern::Clear()
     m_refreshGeometryTimer->stop(); // Drop any pending refresh; it would run against a cleared document.
 
     m_pieceGeometryDirty = true;
+    m_dirtyPieces.clear();
 
     m_garbageCollected = false;
     m_garbageCollectBackupFilePath.clear();
@@ -419,6 +452,14 @@ void VPattern::UpdateToolData(const quint32 &id, VContainer *data)
 {
     Q_ASSERT_X(id != 0, Q_FUNC_INFO, "id == 0"); //-V712 //-V654
     SCASSERT(data != nullptr)
+
+    // During an incremental parse objects and variables are updated in place. Every tool's copy already shares them,
+    // while replacing the copy would give a tool objects created after it.
+    if (m_incrementalParse)
+    {
+        return;
+    }
+
     if (!tools.contains(id))
     {
         // Tool was deleted (e.g. an undo command freed its owner piece); skip gracefully.
@@ -803,6 +844,295 @@ void VPattern::LiteParseTree(const Document &parse)
     qCDebug(vXML, "Scene size updated.");
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IncrementalParseTree recalculate only the part of the pattern that depends on changed measurements.
+ *
+ * Measurements must be already reloaded into the container. Only increments and tools whose formulas mention a
+ * changed measurement, and everything downstream of them in the dependency graph, are parsed again in document order.
+ * Other tools keep their objects and scene items. Falls back to a full lite parse when the graph is not ready, the list
+ * of measurements changed or the incremental pass failed.
+ * @param previous measurements before the reload.
+ */
+void VPattern::IncrementalParseTree(const QMap<QString, QSharedPointer<VMeasurement>> &previous)
+{
+    const std::optional<QSet<QString>> changed = RebindMeasurements(previous);
+    if (not changed || not IsPatternGraphComplete())
+    {
+        LiteParseTree(Document::FullLiteParse);
+        return;
+    }
+
+    if (changed->isEmpty())
+    {
+        return;
+    }
+
+    // Save current pattern block name
+    QString const namePP = PatternBlockMapper()->GetActive();
+
+    emit PreParseState();
+    emit CancelLabelRendering();
+    emit SetEnabledGUI(true);
+
+    QVector<vidtype> parsed;
+    bool failed = false;
+    {
+        // The topology doesn't change, keep the graph.
+        PatternGraph()->SetGraphRebuildEnabled(false);
+        m_incrementalParse = true;
+        auto guard = qScopeGuard(
+            [this]() -> void
+            {
+                m_incrementalParse = false;
+                PatternGraph()->SetGraphRebuildEnabled(true);
+            });
+
+        try
+        {
+            parsed = ParseDependentElements(ReevaluateIncrements(*changed));
+        }
+        catch (const VException &e)
+        {
+            qCDebug(vXML, "Incremental parse failed: %s", qUtf8Printable(e.ErrorMessage()));
+            failed = true;
+        }
+        catch (const std::bad_alloc &)
+        {
+            failed = true;
+        }
+    }
+
+    if (failed)
+    {
+        // Full lite parse repeats the work and reports the error
+        updatePieces.clear();
+        LiteParseTree(Document::FullLiteParse);
+        return;
+    }
+
+    qCDebug(vXML, "Incremental parse recalculated %lld elements.", static_cast<long long>(parsed.size()));
+
+    // Restore current pattern block name
+    PatternBlockMapper()->SetActive(namePP);
+    setCurrentData();
+
+    try
+    {
+        for (auto id : std::as_const(parsed))
+        {
+            if (auto *tool = qobject_cast<VAbstractTool *>(tools.value(id, nullptr)))
+            {
+                tool->FullUpdateFromFile();
+            }
+        }
+        emit IncrementalUpdateFromFile();
+    }
+    catch (VException &e)
+    {
+        qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error updating scene after parsing.")),
+                   qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
+        emit SetEnabledGUI(false);
+        return;
+    }
+
+    if (not updatePieces.isEmpty())
+    {
+        if (VApplication::IsGUIMode())
+        {
+            m_refreshGeometryTimer->start();
+        }
+        else if (VApplication::CommandLine()->IsTestModeEnabled())
+        {
+            RefreshPieceGeometry();
+        }
+    }
+
+    // Recalculate scene rect
+    VMainGraphicsView::NewSceneRect(sceneDraw, VAbstractValApplication::VApp()->getSceneView());
+    VMainGraphicsView::NewSceneRect(sceneDetail, VAbstractValApplication::VApp()->getSceneView());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RebindMeasurements move new measurement values into the previous instances.
+ *
+ * Reading a measurement file creates new objects, but tools keep copies of the container that still point to the old
+ * ones. Writing new values through the old instances updates all copies at once.
+ * @param previous measurements before the reload.
+ * @return names of measurements with a new value or nothing if the list of measurements changed.
+ */
+auto VPattern::RebindMeasurements(const QMap<QString, QSharedPointer<VMeasurement>> &previous)
+    -> std::optional<QSet<QString>>
+{
+    const QMap<QString, QSharedPointer<VMeasurement>> current = data->DataMeasurementsWithSeparators();
+    if (current.size() != previous.size())
+    {
+        return std::nullopt;
+    }
+
+    QSet<QString> changed;
+    for (auto i = current.constBegin(); i != current.constEnd(); ++i)
+    {
+        const QSharedPointer<VMeasurement> old = previous.value(i.key());
+        if (old.isNull() || old->GetType() != i.value()->GetType())
+        {
+            return std::nullopt;
+        }
+
+        if (old == i.value())
+        {
+            continue;
+        }
+
+        if (not VFuzzyComparePossibleNulls(std::as_const(*old).GetValue(), std::as_const(*i.value()).GetValue()))
+        {
+            changed.insert(i.key());
+        }
+
+        *old = *i.value();
+        data->RemoveVariable(i.key());
+        data->AddVariable(old);
+    }
+
+    return changed;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReevaluateIncrements recalculate increments and preview calculations that depend on the names.
+ *
+ * Increments are updated in place and may refer only to measurements and previous increments, so one pass in table
+ * order is enough.
+ * @param names changed variables.
+ * @return the names together with names of recalculated increments.
+ */
+auto VPattern::ReevaluateIncrements(QSet<QString> names) -> QSet<QString>
+{
+    for (const auto &tag : {TagIncrements, TagPreviewCalculations})
+    {
+        quint32 index = 0;
+        const QDomElement table = documentElement().firstChildElement(tag);
+        for (QDomElement domElement = table.firstChildElement(TagIncrement); not domElement.isNull();
+             domElement = domElement.nextSiblingElement(TagIncrement))
+        {
+            const quint32 position = index++;
+            if (not ElementReferencesAny(domElement, names))
+            {
+                continue;
+            }
+
+            auto *increment = ParseIncrement(domElement, position, tag == TagPreviewCalculations);
+            names.insert(increment->GetName());
+            data->AddVariable(increment);
+        }
+    }
+
+    return names;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseDependentElements parse again elements that depend on the names.
+ *
+ * An element that mentions one of the names is a seed. Its downstream subgraph is taken from the pattern graph. The
+ * document order is a topological order of the graph, so walking the tree once and parsing only marked elements
+ * recalculates each of them after all its dependencies.
+ * @param names changed variables.
+ * @return ids of parsed elements in document order.
+ */
+auto VPattern::ParseDependentElements(const QSet<QString> &names) -> QVector<vidtype>
+{
+    const VPatternGraph *graph = PatternGraph();
+    QSet<vidtype> dependent;
+    QVector<vidtype> parsed;
+
+    for (QDomElement drawElement = documentElement().firstChildElement(TagDraw); not drawElement.isNull();
+         drawElement = drawElement.nextSiblingElement(TagDraw))
+    {
+        bool blockDataLoaded = false;
+
+        for (QDomElement section = drawElement.firstChildElement(); not section.isNull();
+             section = section.nextSiblingElement())
+        {
+            const QString sectionTag = section.tagName();
+            if (sectionTag != TagCalculation && sectionTag != TagModeling && sectionTag != TagDetails)
+            {
+                continue;
+            }
+
+            for (QDomElement domElement = section.firstChildElement(); not domElement.isNull();
+                 domElement = domElement.nextSiblingElement())
+            {
+                const vidtype id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+                if (id == NULL_ID)
+                {
+                    continue;
+                }
+
+                if (not dependent.contains(id))
+                {
+                    if (not ElementReferencesAny(domElement, names))
+                    {
+                        continue;
+                    }
+
+                    const QVector<VNode> nodes = graph->GetDependentNodes(id, FilterNoopCallback());
+                    for (const auto &node : nodes)
+                    {
+                        dependent.insert(node.id);
+                    }
+                }
+
+                if (not blockDataLoaded)
+                {
+                    LoadPatternBlockData(drawElement);
+                    blockDataLoaded = true;
+                }
+
+                if (sectionTag == TagDetails)
+                {
+                    if (domElement.tagName() == TagDetail)
+                    {
+                        ParseDetailElement(domElement, Document::LiteParse);
+                        updatePieces.append(id);
+                    }
+                }
+                else
+                {
+                    ParseDrawModeElement(domElement, Document::LiteParse,
+                                         sectionTag == TagCalculation ? Draw::Calculation : Draw::Modeling);
+                }
+                parsed.append(id);
+            }
+        }
+    }
+
+    return parsed;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoadPatternBlockData make the pattern block current and load its state into the container.
+ *
+ * Calculation objects are separate for each pattern block. The copy kept by the last tool of the block contains all of
+ * them.
+ * @param drawElement draw tag of the pattern block.
+ */
+void VPattern::LoadPatternBlockData(const QDomElement &drawElement)
+{
+    VPatternBlockMapper *blocks = PatternBlockMapper();
+    {
+        const QSignalBlocker blocker(blocks);
+        blocks->SetActive(GetParametrString(drawElement, AttrName));
+    }
+
+    if (const quint32 id = PPLastToolId(blocks->GetActiveId()); tools.contains(id))
+    {
+        *data = tools.value(id)->GetDataCopy();
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // cppcheck-suppress unusedFunction
 void VPattern::customEvent(QEvent *event)
@@ -843,12 +1173,24 @@ auto VPattern::IsPieceGeometryDirty() const -> bool
 void VPattern::SetPieceGeometryDirty(bool newPieceGeometryDirty)
 {
     m_pieceGeometryDirty = newPieceGeometryDirty;
+    m_dirtyPieces.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DirtyPieces return pieces that wait for a geometry refresh.
+ * @return list of piece ids. All pieces if the parse that made geometry dirty did not track them.
+ */
+auto VPattern::DirtyPieces() const -> QList<vidtype>
+{
+    return m_dirtyPieces.isEmpty() ? data->DataPieces()->keys() : m_dirtyPieces.values();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::RefreshDirtyPieceGeometry(const QList<vidtype> &list)
 {
     m_pieceGeometryDirty = false;
+    m_dirtyPieces.clear();
 
     if (list.isEmpty())
     {
@@ -878,18 +1220,14 @@ void VPattern::RefreshDirtyPieceGeometry(const QList<vidtype> &list)
         return;
     }
 
-    const bool combineTogether = VAbstractValApplication::VApp()->ValentinaSettings()->IsBoundaryTogetherWithNotches();
-    const bool pieceShowMainPath = VAbstractApplication::VApp()->Settings()->IsPieceShowMainPath();
+    const VToolSeamAllowanceRenderOptions options = VToolSeamAllowance::RenderOptions();
 
-    // Recompute every piece's geometry serially. The render pipeline reads shared VContainer data
-    // and evaluates formulas through qmuparser, neither of which is thread-safe, so the pieces must
-    // not be computed concurrently (doing so caused intermittent heap corruption on patterns with
-    // many pieces). The two-phase Prepare/Apply split is kept so the compute stays cleanly separated
-    // from the scene update, but both phases run on the GUI thread.
-    for (auto *piece : std::as_const(pieceTools))
-    {
-        piece->PrepareRefreshGeometry(combineTogether, pieceShowMainPath);
-    }
+    // Recompute the pieces' geometry concurrently. Each tool reads only its own copy of the container, which nobody
+    // modifies while we wait here, and every formula gets its own Calculator. Variables are read through the const
+    // interface only, so the shared variable objects stay untouched. The scene is updated afterwards on the GUI
+    // thread.
+    QtConcurrent::blockingMap(pieceTools,
+                              [options](VToolSeamAllowance *piece) -> void { piece->PrepareRefreshGeometry(options); });
 
     // Apply the precomputed geometry to the scene.
     for (auto *piece : std::as_const(pieceTools))
@@ -4274,6 +4612,15 @@ void VPattern::RefreshPieceGeometry()
     }
     else
     {
+        // Remember what waits for the refresh. An empty list means all pieces.
+        if (not m_pieceGeometryDirty)
+        {
+            m_dirtyPieces = ConvertToSet<vidtype>(updatePieces);
+        }
+        else if (not m_dirtyPieces.isEmpty())
+        {
+            updatePieces.isEmpty() ? m_dirtyPieces.clear() : m_dirtyPieces.unite(ConvertToSet<vidtype>(updatePieces));
+        }
         m_pieceGeometryDirty = true;
     }
 
@@ -4567,25 +4914,8 @@ void VPattern::ParseIncrementsElement(const QDomNode &node, const Document &pars
             if (const QDomElement domElement = domNode.toElement();
                 not domElement.isNull() && domElement.tagName() == TagIncrement)
             {
-                const QString name = GetParametrString(domElement, AttrName, QString()).simplified();
-                const QString desc = GetParametrEmptyString(domElement, AttrDescription);
-                const IncrementType type =
-                    StringToIncrementType(GetParametrString(domElement, AttrType, strTypeIncrement));
-                const QString formula = (type == IncrementType::Separator)
-                                            ? QChar('0')
-                                            : GetParametrString(domElement, AttrFormula, QChar('0'));
-                const bool specialUnits = GetParametrBool(domElement, AttrSpecialUnits, falseStr);
-
-                bool ok = false;
-                const qreal value = EvalFormula(data, formula, &ok);
-
-                auto *increment = new VIncrement(data, name, type);
-                increment->SetIndex(static_cast<quint32>(index++));
-                increment->SetFormula(value, formula, ok);
-                increment->SetDescription(desc);
-                increment->SetSpecialUnits(specialUnits);
-                increment->SetPreviewCalculation(node.toElement().tagName() == TagPreviewCalculations);
-                data->AddUniqueVariable(increment);
+                data->AddUniqueVariable(ParseIncrement(domElement, static_cast<quint32>(index++),
+                                                       node.toElement().tagName() == TagPreviewCalculations));
             }
         }
         domNode = domNode.nextSibling();
@@ -4597,6 +4927,35 @@ void VPattern::ParseIncrementsElement(const QDomNode &node, const Document &pars
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseIncrement parse increment tag.
+ * @param domElement tag in xml tree.
+ * @param index position in the table.
+ * @param previewCalculation true if the increment belongs to the preview calculations table.
+ * @return new increment. Caller takes ownership.
+ */
+auto VPattern::ParseIncrement(const QDomElement &domElement, quint32 index, bool previewCalculation) -> VIncrement *
+{
+    const QString name = GetParametrString(domElement, AttrName, QString()).simplified();
+    const QString desc = GetParametrEmptyString(domElement, AttrDescription);
+    const IncrementType type = StringToIncrementType(GetParametrString(domElement, AttrType, strTypeIncrement));
+    const QString formula =
+        (type == IncrementType::Separator) ? QChar('0') : GetParametrString(domElement, AttrFormula, QChar('0'));
+    const bool specialUnits = GetParametrBool(domElement, AttrSpecialUnits, falseStr);
+
+    bool ok = false;
+    const qreal value = EvalFormula(data, formula, &ok);
+
+    auto *increment = new VIncrement(data, name, type);
+    increment->SetIndex(index);
+    increment->SetFormula(value, formula, ok);
+    increment->SetDescription(desc);
+    increment->SetSpecialUnits(specialUnits);
+    increment->SetPreviewCalculation(previewCalculation);
+    return increment;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::AddEmptyIncrement(const QString &name, IncrementType type)
 {
@@ -29,6 +29,8 @@
 #ifndef VPATTERN_H
 #define VPATTERN_H
 
+#include <optional>
+
 #include "../ifc/xml/vabstractpattern.h"
 #include "../ifc/xml/vpatternconverter.h"
 #include "../vpatterndb/vcontainer.h"
@@ -38,6 +40,8 @@ class VNodeDetail;
 struct VToolSinglePointInitData;
 struct VToolLinePointInitData;
 class VToolSeamAllowance;
+class VMeasurement;
+class VIncrement;
 class QTimer;
 
 /**
@@ -115,11 +119,19 @@ public:
     void SetPieceGeometryDirty(bool newPieceGeometryDirty);
 
     void RefreshDirtyPieceGeometry(const QList<vidtype> &list);
+    auto DirtyPieces() const -> QList<vidtype>;
+
+    void IncrementalParseTree(const QMap<QString, QSharedPointer<VMeasurement>> &previous);
 
     void SetGBBackupFilePath(const QString &fileName);
 
 signals:
     void PreParseState();
+    /**
+     * @brief IncrementalUpdateFromFile emit after an incremental parse instead of FullUpdateFromFile. Only the tools
+     * that were recalculated are already updated.
+     */
+    void IncrementalUpdateFromFile();
 
 public slots:
     void LiteParseTree(const Document &parse) override;
@@ -149,6 +161,10 @@ private:
     QTimer *m_refreshGeometryTimer;
 
     bool m_pieceGeometryDirty{true};
+    /** @brief Pieces waiting for a geometry refresh while m_pieceGeometryDirty is set. Empty means all pieces. */
+    QSet<vidtype> m_dirtyPieces{};
+
+    bool m_incrementalParse{false};
 
     bool m_garbageCollected{false};
     QString m_garbageCollectBackupFilePath{};
@@ -181,6 +197,13 @@ private:
                                const QString &type);
     void ParsePathElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse);
     void ParseIncrementsElement(const QDomNode &node, const Document &parse);
+    auto ParseIncrement(const QDomElement &domElement, quint32 index, bool previewCalculation) -> VIncrement *;
+
+    auto RebindMeasurements(const QMap<QString, QSharedPointer<VMeasurement>> &previous)
+        -> std::optional<QSet<QString>>;
+    auto ReevaluateIncrements(QSet<QString> names) -> QSet<QString>;
+    auto ParseDependentElements(const QSet<QString> &names) -> QVector<vidtype>;
+    void LoadPatternBlockData(const QDomElement &drawElement);
 
     void PrepareForParse(const Document &parse);
     void ToolsCommonAttributes(const QDomElement &domElement, quint32 &id);
@@ -41,8 +41,14 @@
 #include "vparsererrorhandler.h"
 
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QGlobalStatic>
+#include <QMutex>
 #include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/framework/XMLGrammarPoolImpl.hpp>
 #include <xercesc/parsers/XercesDOMParser.hpp>
+#include <xercesc/util/PlatformUtils.hpp>
 #else
 #include <QAbstractMessageHandler>
 #include <QSourceLocation>
@@ -71,6 +77,7 @@
 #include <QVector>
 #include <QXmlStreamWriter>
 #include <QtDebug>
+#include <memory>
 
 #ifdef Q_OS_UNIX
 #include <fcntl.h>
@@ -81,6 +88,140 @@ using namespace Qt::Literals::StringLiterals;
 
 namespace
 {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+/**
+ * @brief The VSchemaGrammarCache class keeps compiled XSD grammars for the whole process.
+ *
+ * Each schema gets its own grammar pool. The pool is locked after the grammar is loaded. A locked pool is read only and
+ * can be shared by parsers in several threads. Pools must be released before XMLPlatformUtils::Terminate(), that's
+ * why they are cleared by QCoreApplication's destructor and not by the destructor of the cache.
+ */
+class VSchemaGrammarCache
+{
+public:
+    VSchemaGrammarCache() = default;
+    ~VSchemaGrammarCache() = default;
+
+    auto GrammarPool(const QString &schema, QString &error) -> XERCES_CPP_NAMESPACE::XMLGrammarPool *;
+    void Clear();
+
+private:
+    Q_DISABLE_COPY_MOVE(VSchemaGrammarCache) // NOLINT
+
+    QMutex m_mutex{};
+    QHash<QString, XERCES_CPP_NAMESPACE::XMLGrammarPool *> m_pools{};
+    bool m_cleanupRegistered{false};
+
+    static auto CacheKey(const QString &schema) -> QString;
+    static auto LoadGrammarPool(const QString &schema, QString &error) -> XERCES_CPP_NAMESPACE::XMLGrammarPool *;
+};
+
+Q_GLOBAL_STATIC(VSchemaGrammarCache, schemaGrammarCache) // NOLINT
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VSchemaGrammarCache::GrammarPool(const QString &schema, QString &error) -> XERCES_CPP_NAMESPACE::XMLGrammarPool *
+{
+    const QString key = CacheKey(schema);
+
+    QMutexLocker locker(&m_mutex);
+
+    if (auto pool = m_pools.constFind(key); pool != m_pools.constEnd())
+    {
+        return *pool;
+    }
+
+    XERCES_CPP_NAMESPACE::XMLGrammarPool *pool = LoadGrammarPool(schema, error);
+    if (pool == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (not m_cleanupRegistered)
+    {
+        qAddPostRoutine([]() { schemaGrammarCache->Clear(); });
+        m_cleanupRegistered = true;
+    }
+
+    m_pools.insert(key, pool);
+    return pool;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSchemaGrammarCache::Clear()
+{
+    QMutexLocker locker(&m_mutex);
+    qDeleteAll(m_pools);
+    m_pools.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VSchemaGrammarCache::CacheKey(const QString &schema) -> QString
+{
+    if (schema.startsWith(':'_L1))
+    {
+        return schema; // Schemas from resources never change
+    }
+
+    const QFileInfo info(schema);
+    return info.absoluteFilePath() + '@'_L1 + QString::number(info.lastModified().toMSecsSinceEpoch());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VSchemaGrammarCache::LoadGrammarPool(const QString &schema, QString &error)
+    -> XERCES_CPP_NAMESPACE::XMLGrammarPool *
+{
+    QFile fileSchema(schema);
+    if (not fileSchema.open(QIODevice::ReadOnly))
+    {
+        error = QCoreApplication::translate("VDomDocument", "Can't open schema file %1:\n%2.")
+                    .arg(schema, fileSchema.errorString());
+        return nullptr;
+    }
+
+    auto pool = std::make_unique<XERCES_CPP_NAMESPACE::XMLGrammarPoolImpl>(
+        XERCES_CPP_NAMESPACE::XMLPlatformUtils::fgMemoryManager);
+
+    {
+        VParserErrorHandler parserErrorHandler;
+
+        XERCES_CPP_NAMESPACE::XercesDOMParser domParser(nullptr, XERCES_CPP_NAMESPACE::XMLPlatformUtils::fgMemoryManager,
+                                                        pool.get());
+        domParser.setCreateEntityReferenceNodes(true);
+        domParser.setDisableDefaultEntityResolution(true);
+        domParser.setErrorHandler(&parserErrorHandler);
+
+        QByteArray const schemaFileData = fileSchema.readAll();
+        const char *schemaData = schemaFileData.constData();
+        const auto schemaSize = static_cast<size_t>(schemaFileData.size());
+
+        if (QScopedPointer<XERCES_CPP_NAMESPACE::InputSource> const grammarSource(
+                new XERCES_CPP_NAMESPACE::MemBufInputSource(reinterpret_cast<const XMLByte *>(schemaData),
+                                                            schemaSize,
+                                                            "schema"));
+            domParser.loadGrammar(*grammarSource, XERCES_CPP_NAMESPACE::Grammar::SchemaGrammarType, true) == nullptr)
+        {
+            error = parserErrorHandler.StatusMessage() + '\n'_L1
+                    + QCoreApplication::translate("VDomDocument", "Could not load schema file '%1'.")
+                          .arg(fileSchema.fileName());
+            return nullptr;
+        }
+
+        if (parserErrorHandler.HasError())
+        {
+            error = parserErrorHandler.StatusMessage() + '\n'_L1
+                    + QCoreApplication::translate("VDomDocument", "Schema file %3 invalid in line %1 column %2")
+                          .arg(parserErrorHandler.Line())
+                          .arg(parserErrorHandler.Column())
+                          .arg(fileSchema.fileName());
+            return nullptr;
+        }
+    } // The parser must be gone before the pool is locked
+
+    pool->lockPool();
+    return pool.release();
+}
+#endif // QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+
 //---------------------------------------------------------------------------------------------------------------------
 void SaveNodeCanonically(QXmlStreamWriter &stream, const QDomNode &domNode)
 {
@@ -861,53 +1002,31 @@ auto VDomDocument::SaveSchema() const -> QString
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-// ponytail: Xerces recompiles the grammar on every call. Load already validates per file open, so paying the same
-// cost on save (incl. autosave) is acceptable; cache the compiled grammar if large-pattern autosave latency bites.
+/**
+ * @brief ValidateXMLData validate data against XSD schema.
+ *
+ * With Xerces the compiled schema is taken from a process-wide cache, so only the first validation against a schema
+ * pays for compiling it. Safe to call from several threads.
+ */
 auto VDomDocument::ValidateXMLData(const QString &schema,
                                    const QByteArray &data,
                                    const QString &fileName,
                                    QString &error) -> bool
 {
-    QFile fileSchema(schema);
-    if (not fileSchema.open(QIODevice::ReadOnly))
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    XERCES_CPP_NAMESPACE::XMLGrammarPool *grammarPool = schemaGrammarCache->GrammarPool(schema, error);
+    if (grammarPool == nullptr)
     {
-        error = tr("Can't open schema file %1:\n%2.").arg(schema, fileSchema.errorString());
         return false;
     }
 
     VParserErrorHandler parserErrorHandler;
 
-#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-    XERCES_CPP_NAMESPACE::XercesDOMParser domParser;
+    XERCES_CPP_NAMESPACE::XercesDOMParser domParser(nullptr, XERCES_CPP_NAMESPACE::XMLPlatformUtils::fgMemoryManager,
+                                                    grammarPool);
     domParser.setCreateEntityReferenceNodes(true);
     domParser.setDisableDefaultEntityResolution(true);
     domParser.setErrorHandler(&parserErrorHandler);
-
-    QByteArray const schemaFileData = fileSchema.readAll();
-    const char *schemaData = schemaFileData.constData();
-    const auto schemaSize = static_cast<size_t>(schemaFileData.size());
-
-    if (QScopedPointer<XERCES_CPP_NAMESPACE::InputSource> const grammarSource(
-            new XERCES_CPP_NAMESPACE::MemBufInputSource(reinterpret_cast<const XMLByte *>(schemaData),
-                                                        schemaSize,
-                                                        "schema"));
-        domParser.loadGrammar(*grammarSource, XERCES_CPP_NAMESPACE::Grammar::SchemaGrammarType, true) == nullptr)
-    {
-        error = parserErrorHandler.StatusMessage() + '\n'_L1
-                + tr("Could not load schema file '%1'.").arg(fileSchema.fileName());
-        return false;
-    }
-
-    if (parserErrorHandler.HasError())
-    {
-        error = parserErrorHandler.StatusMessage() + '\n'_L1
-                + tr("Schema file %3 invalid in line %1 column %2")
-                      .arg(parserErrorHandler.Line())
-                      .arg(parserErrorHandler.Column())
-                      .arg(fileSchema.fileName());
-        return false;
-    }
-
     domParser.setValidationScheme(XERCES_CPP_NAMESPACE::XercesDOMParser::Val_Always);
     domParser.setDoNamespaces(true);
     domParser.setDoSchema(true);
@@ -935,6 +1054,15 @@ auto VDomDocument::ValidateXMLData(const QString &schema,
         return false;
     }
 #else
+    QFile fileSchema(schema);
+    if (not fileSchema.open(QIODevice::ReadOnly))
+    {
+        error = tr("Can't open schema file %1:\n%2.").arg(schema, fileSchema.errorString());
+        return false;
+    }
+
+    VParserErrorHandler parserErrorHandler;
+
     QXmlSchema sch;
     sch.setMessageHandler(&parserErrorHandler);
     if (sch.load(&fileSchema, QUrl::fromLocalFile(fileSchema.fileName())) == false)
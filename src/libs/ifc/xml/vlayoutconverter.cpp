@@ -200,6 +200,7 @@ void VLayoutConverter::ApplyPatches()
         case FormatVersion(0, 2, 0):
         case FormatVersion(0, 2, 1):
             ToV0_2_2();
+            Save();
             ValidateXML(CurrentSchema);
             Q_FALLTHROUGH();
         case FormatVersion(0, 2, 2):
@@ -416,7 +417,6 @@ void VLayoutConverter::ToV0_1_3()
 
     ConvertPiecesToV0_1_3();
     SetVersion(QStringLiteral("0.1.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -426,7 +426,6 @@ void VLayoutConverter::ToV0_1_5()
     Q_STATIC_ASSERT_X(VLayoutConverter::LayoutMinVer < FormatVersion(0, 1, 5), "Time to refactor the code.");
     ConvertPiecesToV0_1_5();
     SetVersion(QStringLiteral("0.1.5"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -437,7 +436,6 @@ void VLayoutConverter::ToV0_1_7()
 
     ConvertPiecesToV0_1_7();
     SetVersion(QStringLiteral("0.1.7"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -447,5 +445,4 @@ void VLayoutConverter::ToV0_2_2()
     Q_STATIC_ASSERT_X(VLayoutConverter::LayoutMinVer < FormatVersion(0, 2, 2), "Time to refactor the code.");
 
     SetVersion(QStringLiteral("0.2.2"));
-    Save();
 }
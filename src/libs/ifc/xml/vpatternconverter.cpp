@@ -682,6 +682,7 @@ void VPatternConverter::ApplyPatches()
         case FormatVersion(1, 1, 2):
         case FormatVersion(1, 1, 3):
             ToV1_2_0();
+            Save();
             ValidateXML(CurrentSchema);
             Q_FALLTHROUGH();
         case FormatVersion(1, 2, 0):
@@ -735,7 +736,6 @@ void VPatternConverter::ToV0_2_0()
     TagIncrementToV0_2_0();
     ConvertMeasurementsToV0_2_0();
     TagMeasurementsToV0_2_0(); // Alwayse last!!!
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -746,7 +746,6 @@ void VPatternConverter::ToV0_2_1()
 
     SetVersion(QStringLiteral("0.2.1"));
     ConvertMeasurementsToV0_2_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -757,7 +756,6 @@ void VPatternConverter::ToV0_2_4()
 
     FixToolUnionToV0_2_4();
     SetVersion(QStringLiteral("0.2.4"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -770,7 +768,6 @@ void VPatternConverter::ToV0_3_0()
     FixCutPoint();
     FixCutPoint();
     SetVersion(QStringLiteral("0.3.0"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -781,7 +778,6 @@ void VPatternConverter::ToV0_3_1()
 
     SetVersion(QStringLiteral("0.3.1"));
     RemoveColorToolCutV0_3_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -794,7 +790,6 @@ void VPatternConverter::ToV0_4_0()
     TagRemoveAttributeTypeObjectInV0_4_0();
     TagDetailToV0_4_0();
     TagUnionDetailsToV0_4_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -806,7 +801,6 @@ void VPatternConverter::ToV0_4_4()
     SetVersion(QStringLiteral("0.4.4"));
     LabelTagToV0_4_4(*strData);
     LabelTagToV0_4_4(*strPatternInfo);
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -819,7 +813,6 @@ void VPatternConverter::ToV0_6_0()
     PortPatternLabeltoV0_6_0(label);
     PortPieceLabelstoV0_6_0();
     RemoveUnusedTagsV0_6_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -829,7 +822,6 @@ void VPatternConverter::ToV0_6_2()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < FormatVersion(0, 6, 2), "Time to refactor the code.");
     SetVersion(QStringLiteral("0.6.2"));
     AddTagPreviewCalculationsV0_6_2();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -840,7 +832,6 @@ void VPatternConverter::ToV0_8_8()
     SetVersion(QStringLiteral("0.8.8"));
     RemoveGradationV0_8_8();
     AddPieceUUIDV0_8_8();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -852,7 +843,6 @@ void VPatternConverter::ToV0_9_0()
     ConvertImageToV0_9_0();
 
     SetVersion(QStringLiteral("0.9.0"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -863,7 +853,6 @@ void VPatternConverter::ToV0_9_1()
 
     ConvertMeasurementsPathToV0_9_1();
     SetVersion(QStringLiteral("0.9.1"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -874,7 +863,6 @@ void VPatternConverter::ToV0_9_2()
 
     ConvertPathAttributesToV0_9_2();
     SetVersion(QStringLiteral("0.9.2"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -886,7 +874,6 @@ void VPatternConverter::ToV0_9_6()
     ConvertGrainlineToV0_9_6();
 
     SetVersion(QStringLiteral("0.9.6"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -898,7 +885,6 @@ void VPatternConverter::ToV0_9_7()
     ConvertMirrorLineToV0_9_7();
 
     SetVersion(QStringLiteral("0.9.7"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -910,7 +896,6 @@ void VPatternConverter::ToV1_1_0()
     RemoveInUseAttributeV1_1_0();
 
     SetVersion(QStringLiteral("1.1.0"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -922,7 +907,6 @@ void VPatternConverter::ToV1_2_0()
     ExplicitSegmentIdsV1_2_0();
 
     SetVersion(QStringLiteral("1.2.0"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -134,6 +134,7 @@ void VVITConverter::ApplyPatches()
             Q_FALLTHROUGH();
         case FormatVersion(0, 6, 1):
             ToV0_6_2();
+            Save();
             ValidateXML(CurrentSchema);
             Q_FALLTHROUGH();
         case FormatVersion(0, 6, 2):
@@ -374,7 +375,6 @@ void VVITConverter::ToV0_3_0()
     SetVersion(QStringLiteral("0.3.0"));
     AddNewTagsForV0_3_0();
     ConvertMeasurementsToV0_3_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -385,7 +385,6 @@ void VVITConverter::ToV0_3_1()
 
     SetVersion(QStringLiteral("0.3.1"));
     GenderV0_3_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -396,7 +395,6 @@ void VVITConverter::ToV0_3_2()
 
     SetVersion(QStringLiteral("0.3.2"));
     PM_SystemV0_3_2();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -407,7 +405,6 @@ void VVITConverter::ToV0_3_3()
 
     SetVersion(QStringLiteral("0.3.3"));
     ConvertMeasurementsToV0_3_3();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -418,7 +415,6 @@ void VVITConverter::ToV0_4_0()
 
     SetVersion(QStringLiteral("0.4.0"));
     ConvertCustomerNameToV0_4_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -429,7 +425,6 @@ void VVITConverter::ToV0_6_1()
 
     SetVersion(QStringLiteral("0.6.1"));
     ConvertPMSystemToV0_6_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -439,5 +434,4 @@ void VVITConverter::ToV0_6_2()
     Q_STATIC_ASSERT_X(VVITConverter::MeasurementMinVer < FormatVersion(0, 6, 2), "Time to refactor the code.");
 
     SetVersion(QStringLiteral("0.6.2"));
-    Save();
 }
@@ -136,6 +136,7 @@ void VVSTConverter::ApplyPatches()
             Q_FALLTHROUGH();
         case FormatVersion(0, 6, 1):
             ToV0_6_2();
+            Save();
             ValidateXML(CurrentSchema);
             Q_FALLTHROUGH();
         case FormatVersion(0, 6, 2):
@@ -460,7 +461,6 @@ void VVSTConverter::ToV0_4_0()
     AddNewTagsForV0_4_0();
     RemoveTagsForV0_4_0();
     ConvertMeasurementsToV0_4_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -471,7 +471,6 @@ void VVSTConverter::ToV0_4_1()
 
     SetVersion(QStringLiteral("0.4.1"));
     PM_SystemV0_4_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -482,7 +481,6 @@ void VVSTConverter::ToV0_4_2()
 
     SetVersion(QStringLiteral("0.4.2"));
     ConvertMeasurementsToV0_4_2();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -495,7 +493,6 @@ void VVSTConverter::ToV0_5_0()
     AddNewTagsForV0_5_0();
     RemoveTagsForV0_5_0();
     ConvertMeasurementsToV0_5_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -506,7 +503,6 @@ void VVSTConverter::ToV0_5_4()
 
     SetVersion(QStringLiteral("0.5.4"));
     ConvertCircumferenceAttreibuteToV0_5_4();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -517,7 +513,6 @@ void VVSTConverter::ToV0_6_1()
 
     SetVersion(QStringLiteral("0.6.1"));
     ConvertPMSystemToV0_6_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -527,5 +522,4 @@ void VVSTConverter::ToV0_6_2()
     Q_STATIC_ASSERT_X(VVSTConverter::MeasurementMinVer < FormatVersion(0, 6, 2), "Time to refactor the code.");
 
     SetVersion(QStringLiteral("0.6.2"));
-    Save();
 }
@@ -138,12 +138,28 @@ void dx_iface::writeBlocks()
         for (auto it = bk->ent.begin(); it != bk->ent.end(); ++it)
             writeEntity(*it);
     }
+
+    if (!blockProducer)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < producedBlocks.size(); ++i)
+    {
+        const std::unique_ptr<dx_ifaceBlock> bk = blockProducer(i);
+        dxfW->writeBlock(bk.get());
+        for (auto *e : bk->ent)
+            writeEntity(e);
+    }
 }
 
 void dx_iface::writeBlockRecords()
 {
     for (auto it = cData.blocks.begin(); it != cData.blocks.end(); ++it)
         dxfW->writeBlockRecord((*it)->name);
+
+    for (const auto &name : producedBlocks)
+        dxfW->writeBlockRecord(name);
 }
 
 void dx_iface::writeEntities()
@@ -511,6 +527,14 @@ void dx_iface::AddBlock(dx_ifaceBlock *block)
     cData.blocks.push_back(block);
 }
 
+void dx_iface::SetBlockProducer(const std::vector<std::string> &names, const BlockProducer &producer)
+{
+    // Block records are written before blocks, so names must be known in advance. The producer must return blocks with
+    // the same names in the same order.
+    producedBlocks = names;
+    blockProducer = producer;
+}
+
 auto dx_iface::LocaleToISO() -> std::string
 {
     QMap<QString, QString> const locMap = LocaleMap();
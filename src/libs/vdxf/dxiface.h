@@ -17,6 +17,9 @@
 #include "libdxfrw/libdxfrw.h"
 
 #include <Qt>
+#include <functional>
+#include <memory>
+#include <vector>
 
 class QFont;
 
@@ -107,6 +110,8 @@ private:
 class dx_iface final : public DRW_Interface
 {
 public:
+    using BlockProducer = std::function<std::unique_ptr<dx_ifaceBlock>(std::size_t index)>;
+
     dx_iface(const std::string &file, DRW::Version v, VarMeasurement varMeasurement, VarInsunits varInsunits);
     virtual ~dx_iface();
     auto fileExport(bool binary) -> bool;
@@ -135,6 +140,8 @@ public:
     void AddEntity(DRW_Entity *e);
     auto AddFont(const QFont &f) -> UTF8STRING;
     void AddBlock(dx_ifaceBlock *block);
+    // blocks made on demand while writing, each one is released right after it was written
+    void SetBlockProducer(const std::vector<std::string> &names, const BlockProducer &producer);
 
     static auto QtPenStyleToString(Qt::PenStyle style) -> UTF8STRING;
 
@@ -150,6 +157,8 @@ private:
     dxfRW *dxfW;                  // pointer to writer, needed to send data
     dx_data cData;                // class to store or read data
     DRW::Version version;
+    std::vector<std::string> producedBlocks{};
+    BlockProducer blockProducer{};
 
     void InitHeader(VarMeasurement varMeasurement, VarInsunits varInsunits);
     void InitTextstyles();
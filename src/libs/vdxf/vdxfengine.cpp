@@ -35,6 +35,8 @@
 #include <QFlag>
 #include <QFlags>
 #include <QFont>
+#include <QFontMetrics>
+#include <QFuture>
 #include <QLineF>
 #include <QList>
 #include <QLoggingCategory>
@@ -43,7 +45,9 @@
 #include <QPainterPath>
 #include <QPen>
 #include <QPolygonF>
+#include <QScopeGuard>
 #include <QTextItem>
+#include <QtConcurrent>
 #include <QtDebug>
 #include <QtMath>
 #include <memory>
@@ -121,11 +125,11 @@ Q_GLOBAL_STATIC_WITH_ARGS(const UTF8STRING, layer87, (UTF8STRING("87"))) // NOLI
 QT_WARNING_POP
 
 //---------------------------------------------------------------------------------------------------------------------
-inline auto LineFont(const TextLine &tl, const QFont &base) -> QFont
+inline auto LineFont(const TextLine &tl, const QFont &base, bool singleStrokeOutlineFont) -> QFont
 {
     QFont fnt = base;
     fnt.setPointSize(qMax(base.pointSize() + tl.iFontSize, 1));
-    if (!VAbstractApplication::VApp()->Settings()->GetSingleStrokeOutlineFont())
+    if (!singleStrokeOutlineFont)
     {
         fnt.setBold(tl.bold);
     }
@@ -691,6 +695,23 @@ auto VDxfEngine::IsBoundaryTogetherWithNotches() const -> bool
     return m_togetherWithNotches;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStreamBlocks controls how AAMA and ASTM piece blocks are written. Streamed blocks are made on demand while
+ * writing. Otherwise all blocks are collected in memory first. The output is the same.
+ */
+void VDxfEngine::SetStreamBlocks(bool value)
+{
+    Q_ASSERT(not isActive());
+    m_streamBlocks = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VDxfEngine::IsStreamBlocks() const -> bool
+{
+    return m_streamBlocks;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VDxfEngine::DxfApparelCompatibility() const -> DXFApparelCompatibility
 {
@@ -742,31 +763,45 @@ auto VDxfEngine::ToPixel(double val, const VarInsunits &unit) const -> double
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VDxfEngine::ExportToAAMA(const QVector<VLayoutPiece> &details) -> bool
+/**
+ * @brief ExportPieceBlocks streams a block per piece to the output file.
+ *
+ * Unless streaming is disabled, blocks are not collected in memory. The writer asks for each block when it reaches the
+ * blocks section and releases it right after. The next block is prepared in a worker thread while the current one is
+ * written, so no more than two blocks exist at a time.
+ * @param details pieces.
+ * @param blockFlags flags of each piece block.
+ * @param exporter fills a piece block with entities. Called from a worker thread.
+ * @return true if success.
+ */
+auto VDxfEngine::ExportPieceBlocks(const QVector<VLayoutPiece> &details, int blockFlags,
+                                   const PieceBlockExporter &exporter) -> bool
 {
-    if (not m_size.isValid())
-    {
-        qCWarning(vDxf) << qUtf8Printable("VDxfEngine::ExportToAAMA(), size is not valid"_L1);
-        return false;
-    }
+    // Blocks are made in a worker thread, read settings here
+    m_singleStrokeOutlineFont = VAbstractApplication::VApp()->Settings()->GetSingleStrokeOutlineFont();
 
-    m_input = QSharedPointer<dx_iface>::create(m_fileName.toUtf8().toStdString(),
-                                               m_version,
-                                               m_varMeasurement,
-                                               m_varInsunits);
-    m_input->AddXSpaceBlock(false);
-    m_input->AddAAMAHeaderData();
-    if (m_version > DRW::AC1009)
+    std::vector<std::string> names;
+    names.reserve(static_cast<std::size_t>(details.size()));
+
+    for (auto detail : details)
     {
-        m_input->AddDefLayers();
-    }
-    m_input->AddAAMALayers();
+        const std::string name = PieceBlockName(detail).toStdString();
+        names.push_back(name);
 
-    ExportStyleSystemText(m_input, details);
+        // Text styles are written before blocks, fonts must be known before any block is made
+        detail.Scale(m_xscale, m_yscale);
+        RegisterPieceFonts(detail);
 
-    for (auto detail : details)
+        auto insert = std::make_unique<DRW_Insert>();
+        insert->name = name;
+        insert->layer = *layer1;
+
+        m_input->AddEntity(insert.release());
+    }
+
+    auto MakeBlock = [this, &details, &names, blockFlags, &exporter](std::size_t index) -> dx_ifaceBlock *
     {
-        // Use custom deleter function to lose ownership after adding the block
+        // Use custom deleter function to lose ownership after the block is ready
         bool deleteBlock = true;
         auto NoOpDeleter = [&deleteBlock](dx_ifaceBlock *block)
         {
@@ -777,40 +812,139 @@ auto VDxfEngine::ExportToAAMA(const QVector<VLayoutPiece> &details) -> bool
         };
 
         auto detailBlock = QSharedPointer<dx_ifaceBlock>(new dx_ifaceBlock, NoOpDeleter);
+        detailBlock->name = names.at(index);
+        detailBlock->flags = blockFlags;
+        detailBlock->layer = *layer1;
+
+        VLayoutPiece detail = details.at(static_cast<vsizetype>(index));
+        detail.Scale(m_xscale, m_yscale);
+
+        exporter(detailBlock, detail);
 
-        QString blockName = detail.GetName();
-        if (m_version <= DRW::AC1009)
+        deleteBlock = false; // lose ownership
+        return detailBlock.data();
+    };
+
+    if (not m_streamBlocks)
+    {
+        for (std::size_t i = 0; i < names.size(); ++i)
         {
-            blockName.replace(' '_L1, '_'_L1);
+            m_input->AddBlock(MakeBlock(i));
         }
 
-        detailBlock->name = blockName.toStdString();
-        detailBlock->flags = 64;
-        detailBlock->layer = *layer1;
+        return m_input->fileExport(m_binary);
+    }
 
-        detail.Scale(m_xscale, m_yscale);
+    QFuture<dx_ifaceBlock *> next;
+    bool prefetched = false;
 
-        ExportAAMAOutline(detailBlock, detail);
-        ExportAAMADraw(detailBlock, detail);
-        ExportAAMAIntcut(detailBlock, detail);
-        ExportAAMANotch(detailBlock, detail);
-        ExportAAMAGrainline(detailBlock, detail);
-        ExportPieceText(detailBlock, detail);
-        ExportAAMADrill(detailBlock, detail);
-        ExportAnnotationText(detailBlock, detail, *layer19);
+    // Never leave the worker running with references to this frame
+    auto WaitNext = qScopeGuard(
+        [&next, &prefetched]()
+        {
+            if (prefetched)
+            {
+                next.waitForFinished();
+                delete next.result();
+            }
+        });
 
-        m_input->AddBlock(detailBlock.data());
+    m_input->SetBlockProducer(
+        names,
+        [&next, &prefetched, &names, MakeBlock](std::size_t index) -> std::unique_ptr<dx_ifaceBlock>
+        {
+            std::unique_ptr<dx_ifaceBlock> block;
+            if (prefetched)
+            {
+                prefetched = false;
+                block.reset(next.result());
+            }
+            else
+            {
+                block.reset(MakeBlock(index));
+            }
 
-        auto insert = std::make_unique<DRW_Insert>();
-        insert->name = blockName.toStdString();
-        insert->layer = *layer1;
+            if (index + 1 < names.size())
+            {
+                next = QtConcurrent::run([MakeBlock, index]() { return MakeBlock(index + 1); });
+                prefetched = true;
+            }
 
-        m_input->AddEntity(insert.release());
+            return block;
+        });
 
-        deleteBlock = false; // lose ownership
+    const bool res = m_input->fileExport(m_binary);
+    m_input->SetBlockProducer({}, {});
+    return res;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VDxfEngine::PieceBlockName(const VLayoutPiece &detail) const -> QString
+{
+    QString blockName = detail.GetName();
+    if (m_version <= DRW::AC1009)
+    {
+        blockName.replace(' '_L1, '_'_L1);
     }
+    return blockName;
+}
 
-    return m_input->fileExport(m_binary);
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RegisterPieceFonts adds text styles for all labels of a scaled piece in the order the block export uses them.
+ * @param detail scaled piece.
+ */
+void VDxfEngine::RegisterPieceFonts(const VLayoutPiece &detail)
+{
+    if (QVector<QPointF> const labelShape = detail.GetPieceLabelRect(); labelShape.count() == 4)
+    {
+        PieceTextLines(detail, labelShape,
+                       [this](const QString &, const QFont &fnt, const QFontMetrics &, const QTransform &)
+                       { m_input->AddFont(fnt); });
+    }
+
+    bool ok = false;
+    if (FoldLabelPosData const labelData = detail.FoldLine().LabelPosition(ok); ok)
+    {
+        m_input->AddFont(labelData.font);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VDxfEngine::ExportToAAMA(const QVector<VLayoutPiece> &details) -> bool
+{
+    if (not m_size.isValid())
+    {
+        qCWarning(vDxf) << qUtf8Printable("VDxfEngine::ExportToAAMA(), size is not valid"_L1);
+        return false;
+    }
+
+    m_input = QSharedPointer<dx_iface>::create(m_fileName.toUtf8().toStdString(),
+                                               m_version,
+                                               m_varMeasurement,
+                                               m_varInsunits);
+    m_input->AddXSpaceBlock(false);
+    m_input->AddAAMAHeaderData();
+    if (m_version > DRW::AC1009)
+    {
+        m_input->AddDefLayers();
+    }
+    m_input->AddAAMALayers();
+
+    ExportStyleSystemText(m_input, details);
+
+    return ExportPieceBlocks(details, 64,
+                             [this](const QSharedPointer<dx_ifaceBlock> &detailBlock, const VLayoutPiece &detail)
+                             {
+                                 ExportAAMAOutline(detailBlock, detail);
+                                 ExportAAMADraw(detailBlock, detail);
+                                 ExportAAMAIntcut(detailBlock, detail);
+                                 ExportAAMANotch(detailBlock, detail);
+                                 ExportAAMAGrainline(detailBlock, detail);
+                                 ExportPieceText(detailBlock, detail);
+                                 ExportAAMADrill(detailBlock, detail);
+                                 ExportAnnotationText(detailBlock, detail, *layer19);
+                             });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1057,6 +1191,62 @@ void VDxfEngine::ExportPieceText(const QSharedPointer<dx_ifaceBlock> &detailBloc
         CheckLabelCompatibilityRPCADV09(detail);
     }
 
+    const qreal scale = qMin(detail.GetXScale(), detail.GetYScale());
+    const qreal angle = QLineF(labelShape.at(0), labelShape.at(1)).angle();
+
+    PieceTextLines(
+        detail, labelShape,
+        [this, &detailBlock, &detail, scale, angle](const QString &text, const QFont &fnt, const QFontMetrics &fm,
+                                                    const QTransform &lineMatrix)
+        {
+            QPointF const pos = lineMatrix.map(QPointF());
+
+            auto *textLine = new DRW_Text();
+            textLine->basePoint = DRW_Coord(FromPixel(pos.x(), m_varInsunits),
+                                            FromPixel(GetSize().height() - pos.y(), m_varInsunits), 0);
+            textLine->secPoint = DRW_Coord(FromPixel(pos.x(), m_varInsunits),
+                                           FromPixel(GetSize().height() - pos.y(), m_varInsunits), 0);
+            textLine->height = FromPixel(fm.ascent() * scale / 2, m_varInsunits);
+            textLine->layer = *layer1;
+            textLine->text = text.toStdString();
+            textLine->style = m_input->AddFont(fnt);
+
+            QLineF string(0, 0, 100, 0);
+            string.setAngle(angle);
+            string = lineMatrix.map(string);
+            const qreal labelAngle = string.angle();
+
+            if (detail.IsVerticallyFlipped() && detail.IsHorizontallyFlipped())
+            {
+                textLine->angle = labelAngle + 180;
+            }
+            else if (detail.IsVerticallyFlipped())
+            {
+                textLine->angle = -labelAngle;
+            }
+            else if (detail.IsHorizontallyFlipped())
+            {
+                textLine->angle = -labelAngle - 180;
+            }
+            else
+            {
+                textLine->angle = labelAngle;
+            }
+
+            detailBlock->ent.push_back(textLine);
+        });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PieceTextLines lays out lines of the piece label that fit the label shape.
+ * @param detail piece.
+ * @param labelShape piece label rect, four points.
+ * @param handler called for each line with its font, metrics and placement matrix.
+ */
+void VDxfEngine::PieceTextLines(const VLayoutPiece &detail, const QVector<QPointF> &labelShape,
+                                const PieceTextLineHandler &handler) const
+{
     const qreal scale = qMin(detail.GetXScale(), detail.GetYScale());
     const qreal dW = QLineF(labelShape.at(0), labelShape.at(1)).length();
     const qreal dH = QLineF(labelShape.at(1), labelShape.at(2)).length();
@@ -1068,7 +1258,7 @@ void VDxfEngine::ExportPieceText(const QSharedPointer<dx_ifaceBlock> &detailBloc
 
     for (const auto &tl : labelLines)
     {
-        const QFont fnt = LineFont(tl, tm.GetFont());
+        const QFont fnt = LineFont(tl, tm.GetFont(), m_singleStrokeOutlineFont);
         QFontMetrics const fm(fnt);
 
         if (dY + fm.height() * scale / 2 > dH)
@@ -1079,43 +1269,7 @@ void VDxfEngine::ExportPieceText(const QSharedPointer<dx_ifaceBlock> &detailBloc
         dY += fm.height() * scale / 2;
 
         const qreal dX = LineAlign(tl, tl.qsText, fm, dW);
-        QTransform const lineMatrix = detail.LineMatrix(labelShape.at(0), angle, QPointF(dX, dY), dW);
-
-        QPointF const pos = lineMatrix.map(QPointF());
-
-        auto *textLine = new DRW_Text();
-        textLine->basePoint =
-            DRW_Coord(FromPixel(pos.x(), m_varInsunits), FromPixel(GetSize().height() - pos.y(), m_varInsunits), 0);
-        textLine->secPoint =
-            DRW_Coord(FromPixel(pos.x(), m_varInsunits), FromPixel(GetSize().height() - pos.y(), m_varInsunits), 0);
-        textLine->height = FromPixel(fm.ascent() * scale / 2, m_varInsunits);
-        textLine->layer = *layer1;
-        textLine->text = tl.qsText.toStdString();
-        textLine->style = m_input->AddFont(fnt);
-
-        QLineF string(0, 0, 100, 0);
-        string.setAngle(angle);
-        string = lineMatrix.map(string);
-        const qreal labelAngle = string.angle();
-
-        if (detail.IsVerticallyFlipped() && detail.IsHorizontallyFlipped())
-        {
-            textLine->angle = labelAngle + 180;
-        }
-        else if (detail.IsVerticallyFlipped())
-        {
-            textLine->angle = -labelAngle;
-        }
-        else if (detail.IsHorizontallyFlipped())
-        {
-            textLine->angle = -labelAngle - 180;
-        }
-        else
-        {
-            textLine->angle = labelAngle;
-        }
-
-        detailBlock->ent.push_back(textLine);
+        handler(tl.qsText, fnt, fm, detail.LineMatrix(labelShape.at(0), angle, QPointF(dX, dY), dW));
 
         dY += MmToPixel(1.5);
     }
@@ -1285,56 +1439,23 @@ auto VDxfEngine::ExportToASTM(const QVector<VLayoutPiece> &details) -> bool
 
     ExportStyleSystemText(m_input, details);
 
-    for (auto detail : details)
-    {
-        // Use custom deleter function to lose ownership after adding the block
-        bool deleteBlock = true;
-        auto NoOpDeleter = [&deleteBlock](dx_ifaceBlock *block)
-        {
-            if (deleteBlock)
-            {
-                delete block;
-            }
-        };
-        auto detailBlock = QSharedPointer<dx_ifaceBlock>(new dx_ifaceBlock, NoOpDeleter);
-
-        QString blockName = detail.GetName();
-        if (m_version <= DRW::AC1009)
-        {
-            blockName.replace(' '_L1, '_'_L1);
-        }
-
-        detailBlock->name = blockName.toStdString();
-        detailBlock->layer = *layer1;
-
-        detail.Scale(m_xscale, m_yscale);
-
-        ExportASTMPieceBoundary(detailBlock, detail);
-        ExportASTMSewLine(detailBlock, detail);
-        ExportASTMDrawInternalPaths(detailBlock, detail);
-        ExportASTMDrawPlaceLabels(detailBlock, detail);
-        ExportASTMInternalCutout(detailBlock, detail);
-        ExportASTMNotches(detailBlock, detail);
-        ExportAAMAGrainline(detailBlock, detail);
-        ExportPieceText(detailBlock, detail);
-        ExportASTMDrill(detailBlock, detail);
-        ExportASTMAnnotationText(detailBlock, detail);
-        ExportASTMMirrorLine(detailBlock, detail);
-        ExportASTMDrawFoldLine(detailBlock, detail);
-        ExportAnnotationText(detailBlock, detail, *layer15);
-
-        m_input->AddBlock(detailBlock.data());
-
-        auto insert = std::make_unique<DRW_Insert>();
-        insert->name = blockName.toStdString();
-        insert->layer = *layer1;
-
-        m_input->AddEntity(insert.release());
-
-        deleteBlock = false; // lose ownership
-    }
-
-    return m_input->fileExport(m_binary);
+    return ExportPieceBlocks(details, 0,
+                             [this](const QSharedPointer<dx_ifaceBlock> &detailBlock, const VLayoutPiece &detail)
+                             {
+                                 ExportASTMPieceBoundary(detailBlock, detail);
+                                 ExportASTMSewLine(detailBlock, detail);
+                                 ExportASTMDrawInternalPaths(detailBlock, detail);
+                                 ExportASTMDrawPlaceLabels(detailBlock, detail);
+                                 ExportASTMInternalCutout(detailBlock, detail);
+                                 ExportASTMNotches(detailBlock, detail);
+                                 ExportAAMAGrainline(detailBlock, detail);
+                                 ExportPieceText(detailBlock, detail);
+                                 ExportASTMDrill(detailBlock, detail);
+                                 ExportASTMAnnotationText(detailBlock, detail);
+                                 ExportASTMMirrorLine(detailBlock, detail);
+                                 ExportASTMDrawFoldLine(detailBlock, detail);
+                                 ExportAnnotationText(detailBlock, detail, *layer15);
+                             });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -35,6 +35,7 @@
 #include <QSize>
 #include <QString>
 #include <QtGlobal>
+#include <functional>
 #include <string>
 
 #include "../vmisc/def.h"
@@ -54,6 +55,8 @@ class DRW_ASTMNotch;
 struct VLayoutPassmark;
 class DRW_ATTDEF;
 class DRW_Circle;
+class QFont;
+class QFontMetrics;
 
 class VDxfEngine final : public QPaintEngine
 {
@@ -114,6 +117,9 @@ public:
     auto DxfApparelCompatibility() const -> DXFApparelCompatibility;
     void SetDxfApparelCompatibility(DXFApparelCompatibility mode);
 
+    void SetStreamBlocks(bool value);
+    auto IsStreamBlocks() const -> bool;
+
     auto ErrorString() const -> QString;
 
 private:
@@ -133,10 +139,23 @@ private:
     qreal m_yscale{1};
     bool m_togetherWithNotches{false};
     DXFApparelCompatibility m_compatibilityMode{DXFApparelCompatibility::STANDARD};
+    bool m_streamBlocks{true};
+    bool m_singleStrokeOutlineFont{false};
 
     Q_REQUIRED_RESULT auto FromPixel(double pix, const VarInsunits &unit) const -> double;
     Q_REQUIRED_RESULT auto ToPixel(double val, const VarInsunits &unit) const -> double;
 
+    using PieceBlockExporter = std::function<void(const QSharedPointer<dx_ifaceBlock> &, const VLayoutPiece &)>;
+    using PieceTextLineHandler =
+        std::function<void(const QString &text, const QFont &font, const QFontMetrics &fm, const QTransform &matrix)>;
+
+    auto ExportPieceBlocks(const QVector<VLayoutPiece> &details, int blockFlags, const PieceBlockExporter &exporter)
+        -> bool;
+    auto PieceBlockName(const VLayoutPiece &detail) const -> QString;
+    void RegisterPieceFonts(const VLayoutPiece &detail);
+    void PieceTextLines(const VLayoutPiece &detail, const QVector<QPointF> &labelShape,
+                        const PieceTextLineHandler &handler) const;
+
     auto ExportToAAMA(const QVector<VLayoutPiece> &details) -> bool;
     void ExportAAMAOutline(const QSharedPointer<dx_ifaceBlock> &detailBlock, const VLayoutPiece &detail);
     void ExportAAMADraw(const QSharedPointer<dx_ifaceBlock> &detailBlock, const VLayoutPiece &detail);
@@ -232,6 +232,23 @@ void VDxfPaintDevice::SetDxfApparelCompatibility(DXFApparelCompatibility mode)
     m_engine->SetDxfApparelCompatibility(mode);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VDxfPaintDevice::SetStreamBlocks(bool value)
+{
+    if (m_engine->isActive())
+    {
+        qWarning("VDxfPaintDevice::SetStreamBlocks(), cannot set streaming of blocks while Dxf is being generated");
+        return;
+    }
+    m_engine->SetStreamBlocks(value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VDxfPaintDevice::IsStreamBlocks() const -> bool
+{
+    return m_engine->IsStreamBlocks();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VDxfPaintDevice::ExportToAAMA(const QVector<VLayoutPiece> &details) const -> bool
 {
@@ -78,6 +78,9 @@ public:
     auto DxfApparelCompatibility() const -> DXFApparelCompatibility;
     void SetDxfApparelCompatibility(DXFApparelCompatibility mode);
 
+    void SetStreamBlocks(bool value);
+    auto IsStreamBlocks() const -> bool;
+
     auto ExportToAAMA(const QVector<VLayoutPiece> &details) const -> bool;
     auto ExportToASTM(const QVector<VLayoutPiece> &details) const -> bool;
 
@@ -32,14 +32,29 @@
 #include "../vmisc/exception/vexception.h"
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/vcommonsettings.h"
+#include "../vmisc/vfileindexcache.h"
 
+#include <QDataStream>
 #include <QDir>
-#include <QDirIterator>
 #include <QFileInfo>
 #include <QLoggingCategory>
 #include <QMutex>
 #include <QThread>
 
+#if QT_VERSION < QT_VERSION_CHECK(6, 4, 0)
+#include "../vmisc/compatibility.h"
+#endif
+
+using namespace Qt::Literals::StringLiterals;
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wmissing-prototypes")
+QT_WARNING_DISABLE_INTEL(1418)
+
+Q_LOGGING_CATEGORY(kmDB, "knownmeasurements.database") // NOLINT
+
+QT_WARNING_POP
+
 namespace
 {
 QT_WARNING_PUSH
@@ -48,15 +63,33 @@ QT_WARNING_DISABLE_CLANG("-Wunused-member-function")
 Q_GLOBAL_STATIC(QMutex, knownMeasurementsDatabaseMutex) // NOLINT
 
 QT_WARNING_POP
-} // namespace
 
-QT_WARNING_PUSH
-QT_WARNING_DISABLE_CLANG("-Wmissing-prototypes")
-QT_WARNING_DISABLE_INTEL(1418)
+// Increase if the set of fields stored by ParseHeader() changes
+constexpr quint32 headerRecordVersion = 1;
 
-Q_LOGGING_CATEGORY(kmDB, "knownmeasurements.database") // NOLINT
+//---------------------------------------------------------------------------------------------------------------------
+auto ParseHeader(const QString &measurementsFilePath, QByteArray &record) -> bool
+{
+    try
+    {
+        VKnownMeasurementsConverter converter(measurementsFilePath);
+        VKnownMeasurementsDocument measurements;
+        measurements.setXMLContent(converter.Convert());
 
-QT_WARNING_POP
+        QDataStream dataStream(&record, QIODevice::WriteOnly);
+        dataStream.setVersion(QDataStream::Qt_5_15);
+        dataStream << measurements.GetUId() << measurements.Name() << measurements.Description();
+        return true;
+    }
+    catch (VException &e)
+    {
+        qCWarning(kmDB, "%s\n\n%s\n\n%s", qUtf8Printable("File error."), qUtf8Printable(e.ErrorMessage()),
+                  qUtf8Printable(e.DetailedInformation()));
+    }
+
+    return false;
+}
+} // namespace
 
 //---------------------------------------------------------------------------------------------------------------------
 void VKnownMeasurementsDatabase::PopulateMeasurementsDatabase()
@@ -154,29 +187,23 @@ void VKnownMeasurementsDatabase::UpdateIndexes()
 //---------------------------------------------------------------------------------------------------------------------
 void VKnownMeasurementsDatabase::ParseDirectory(const QString &path)
 {
-    QDirIterator it(path, {"*.vkm"}, QDir::Files, QDirIterator::Subdirectories);
-    while (it.hasNext())
-    {
-        QString const measurementsFilePath = it.next();
+    // Only new and changed files are converted and loaded, headers of the rest come from the index
+    VFileIndexCache index(VFileIndexCache::IndexPath(u"knownmeasurements"_s, path), headerRecordVersion);
+    const QMap<QString, QByteArray> records = index.Scan(path, {u"*.vkm"_s}, ParseHeader);
 
-        try
-        {
-            VKnownMeasurementsConverter converter(measurementsFilePath);
-            VKnownMeasurementsDocument measurements;
-            measurements.setXMLContent(converter.Convert());
-
-            VKnownMeasurementsHeader header;
-            header.uid = measurements.GetUId();
-            header.name = measurements.Name();
-            header.description = measurements.Description();
-            header.path = measurementsFilePath;
+    for (auto i = records.constBegin(); i != records.constEnd(); ++i)
+    {
+        QDataStream dataStream(i.value());
+        dataStream.setVersion(QDataStream::Qt_5_15);
 
-            m_measurementsDB.insert(header.uid, header);
-        }
-        catch (VException &e)
+        VKnownMeasurementsHeader header;
+        dataStream >> header.uid >> header.name >> header.description;
+        if (dataStream.status() != QDataStream::Ok)
         {
-            qCWarning(kmDB, "%s\n\n%s\n\n%s", qUtf8Printable("File error."), qUtf8Printable(e.ErrorMessage()),
-                      qUtf8Printable(e.DetailedInformation()));
+            continue;
         }
+
+        header.path = i.key();
+        m_measurementsDB.insert(header.uid, header);
     }
 }
@@ -523,6 +523,53 @@ void VMeasurements::ReadMeasurements(qreal baseA, qreal baseB, qreal baseC) cons
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadMeasurementTexts update texts of a measurement that ReadMeasurements() already added to the container.
+ *
+ * Full name, description and value alias take no part in calculation. After an edit of them there is no need to read
+ * and evaluate all measurements again.
+ * @param meash measurement from the container.
+ */
+void VMeasurements::ReadMeasurementTexts(const QSharedPointer<VMeasurement> &meash) const
+{
+    if (meash.isNull())
+    {
+        return;
+    }
+
+    const QDomElement dom = FindM(meash->GetName());
+    if (dom.isNull())
+    {
+        qWarning() << tr("Can't find measurement '%1'").arg(meash->GetName());
+        return;
+    }
+
+    meash->SetDescription(GetParametrEmptyString(dom, AttrDescription));
+
+    if (meash->GetType() == VarType::MeasurementSeparator)
+    {
+        return;
+    }
+
+    meash->SetGuiText(GetParametrEmptyString(dom, AttrFullName));
+
+    if (type == MeasurementsType::Multisize)
+    {
+        // Aliases of a multisize file are stored together with corrections
+        QMap<QString, VMeasurementCorrection> corrections = ReadCorrections(dom);
+        if (not meash->IsSpecialUnits())
+        {
+            ConvertCorrections(corrections);
+        }
+        meash->SetCorrections(corrections);
+    }
+    else
+    {
+        meash->SetValueAlias(GetParametrEmptyString(dom, AttrValueAlias));
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::ClearForExport() const
 {
@@ -1734,14 +1781,7 @@ void VMeasurements::ReadMeasurement(const QDomElement &dom,
             shiftB = UnitConvertor(shiftB, Units(), *data->GetPatternUnit());
             shiftC = UnitConvertor(shiftC, Units(), *data->GetPatternUnit());
 
-            QMutableMapIterator iterator(corrections);
-            while (iterator.hasNext())
-            {
-                iterator.next();
-                VMeasurementCorrection c = iterator.value();
-                c.correction = UnitConvertor(c.correction, Units(), *data->GetPatternUnit());
-                iterator.setValue(c);
-            }
+            ConvertCorrections(corrections);
 
             convertedBaseA = UnitConvertor(convertedBaseA, Units(), *data->GetPatternUnit());
             convertedBaseB = UnitConvertor(convertedBaseB, Units(), *data->GetPatternUnit());
@@ -1813,3 +1853,16 @@ void VMeasurements::ReadMeasurement(const QDomElement &dom,
         }
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void VMeasurements::ConvertCorrections(QMap<QString, VMeasurementCorrection> &corrections) const
+{
+    QMutableMapIterator iterator(corrections);
+    while (iterator.hasNext())
+    {
+        iterator.next();
+        VMeasurementCorrection c = iterator.value();
+        c.correction = UnitConvertor(c.correction, Units(), *data->GetPatternUnit());
+        iterator.setValue(c);
+    }
+}
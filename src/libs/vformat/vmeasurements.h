@@ -94,6 +94,7 @@ public:
     void StoreNames(bool store);
 
     void ReadMeasurements(qreal baseA, qreal baseB = 0, qreal baseC = 0) const;
+    void ReadMeasurementTexts(const QSharedPointer<VMeasurement> &meash) const;
     void ClearForExport() const;
 
     auto Type() const -> MeasurementsType;
@@ -268,6 +269,7 @@ private:
                          QSharedPointer<VMeasurement> &tempMeash,
                          int i,
                          const DimensionBases &bases) const;
+    void ConvertCorrections(QMap<QString, VMeasurementCorrection> &corrections) const;
 };
 
 #endif // VMEASUREMENTS_H
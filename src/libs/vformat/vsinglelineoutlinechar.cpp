@@ -27,6 +27,7 @@
  *************************************************************************/
 #include "vsinglelineoutlinechar.h"
 #include "../vmisc/compatibility.h"
+#include "../vmisc/vtextpathcache.h"
 
 #include <QCache>
 #include <QDir>
@@ -44,13 +45,18 @@
 #include <QDirListing>
 #endif
 
+using namespace Qt::Literals::StringLiterals;
+
 namespace
 {
+using VOutlineCorrectionsRevision = QHash<QString, quint32>;
+
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_CLANG("-Wunused-member-function")
 
 Q_GLOBAL_STATIC(QMutex, singleLineOutlineCharMutex)                         // NOLINT
 Q_GLOBAL_STATIC_WITH_ARGS(VOutlineCorrectionsCache, cachedCorrections, (5)) // NOLINT
+Q_GLOBAL_STATIC(VOutlineCorrectionsRevision, correctionsRevision)           // NOLINT
 
 QT_WARNING_POP
 
@@ -214,6 +220,7 @@ void VSingleLineOutlineChar::LoadCorrections(const QString &dirPath) const
 
     QMutexLocker const locker(singleLineOutlineCharMutex());
     cachedCorrections()->insert(m_font.family(), ParseCorrectiosn(jsonDocument.object()));
+    ++(*correctionsRevision())[m_font.family()];
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -221,6 +228,7 @@ void VSingleLineOutlineChar::ClearCorrectionsCache()
 {
     QMutexLocker const locker(singleLineOutlineCharMutex());
     cachedCorrections()->remove(m_font.family());
+    ++(*correctionsRevision())[m_font.family()];
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -232,23 +240,38 @@ auto VSingleLineOutlineChar::DrawChar(qreal x, qreal y, QChar c) const -> QPaint
         c = QChar(0xFFFD);
     }
 
-    QPainterPath path;
-    path.addText(x, y, m_font, c);
-
     QMutexLocker locker(singleLineOutlineCharMutex());
-    QHash<int, bool> segmentCorrections;
-
-    if (cachedCorrections()->contains(m_font.family()))
-    {
-        segmentCorrections = cachedCorrections()->object(m_font.family())->value(c);
-    }
+    // Outlines built with old corrections must not be reused, the revision is a part of the cache key
+    const quint32 revision = correctionsRevision()->value(m_font.family(), 0);
     locker.unlock();
 
-    return CorrectPath(path, segmentCorrections);
+    const QString fontKey = VTextPathCache::FontKey(m_font) + '#'_L1 + QString::number(revision);
+
+    QPainterPath path = VTextPathCache::Glyph(fontKey, c,
+                                              [this, c]()
+                                              {
+                                                  QPainterPath glyph;
+                                                  glyph.addText(0, 0, m_font, c);
+
+                                                  QMutexLocker correctionsLocker(singleLineOutlineCharMutex());
+                                                  QHash<int, bool> segmentCorrections;
+
+                                                  if (cachedCorrections()->contains(m_font.family()))
+                                                  {
+                                                      segmentCorrections =
+                                                          cachedCorrections()->object(m_font.family())->value(c);
+                                                  }
+                                                  correctionsLocker.unlock();
+
+                                                  return CorrectPath(glyph, segmentCorrections);
+                                              });
+    path.translate(x, y);
+    return path;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VSingleLineOutlineChar::IsPopulated() const -> bool
 {
+    QMutexLocker const locker(singleLineOutlineCharMutex());
     return cachedCorrections()->contains(m_font.family());
 }
@@ -34,6 +34,8 @@
 #include <QPoint>
 #include <QtConcurrent>
 #include <QtDebug>
+#include <algorithm>
+#include <array>
 
 #include "../ifc/ifcdef.h"
 #include "../vgeometry/vpointf.h"
@@ -328,8 +330,124 @@ auto PointBezier_r(QPointF p1, QPointF p2, QPointF p3, QPointF p4, qint16 level,
     return PointBezier_r(p1, {x12, y12}, {x123, y123}, {x1234, y1234}, nextLevel, approximationScale)
            + PointBezier_r({x1234, y1234}, {x234, y234}, {x34, y34}, p4, nextLevel, approximationScale);
 }
+
+// Number of intervals in an arc-length table
+constexpr int lengthTableSize = 32;
+
+using CubicCurve = std::array<QPointF, 4>;
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto Lerp(QPointF p1, QPointF p2, qreal t) -> QPointF
+{
+    return p1 + (p2 - p1) * t;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SplitCurve split a cubic curve at parameter t (de Casteljau).
+ * @param curve control points of a curve.
+ * @param t parameter of the split point.
+ * @param left the part [0, t].
+ * @param right the part [t, 1].
+ */
+void SplitCurve(const CubicCurve &curve, qreal t, CubicCurve &left, CubicCurve &right)
+{
+    const QPointF p12 = Lerp(curve.at(0), curve.at(1), t);
+    const QPointF p23 = Lerp(curve.at(1), curve.at(2), t);
+    const QPointF p34 = Lerp(curve.at(2), curve.at(3), t);
+    const QPointF p123 = Lerp(p12, p23, t);
+    const QPointF p234 = Lerp(p23, p34, t);
+    const QPointF p1234 = Lerp(p123, p234, t);
+
+    left = {curve.at(0), p12, p123, p1234};
+    right = {p1234, p234, p34, curve.at(3)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SubCurve return control points of the part of a cubic curve between parameters t1 and t2.
+ */
+auto SubCurve(const CubicCurve &curve, qreal t1, qreal t2) -> CubicCurve
+{
+    CubicCurve left;
+    CubicCurve right;
+    SplitCurve(curve, t1, left, right);
+    SplitCurve(right, (t2 - t1) / (1. - t1), left, right);
+    return left;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Speed return length of the curve derivative at parameter t.
+ */
+auto Speed(const CubicCurve &curve, qreal t) -> qreal
+{
+    const qreal mt = 1. - t;
+    const QPointF derivative = 3. * (mt * mt * (curve.at(1) - curve.at(0)) + 2. * mt * t * (curve.at(2) - curve.at(1)) +
+                                     t * t * (curve.at(3) - curve.at(2)));
+    return qSqrt(QPointF::dotProduct(derivative, derivative));
+}
 } // namespace
 
+/**
+ * @brief The VCubicBezierLengthTable struct is a curve length sampled at lengthTableSize + 1 uniformly spaced
+ * parameters.
+ */
+struct VCubicBezierLengthTable
+{
+    CubicCurve curve{};
+    qreal length{0};
+    std::array<qreal, lengthTableSize + 1> lengths{};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+VCubicBezierLengthCache::VCubicBezierLengthCache(const VCubicBezierLengthCache &cache)
+  : m_table(cache.Table())
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VCubicBezierLengthCache::operator=(const VCubicBezierLengthCache &cache) -> VCubicBezierLengthCache &
+{
+    if (&cache == this)
+    {
+        return *this;
+    }
+    SetTable(cache.Table());
+    return *this;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VCubicBezierLengthCache::VCubicBezierLengthCache(VCubicBezierLengthCache &&cache) noexcept
+  : m_table(cache.Table())
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VCubicBezierLengthCache::operator=(VCubicBezierLengthCache &&cache) noexcept -> VCubicBezierLengthCache &
+{
+    if (&cache == this)
+    {
+        return *this;
+    }
+    SetTable(cache.Table());
+    return *this;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VCubicBezierLengthCache::Table() const -> QSharedPointer<const VCubicBezierLengthTable>
+{
+    QMutexLocker const locker(&m_mutex);
+    return m_table;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCubicBezierLengthCache::SetTable(const QSharedPointer<const VCubicBezierLengthTable> &table)
+{
+    QMutexLocker const locker(&m_mutex);
+    m_table = table;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractCubicBezier::VAbstractCubicBezier(const GOType &type, const quint32 &idObject, const Draw &mode)
   : VAbstractBezier(type, idObject, mode)
@@ -344,6 +462,7 @@ auto VAbstractCubicBezier::operator=(const VAbstractCubicBezier &curve) -> VAbst
         return *this;
     }
     VAbstractBezier::operator=(curve);
+    m_lengthCache = curve.m_lengthCache;
     return *this;
 }
 
@@ -483,19 +602,74 @@ auto VAbstractCubicBezier::GetMainNameForHistory() const -> QString
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetParmT return parameter t of the point at the length from the curve start.
+ *
+ * The arc-length table gives the interval that holds the point and an interpolated first guess. Newton's method
+ * refines the guess, steps that leave the interval fall back to bisection.
+ * @param length length from the curve start.
+ * @return parameter t.
+ */
 auto VAbstractCubicBezier::GetParmT(qreal length) const -> qreal
 {
-    const qreal base = GetRealLength();
     if (length < 0)
     {
         return 0;
     }
 
-    if (length > base)
+    const QSharedPointer<const VCubicBezierLengthTable> table = LengthTable();
+
+    if (length > table->length)
     {
-        length = base;
+        length = table->length;
     }
 
+    const auto upper = std::upper_bound(table->lengths.cbegin(), table->lengths.cend(), length);
+    const int index = qBound(0, static_cast<int>(upper - table->lengths.cbegin()) - 1, lengthTableSize - 1);
+
+    const qreal intervalLength = table->lengths.at(index + 1) - table->lengths.at(index);
+    qreal parT = (index + (intervalLength > 0 ? (length - table->lengths.at(index)) / intervalLength : 0)) /
+                 lengthTableSize;
+
+    // The table is built from separately flattened parts, so its lengths are close but not equal to RealLengthByT().
+    // Widen the interval by a neighbour on each side to be sure the answer is inside.
+    qreal low = qMax(0, index - 1) / static_cast<qreal>(lengthTableSize);
+    qreal high = qMin(lengthTableSize, index + 2) / static_cast<qreal>(lengthTableSize);
+
+    constexpr qreal eps = ToPixel(0.00001, Unit::Mm);
+    constexpr int maxIterations = 64;
+
+    for (int i = 0; i < maxIterations; ++i)
+    {
+        const qreal diff = RealLengthByT(parT) - length;
+        if (qAbs(diff) <= eps)
+        {
+            return parT;
+        }
+
+        diff > 0 ? high = parT : low = parT;
+
+        if (qFuzzyIsNull(high - low))
+        {
+            break;
+        }
+
+        const qreal speed = Speed(table->curve, parT);
+        qreal next = speed > 0 ? parT - diff / speed : low;
+        if (next <= low || next >= high)
+        {
+            next = (low + high) / 2.;
+        }
+        parT = next;
+    }
+
+    // The point is outside the expected interval. Should not happen, but search the whole curve to be safe.
+    return BisectParmT(length);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VAbstractCubicBezier::BisectParmT(qreal length) const -> qreal
+{
     constexpr qreal eps = ToPixel(0.00001, Unit::Mm);
     qreal parT = 0.5;
     qreal step = parT;
@@ -525,6 +699,46 @@ auto VAbstractCubicBezier::GetParmT(qreal length) const -> qreal
     return parT;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LengthTable return the arc-length table of the curve. The table is built on first use and shared by copies
+ * of the curve until the curve changes.
+ */
+auto VAbstractCubicBezier::LengthTable() const -> QSharedPointer<const VCubicBezierLengthTable>
+{
+    const CubicCurve curve{static_cast<QPointF>(GetP1()), GetControlPoint1(), GetControlPoint2(),
+                           static_cast<QPointF>(GetP4())};
+
+    if (QSharedPointer<const VCubicBezierLengthTable> table = m_lengthCache.Table();
+        not table.isNull() && table->curve == curve)
+    {
+        return table;
+    }
+
+    auto table = QSharedPointer<VCubicBezierLengthTable>::create();
+    table->curve = curve;
+    table->length = GetRealLength();
+
+    for (int i = 0; i < lengthTableSize; ++i)
+    {
+        const CubicCurve part = SubCurve(curve, static_cast<qreal>(i) / lengthTableSize,
+                                         static_cast<qreal>(i + 1) / lengthTableSize);
+        table->lengths[i + 1] =
+            table->lengths.at(i) + LengthBezier(part.at(0), part.at(1), part.at(2), part.at(3), maxCurveApproximationScale);
+    }
+
+    // Scale to the curve length, a sum of parts differs slightly from the curve flattened at once
+    if (const qreal sum = table->lengths.back(); sum > 0)
+    {
+        const qreal scale = table->length / sum;
+        std::transform(table->lengths.begin(), table->lengths.end(), table->lengths.begin(),
+                       [scale](qreal value) -> qreal { return value * scale; });
+    }
+
+    m_lengthCache.SetTable(table);
+    return table;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractCubicBezier::CreateName()
 {
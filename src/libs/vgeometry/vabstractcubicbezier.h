@@ -29,7 +29,9 @@
 #ifndef VABSTRACTCUBICBEZIER_H
 #define VABSTRACTCUBICBEZIER_H
 
+#include <QMutex>
 #include <QPointF>
+#include <QSharedPointer>
 #include <QString>
 #include <QVector>
 #include <QtGlobal>
@@ -38,6 +40,32 @@
 #include "vgeometrydef.h"
 
 class VPointF;
+struct VCubicBezierLengthTable;
+
+/**
+ * @brief The VCubicBezierLengthCache class holds the arc-length table of a curve.
+ *
+ * The table is immutable, copies of a curve share it. Because the curve can change after a copy the table keeps the
+ * points it was built for and is rebuilt when they do not match anymore.
+ */
+class VCubicBezierLengthCache
+{
+public:
+    VCubicBezierLengthCache() = default;
+    VCubicBezierLengthCache(const VCubicBezierLengthCache &cache);
+    auto operator=(const VCubicBezierLengthCache &cache) -> VCubicBezierLengthCache &;
+    ~VCubicBezierLengthCache() = default;
+
+    VCubicBezierLengthCache(VCubicBezierLengthCache &&cache) noexcept;
+    auto operator=(VCubicBezierLengthCache &&cache) noexcept -> VCubicBezierLengthCache &;
+
+    auto Table() const -> QSharedPointer<const VCubicBezierLengthTable>;
+    void SetTable(const QSharedPointer<const VCubicBezierLengthTable> &table);
+
+private:
+    mutable QMutex m_mutex{};
+    QSharedPointer<const VCubicBezierLengthTable> m_table{};
+};
 
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Wsuggest-final-types")
@@ -92,6 +120,12 @@ protected:
     virtual auto GetControlPoint1() const -> QPointF = 0;
     virtual auto GetControlPoint2() const -> QPointF = 0;
     virtual auto GetRealLength() const -> qreal = 0;
+
+private:
+    mutable VCubicBezierLengthCache m_lengthCache{};
+
+    auto LengthTable() const -> QSharedPointer<const VCubicBezierLengthTable>;
+    auto BisectParmT(qreal length) const -> qreal;
 };
 
 QT_WARNING_POP
@@ -33,6 +33,7 @@
 #include <QLineF>
 #include <QPoint>
 #include <QPointF>
+#include <QPolygonF>
 #include <QRectF>
 #include <QTransform>
 #include <QtMath>
@@ -43,6 +44,74 @@
 #include "vgeometrydef.h"
 #include "vgobject_p.h"
 
+#include <array>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Inclusive version of QRectF::intersects(). Qt ignores degenerated rects, a horizontal line has one.
+auto RectsTouch(const QRectF &rect1, const QRectF &rect2) -> bool
+{
+    return rect1.left() <= rect2.right() && rect2.left() <= rect1.right() && rect1.top() <= rect2.bottom() &&
+           rect2.top() <= rect1.bottom();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Liang-Barsky line clipping. An end point that lies inside the rect stays untouched.
+auto ClipSegmentToRect(const QRectF &rect, QPointF &p1, QPointF &p2) -> bool
+{
+    const QPointF start = p1;
+    const QPointF delta = p2 - p1;
+    const std::array<qreal, 4> p{-delta.x(), delta.x(), -delta.y(), delta.y()};
+    const std::array<qreal, 4> q{start.x() - rect.left(), rect.right() - start.x(), start.y() - rect.top(),
+                                 rect.bottom() - start.y()};
+
+    qreal t0 = 0;
+    qreal t1 = 1;
+    for (std::size_t i = 0; i < p.size(); ++i)
+    {
+        if (qFuzzyIsNull(p.at(i)))
+        {
+            if (q.at(i) < 0)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        const qreal r = q.at(i) / p.at(i);
+        if (p.at(i) < 0)
+        {
+            if (r > t1)
+            {
+                return false;
+            }
+            t0 = qMax(t0, r);
+        }
+        else
+        {
+            if (r < t0)
+            {
+                return false;
+            }
+            t1 = qMin(t1, r);
+        }
+    }
+
+    if (t0 > 0)
+    {
+        p1 = start + delta * t0;
+    }
+
+    if (t1 < 1)
+    {
+        p2 = start + delta * t1;
+    }
+
+    return true;
+}
+} // namespace
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief VGObject default constructor.
@@ -620,3 +689,97 @@ auto VGObject::LinesIntersect(const QLineF &line1, const QLineF &line2, QPointF
 
     return intersect;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ClipPathToRect return the part of a path that lies inside a rect.
+ *
+ * The result is meant for stroking. Line segments are cut at the rect border, each piece that leaves the rect starts a
+ * new subpath. Curve segments are kept whole if their control points reach the rect. Filling the result gives wrong
+ * area, because cut subpaths are not closed along the rect border.
+ * @param path path to clip.
+ * @param rect rect in the same coordinates as the path.
+ * @return clipped path. Empty if nothing is inside.
+ */
+auto VGObject::ClipPathToRect(const QPainterPath &path, const QRectF &rect) -> QPainterPath
+{
+    const QRectF pathRect = path.controlPointRect();
+    if (path.isEmpty() || rect.contains(pathRect))
+    {
+        return path;
+    }
+
+    QPainterPath clipped;
+    if (not RectsTouch(pathRect, rect))
+    {
+        return clipped;
+    }
+
+    QPointF current;
+    bool connected = false; // the clipped path ends at the current point
+
+    for (int i = 0; i < path.elementCount(); ++i)
+    {
+        const QPainterPath::Element element = path.elementAt(i);
+        switch (element.type)
+        {
+            case QPainterPath::MoveToElement:
+                current = element;
+                connected = false;
+                break;
+            case QPainterPath::LineToElement:
+            {
+                QPointF p1 = current;
+                QPointF p2 = element;
+                if (ClipSegmentToRect(rect, p1, p2))
+                {
+                    if (not connected || p1 != current)
+                    {
+                        clipped.moveTo(p1);
+                    }
+                    clipped.lineTo(p2);
+                    connected = p2 == QPointF(element);
+                }
+                else
+                {
+                    connected = false;
+                }
+                current = element;
+                break;
+            }
+            case QPainterPath::CurveToElement:
+            {
+                if (i + 2 >= path.elementCount())
+                {
+                    return clipped;
+                }
+
+                const QPointF c1 = element;
+                const QPointF c2 = path.elementAt(i + 1);
+                const QPointF end = path.elementAt(i + 2);
+                i += 2;
+
+                if (RectsTouch(QPolygonF({current, c1, c2, end}).boundingRect(), rect))
+                {
+                    if (not connected)
+                    {
+                        clipped.moveTo(current);
+                    }
+                    clipped.cubicTo(c1, c2, end);
+                    connected = true;
+                }
+                else
+                {
+                    connected = false;
+                }
+                current = end;
+                break;
+            }
+            case QPainterPath::CurveToDataElement:
+            default:
+                break;
+        }
+    }
+
+    return clipped;
+}
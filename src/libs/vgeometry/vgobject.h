@@ -118,6 +118,8 @@ public:
     static auto LinesIntersect(const QLineF &line1, const QLineF &line2, QPointF *intersectionPoint = nullptr)
         -> QLineF::IntersectionType;
 
+    static auto ClipPathToRect(const QPainterPath &path, const QRectF &rect) -> QPainterPath;
+
 private:
     QSharedDataPointer<VGObjectData> d;
 
@@ -0,0 +1,456 @@
+/************************************************************************
+ **
+ **  @file   vpolygonintersection.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vpolygonintersection.h"
+
+#include <QtMath>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_GCC("-Wfloat-equal")
+QT_WARNING_DISABLE_CLANG("-Wfloat-equal")
+
+// Jonathan Richard Shewchuk's robust predicates, see predicates.cpp
+extern void exactinit();
+extern auto orient2d(qreal *pa, qreal *pb, qreal *pc) -> qreal;
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Inclusive version of QRectF::intersects(). Qt ignores rects that only touch and degenerated rects.
+auto RectsTouch(const QRectF &rect1, const QRectF &rect2) -> bool
+{
+    return rect1.left() <= rect2.right() && rect2.left() <= rect1.right() && rect1.top() <= rect2.bottom() &&
+           rect2.top() <= rect1.bottom();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto RectContainsPoint(const QRectF &rect, const QPointF &point) -> bool
+{
+    return point.x() >= rect.left() && point.x() <= rect.right() && point.y() >= rect.top() &&
+           point.y() <= rect.bottom();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto IsPointOnSegment(const QPointF &p1, const QPointF &p2, const QPointF &point) -> bool
+{
+    return Orient2D(p1, p2, point) == 0.0 && point.x() >= qMin(p1.x(), p2.x()) && point.x() <= qMax(p1.x(), p2.x()) &&
+           point.y() >= qMin(p1.y(), p2.y()) && point.y() <= qMax(p1.y(), p2.y());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto EdgeCrossesActive(const VPolygonEdges &polygon, vsizetype edge, const VPolygonEdges &other,
+                       QVector<vsizetype> &active, bool touching) -> bool
+{
+    const qreal minX = polygon.EdgeMinX(edge);
+
+    // Drop edges which the sweep line already left behind
+    active.erase(std::remove_if(active.begin(), active.end(),
+                                [&other, minX](vsizetype i) { return other.EdgeMaxX(i) < minX; }),
+                 active.end());
+
+    const QPointF &p1 = polygon.EdgeP1(edge);
+    const QPointF &p2 = polygon.EdgeP2(edge);
+    const qreal minY = qMin(p1.y(), p2.y());
+    const qreal maxY = qMax(p1.y(), p2.y());
+
+    for (auto i : active)
+    {
+        const QPointF &q1 = other.EdgeP1(i);
+        const QPointF &q2 = other.EdgeP2(i);
+
+        if (qMax(q1.y(), q2.y()) < minY || qMin(q1.y(), q2.y()) > maxY)
+        {
+            continue;
+        }
+
+        if (touching ? SegmentsIntersect(p1, p2, q1, q2) : SegmentsCross(p1, p2, q1, q2))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Sweeps both polygons along x axis and looks for a pair of crossing (or also touching) edges.
+auto SweepBoundaries(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2, bool touching) -> bool
+{
+    if (not polygon1.IsValid() || not polygon2.IsValid() ||
+        not RectsTouch(polygon1.BoundingRect(), polygon2.BoundingRect()))
+    {
+        return false;
+    }
+
+    const QVector<vsizetype> &order1 = polygon1.SweepOrder();
+    const QVector<vsizetype> &order2 = polygon2.SweepOrder();
+    const qreal sweepEnd = qMin(polygon1.BoundingRect().right(), polygon2.BoundingRect().right());
+
+    QVector<vsizetype> active1;
+    QVector<vsizetype> active2;
+
+    vsizetype i1 = 0;
+    vsizetype i2 = 0;
+    while (i1 < order1.size() || i2 < order2.size())
+    {
+        const bool takeFirst =
+            i2 >= order2.size() ||
+            (i1 < order1.size() && polygon1.EdgeMinX(order1.at(i1)) <= polygon2.EdgeMinX(order2.at(i2)));
+
+        if (takeFirst)
+        {
+            const vsizetype edge = order1.at(i1++);
+            if (polygon1.EdgeMinX(edge) > sweepEnd)
+            {
+                break;
+            }
+
+            if (EdgeCrossesActive(polygon1, edge, polygon2, active2, touching))
+            {
+                return true;
+            }
+            active1.append(edge);
+        }
+        else
+        {
+            const vsizetype edge = order2.at(i2++);
+            if (polygon2.EdgeMinX(edge) > sweepEnd)
+            {
+                break;
+            }
+
+            if (EdgeCrossesActive(polygon2, edge, polygon1, active1, touching))
+            {
+                return true;
+            }
+            active2.append(edge);
+        }
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+struct ProbeResult
+{
+    bool anyInside{false};
+    bool anyOutside{false};
+    bool allOnBoundary{true};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// Classifies vertices of the probe against the polygon. For edges that lie with both ends on the polygon boundary the
+// midpoint is tested too, otherwise a chord running outside (or inside) a concave polygon would be missed.
+auto ProbePolygon(const VPolygonEdges &polygon, const VPolygonEdges &probe, bool stopOnInside) -> ProbeResult
+{
+    ProbeResult result;
+    const QRectF rect = polygon.BoundingRect();
+    const QVector<QPointF> &points = probe.Points();
+
+    QVector<PolygonPointLocation> locations(points.size(), PolygonPointLocation::Outside);
+    for (vsizetype i = 0; i < points.size(); ++i)
+    {
+        const QPointF &p = points.at(i);
+        if (not RectContainsPoint(rect, p))
+        {
+            result.anyOutside = true;
+            result.allOnBoundary = false;
+            continue;
+        }
+
+        locations[i] = PolygonPointLocate(polygon, p);
+        switch (locations.at(i))
+        {
+            case PolygonPointLocation::Inside:
+                result.anyInside = true;
+                result.allOnBoundary = false;
+                if (stopOnInside)
+                {
+                    return result;
+                }
+                break;
+            case PolygonPointLocation::Outside:
+                result.anyOutside = true;
+                result.allOnBoundary = false;
+                break;
+            case PolygonPointLocation::OnBoundary:
+            default:
+                break;
+        }
+    }
+
+    for (vsizetype i = 0; i < points.size(); ++i)
+    {
+        const vsizetype next = i + 1 < points.size() ? i + 1 : 0;
+        if (locations.at(i) != PolygonPointLocation::OnBoundary ||
+            locations.at(next) != PolygonPointLocation::OnBoundary)
+        {
+            continue;
+        }
+
+        switch (PolygonPointLocate(polygon, (points.at(i) + points.at(next)) / 2.))
+        {
+            case PolygonPointLocation::Inside:
+                result.anyInside = true;
+                result.allOnBoundary = false;
+                if (stopOnInside)
+                {
+                    return result;
+                }
+                break;
+            case PolygonPointLocation::Outside:
+                result.anyOutside = true;
+                result.allOnBoundary = false;
+                break;
+            case PolygonPointLocation::OnBoundary:
+            default:
+                break;
+        }
+    }
+
+    return result;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+VPolygonEdges::VPolygonEdges(const QVector<QPointF> &points)
+  : m_points(points)
+{
+    if (m_points.size() > 1 && m_points.constFirst() == m_points.constLast())
+    {
+        m_points.removeLast();
+    }
+
+    if (m_points.isEmpty())
+    {
+        return;
+    }
+
+    qreal minX = m_points.constFirst().x();
+    qreal minY = m_points.constFirst().y();
+    qreal maxX = minX;
+    qreal maxY = minY;
+    for (const auto &p : std::as_const(m_points))
+    {
+        minX = qMin(minX, p.x());
+        minY = qMin(minY, p.y());
+        maxX = qMax(maxX, p.x());
+        maxY = qMax(maxY, p.y());
+    }
+    m_boundingRect = QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+
+    if (not IsValid())
+    {
+        return;
+    }
+
+    m_sweepOrder.resize(m_points.size());
+    std::iota(m_sweepOrder.begin(), m_sweepOrder.end(), 0);
+    std::sort(m_sweepOrder.begin(), m_sweepOrder.end(),
+              [this](vsizetype i, vsizetype j) { return EdgeMinX(i) < EdgeMinX(j); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Orient2D robust orientation test.
+ * @return a positive value if the points a, b, and c occur in counterclockwise order (in y-up coordinates), a negative
+ * value if they occur in clockwise order, and zero if they are collinear. Only the sign is exact.
+ */
+auto Orient2D(const QPointF &a, const QPointF &b, const QPointF &c) -> qreal
+{
+    static const bool initialized = []()
+    {
+        exactinit();
+        return true;
+    }();
+    Q_UNUSED(initialized)
+
+    std::array<qreal, 2> pa{a.x(), a.y()};
+    std::array<qreal, 2> pb{b.x(), b.y()};
+    std::array<qreal, 2> pc{c.x(), c.y()};
+    return orient2d(pa.data(), pb.data(), pc.data());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SegmentsCross check if two segments cross each other in a single interior point.
+ *
+ * Touching (an end point lying on the other segment) and collinear overlapping do not count. Pieces placed edge to
+ * edge must not be treated as intersecting.
+ */
+auto SegmentsCross(const QPointF &p1, const QPointF &p2, const QPointF &q1, const QPointF &q2) -> bool
+{
+    const qreal o1 = Orient2D(p1, p2, q1);
+    const qreal o2 = Orient2D(p1, p2, q2);
+    if ((o1 >= 0.0 && o2 >= 0.0) || (o1 <= 0.0 && o2 <= 0.0))
+    {
+        return false;
+    }
+
+    const qreal o3 = Orient2D(q1, q2, p1);
+    const qreal o4 = Orient2D(q1, q2, p2);
+    return (o3 > 0.0 && o4 < 0.0) || (o3 < 0.0 && o4 > 0.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SegmentsIntersect check if two closed segments have at least one common point. Touching and collinear
+ * overlapping count.
+ */
+auto SegmentsIntersect(const QPointF &p1, const QPointF &p2, const QPointF &q1, const QPointF &q2) -> bool
+{
+    const qreal o1 = Orient2D(p1, p2, q1);
+    const qreal o2 = Orient2D(p1, p2, q2);
+    const qreal o3 = Orient2D(q1, q2, p1);
+    const qreal o4 = Orient2D(q1, q2, p2);
+
+    if (((o1 > 0.0 && o2 < 0.0) || (o1 < 0.0 && o2 > 0.0)) && ((o3 > 0.0 && o4 < 0.0) || (o3 < 0.0 && o4 > 0.0)))
+    {
+        return true;
+    }
+
+    return IsPointOnSegment(p1, p2, q1) || IsPointOnSegment(p1, p2, q2) || IsPointOnSegment(q1, q2, p1) ||
+           IsPointOnSegment(q1, q2, p2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonPointLocate locate a point relative to a polygon. Uses the winding rule, the same as
+ * VGObject::PainterPath().
+ */
+auto PolygonPointLocate(const VPolygonEdges &polygon, const QPointF &point) -> PolygonPointLocation
+{
+    if (not polygon.IsValid() || not RectContainsPoint(polygon.BoundingRect(), point))
+    {
+        return PolygonPointLocation::Outside;
+    }
+
+    int winding = 0;
+    for (vsizetype i = 0; i < polygon.EdgesCount(); ++i)
+    {
+        const QPointF &p1 = polygon.EdgeP1(i);
+        const QPointF &p2 = polygon.EdgeP2(i);
+
+        if (IsPointOnSegment(p1, p2, point))
+        {
+            return PolygonPointLocation::OnBoundary;
+        }
+
+        if (p1.y() <= point.y())
+        {
+            if (p2.y() > point.y() && Orient2D(p1, p2, point) > 0.0)
+            {
+                ++winding;
+            }
+        }
+        else if (p2.y() <= point.y() && Orient2D(p1, p2, point) < 0.0)
+        {
+            --winding;
+        }
+    }
+
+    return winding != 0 ? PolygonPointLocation::Inside : PolygonPointLocation::Outside;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonBoundariesCross sweep both polygons along x axis and look for a pair of crossing edges.
+ */
+auto PolygonBoundariesCross(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2) -> bool
+{
+    return SweepBoundaries(polygon1, polygon2, false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonBoundariesIntersect check if boundaries of two polygons have at least one common point. Unlike
+ * PolygonBoundariesCross() edges that only touch or lie on each other count too.
+ */
+auto PolygonBoundariesIntersect(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2) -> bool
+{
+    return SweepBoundaries(polygon1, polygon2, true);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonContains check if the inner polygon lies inside the outer one. Shared boundaries are allowed.
+ */
+auto PolygonContains(const VPolygonEdges &outer, const VPolygonEdges &inner) -> bool
+{
+    if (not outer.IsValid() || not inner.IsValid())
+    {
+        return false;
+    }
+
+    const QRectF outerRect = outer.BoundingRect();
+    const QRectF innerRect = inner.BoundingRect();
+    if (innerRect.left() < outerRect.left() || innerRect.right() > outerRect.right() ||
+        innerRect.top() < outerRect.top() || innerRect.bottom() > outerRect.bottom())
+    {
+        return false;
+    }
+
+    if (PolygonBoundariesCross(outer, inner))
+    {
+        return false;
+    }
+
+    return not ProbePolygon(outer, inner, false).anyOutside;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonsOverlap check if interiors of two polygons have common area. Polygons that only touch do not overlap.
+ */
+auto PolygonsOverlap(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2) -> bool
+{
+    if (not polygon1.IsValid() || not polygon2.IsValid() ||
+        not RectsTouch(polygon1.BoundingRect(), polygon2.BoundingRect()))
+    {
+        return false;
+    }
+
+    if (PolygonBoundariesCross(polygon1, polygon2))
+    {
+        return true;
+    }
+
+    // Without crossing edges one polygon can still lie inside the other
+    const ProbeResult probe2 = ProbePolygon(polygon1, polygon2, true);
+    if (probe2.anyInside || probe2.allOnBoundary)
+    {
+        return true;
+    }
+
+    return ProbePolygon(polygon2, polygon1, true).anyInside;
+}
+
+QT_WARNING_POP
@@ -0,0 +1,139 @@
+/************************************************************************
+ **
+ **  @file   vpolygonintersection.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VPOLYGONINTERSECTION_H
+#define VPOLYGONINTERSECTION_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+
+#include "../vmisc/defglobal.h"
+
+/**
+ * @brief The VPolygonEdges class keeps a closed polygon prepared for intersection tests.
+ *
+ * Edges are precomputed once and ordered by their left x coordinate, so repeated tests against the same polygon only
+ * do the sweep. The polygon is treated as closed, the last point connects to the first one.
+ */
+class VPolygonEdges
+{
+public:
+    VPolygonEdges() = default;
+    explicit VPolygonEdges(const QVector<QPointF> &points);
+
+    auto Points() const -> const QVector<QPointF> &;
+    auto BoundingRect() const -> QRectF;
+    auto IsValid() const -> bool;
+
+    auto EdgesCount() const -> vsizetype;
+    auto EdgeP1(vsizetype i) const -> const QPointF &;
+    auto EdgeP2(vsizetype i) const -> const QPointF &;
+    auto EdgeMinX(vsizetype i) const -> qreal;
+    auto EdgeMaxX(vsizetype i) const -> qreal;
+
+    auto SweepOrder() const -> const QVector<vsizetype> &;
+
+private:
+    QVector<QPointF> m_points{};
+    QVector<vsizetype> m_sweepOrder{};
+    QRectF m_boundingRect{};
+};
+
+enum class PolygonPointLocation : qint8
+{
+    Outside,
+    Inside,
+    OnBoundary
+};
+
+auto Orient2D(const QPointF &a, const QPointF &b, const QPointF &c) -> qreal;
+auto SegmentsCross(const QPointF &p1, const QPointF &p2, const QPointF &q1, const QPointF &q2) -> bool;
+auto SegmentsIntersect(const QPointF &p1, const QPointF &p2, const QPointF &q1, const QPointF &q2) -> bool;
+
+auto PolygonPointLocate(const VPolygonEdges &polygon, const QPointF &point) -> PolygonPointLocation;
+auto PolygonBoundariesCross(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2) -> bool;
+auto PolygonBoundariesIntersect(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2) -> bool;
+auto PolygonContains(const VPolygonEdges &outer, const VPolygonEdges &inner) -> bool;
+auto PolygonsOverlap(const VPolygonEdges &polygon1, const VPolygonEdges &polygon2) -> bool;
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::Points() const -> const QVector<QPointF> &
+{
+    return m_points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::BoundingRect() const -> QRectF
+{
+    return m_boundingRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::IsValid() const -> bool
+{
+    return m_points.size() >= 3;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::EdgesCount() const -> vsizetype
+{
+    return IsValid() ? m_points.size() : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::EdgeP1(vsizetype i) const -> const QPointF &
+{
+    return m_points.at(i);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::EdgeP2(vsizetype i) const -> const QPointF &
+{
+    return m_points.at(i + 1 < m_points.size() ? i + 1 : 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::EdgeMinX(vsizetype i) const -> qreal
+{
+    return qMin(EdgeP1(i).x(), EdgeP2(i).x());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::EdgeMaxX(vsizetype i) const -> qreal
+{
+    return qMax(EdgeP1(i).x(), EdgeP2(i).x());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPolygonEdges::SweepOrder() const -> const QVector<vsizetype> &
+{
+    return m_sweepOrder;
+}
+
+#endif // VPOLYGONINTERSECTION_H
@@ -40,10 +40,13 @@
 #include "../vmisc/svgfont/vsvgfontdatabase.h"
 #include "../vmisc/svgfont/vsvgfontengine.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vtextpathcache.h"
 
 #include <QFile>
 #include <QLine>
+#include <QLoggingCategory>
 #include <QtMath>
+#include <algorithm>
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 4, 0)
 #include "../vmisc/compatibility.h"
@@ -51,6 +54,14 @@
 
 using namespace Qt::Literals::StringLiterals;
 
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wmissing-prototypes")
+QT_WARNING_DISABLE_INTEL(1418)
+
+Q_LOGGING_CATEGORY(vHPGL, "v.hpgl") // NOLINT
+
+QT_WARNING_POP
+
 namespace
 {
 QT_WARNING_PUSH
@@ -70,12 +81,13 @@ Q_GLOBAL_STATIC_WITH_ARGS(const QString, mCI, ("CI"_L1)) // NOLINT circle
 
 QT_WARNING_POP
 
+// Default plating measurement in the HP-GL(HP-GL/2) graphics mode is 1/1016"(0.025mm).
+constexpr qreal plotterUnitsPerMm = 40.;
+
 //---------------------------------------------------------------------------------------------------------------------
 constexpr auto ConvertPixels(qreal pix) -> qreal
 {
-    // Default plating measurement in the HP-GL(HP-GL/2) graphics mode is 1/1016"(0.025mm).
-    // 40 plotter units = 1 mm
-    return FromPixel(pix, Unit::Mm) * 40.;
+    return FromPixel(pix, Unit::Mm) * plotterUnitsPerMm;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -345,8 +357,45 @@ void VHPGLEngine::GenerateHPGLHeader(QTextStream &out)
 //---------------------------------------------------------------------------------------------------------------------
 void VHPGLEngine::ExportDetails(QTextStream &out, const QList<VLayoutPiece> &details)
 {
-    for (auto detail : details)
+    // Strokes are collected first and plotted in the order that gives the shortest pen up travel. Pieces with different
+    // priority are never mixed, the order of priorities is kept.
+    qreal travelBefore = 0;
+    qreal travelAfter = 0;
+    QPoint pos = m_currentPos;
+
+    auto PlotGroup = [this, &out, &travelBefore, &travelAfter, &pos]()
     {
+        // Pen up moves that were not followed by pen down plot nothing
+        m_strokes.erase(std::remove_if(m_strokes.begin(), m_strokes.end(),
+                                       [](const VHPGLStroke &stroke)
+                                       { return stroke.points.size() == 1 && stroke.mnemonic.isEmpty(); }),
+                        m_strokes.end());
+
+        const QVector<VHPGLStroke> strokes = VHPGLPenTravel::Optimize(m_strokes, pos);
+        travelBefore += VHPGLPenTravel::Travel(m_strokes, pos);
+        travelAfter += VHPGLPenTravel::Travel(strokes, pos);
+
+        m_recordStrokes = false;
+        PlotStrokes(out, strokes);
+        m_recordStrokes = true;
+
+        if (not strokes.isEmpty())
+        {
+            pos = strokes.constLast().End();
+        }
+        m_strokes.clear();
+    };
+
+    m_recordStrokes = true;
+
+    for (int i = 0; i < details.size(); ++i)
+    {
+        VLayoutPiece detail = details.at(i);
+        if (i > 0 && detail.GetPriority() != details.at(i - 1).GetPriority())
+        {
+            PlotGroup();
+        }
+
         detail.Scale(m_xscale, m_yscale);
 
         PlotSeamAllowance(out, detail);
@@ -359,6 +408,12 @@ void VHPGLEngine::ExportDetails(QTextStream &out, const QList<VLayoutPiece> &det
         PlotLabels(out, detail);
         PlotFoldLine(out, detail);
     }
+
+    PlotGroup();
+    m_recordStrokes = false;
+
+    qCDebug(vHPGL, "Pen up travel %.1f mm, optimized %.1f mm.", travelBefore / plotterUnitsPerMm,
+            travelAfter / plotterUnitsPerMm);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -369,6 +424,25 @@ void VHPGLEngine::GenerateHPGLFooter(QTextStream &out)
     HPComand(out, *mPG);             // Page Feed
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VHPGLEngine::PlotStrokes(QTextStream &out, const QVector<VHPGLStroke> &strokes)
+{
+    for (const auto &stroke : strokes)
+    {
+        HPPenUp(out, stroke.Start());
+
+        for (int i = 1; i < stroke.points.size(); ++i)
+        {
+            HPPenDown(out, stroke.points.at(i));
+        }
+
+        if (not stroke.mnemonic.isEmpty())
+        {
+            HPComand(out, stroke.mnemonic, stroke.parameters);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VHPGLEngine::PlotSewLine(QTextStream &out, const VLayoutPiece &detail)
 {
@@ -757,7 +831,7 @@ void VHPGLEngine::PlotLabelOutlineFont(QTextStream &out, const VLayoutPiece &det
         }
         else
         {
-            path.addText(0, static_cast<qreal>(fm.ascent()), fnt, qsText);
+            path.addPath(VTextPathCache::OutlineText(QPointF(0, fm.ascent()), fnt, qsText));
         }
 
         PlotPainterPath(out, lineMatrix.map(path), Qt::SolidLine);
@@ -929,12 +1003,28 @@ void VHPGLEngine::PlotPainterPath(QTextStream &out, const QPainterPath &path, Qt
 void VHPGLEngine::PlotCircle(QTextStream &out, const QPointF &center, qreal radius)
 {
     HPPenUp(out, ConvertPoint(center).toPoint());
+
+    if (m_recordStrokes)
+    {
+        m_strokes.last().mnemonic = *mCI;
+        m_strokes.last().parameters = QString::number(qFloor(ConvertPixels(radius)));
+        return;
+    }
+
     HPComand(out, *mCI, QString::number(qFloor(ConvertPixels(radius))));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VHPGLEngine::HPPenUp(QTextStream &out, QPoint point)
 {
+    if (m_recordStrokes)
+    {
+        VHPGLStroke stroke;
+        stroke.points.append(point);
+        m_strokes.append(stroke);
+        return;
+    }
+
     if (m_currentPos != point)
     {
         HPComand(out, *mPU, QStringLiteral("%1,%2").arg(point.x()).arg(point.y()));
@@ -955,6 +1045,12 @@ void VHPGLEngine::HPPenUp(QTextStream &out)
 //---------------------------------------------------------------------------------------------------------------------
 void VHPGLEngine::HPPenDown(QTextStream &out, QPoint point)
 {
+    if (m_recordStrokes)
+    {
+        m_strokes.last().points.append(point);
+        return;
+    }
+
     if (m_currentPos != point)
     {
         HPComand(out, *mPD, QStringLiteral("%1,%2").arg(point.x()).arg(point.y()));
@@ -969,6 +1065,12 @@ void VHPGLEngine::HPPenDown(QTextStream &out, QPoint point)
 //---------------------------------------------------------------------------------------------------------------------
 void VHPGLEngine::HPPenDown(QTextStream &out)
 {
+    if (m_recordStrokes)
+    {
+        m_strokes.last().mnemonic = *mPD;
+        return;
+    }
+
     HPComand(out, *mPD);
 }
 
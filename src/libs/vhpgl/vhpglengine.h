@@ -33,6 +33,8 @@
 #include <QString>
 #include <QtMath>
 
+#include "vhpglpentravel.h"
+
 class VLayoutPiece;
 class VLayoutPoint;
 class QTextStream;
@@ -97,6 +99,8 @@ private:
     qreal m_yscale{1};
     bool m_showGrainline{true};
     bool m_togetherWithNotches{false};
+    bool m_recordStrokes{false};
+    QVector<VHPGLStroke> m_strokes{};
 
     auto GenerateHPGL(const QVector<VLayoutPiece> &details) -> bool;
     auto GenerateHPGL2(const QVector<VLayoutPiece> &details) -> bool;
@@ -105,6 +109,7 @@ private:
     void GenerateHPGLHeader(QTextStream &out);
     void ExportDetails(QTextStream &out, const QList<VLayoutPiece> &details);
     void GenerateHPGLFooter(QTextStream &out);
+    void PlotStrokes(QTextStream &out, const QVector<VHPGLStroke> &strokes);
 
     void PlotSewLine(QTextStream &out, const VLayoutPiece &detail);
     void PlotSeamAllowance(QTextStream &out, const VLayoutPiece &detail);
@@ -0,0 +1,217 @@
+/************************************************************************
+ **
+ **  @file   vhpglpentravel.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vhpglpentravel.h"
+
+#include <QLineF>
+#include <algorithm>
+#include <limits>
+
+#include "../vmisc/defglobal.h"
+
+namespace
+{
+// 2-opt looks for a better position of a stroke only among the closest strokes in the current order. Far reversals are
+// rarely profitable after the nearest neighbour pass and make the pass quadratic.
+constexpr vsizetype maxTwoOptSpan = 500;
+constexpr int maxTwoOptPasses = 10;
+// Smallest gain worth a move, in plotter units. Protects from cycling on rounding noise.
+constexpr qreal minTwoOptGain = 0.5;
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto Distance(QPoint p1, QPoint p2) -> qreal
+{
+    return QLineF(p1, p2).length();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto SquaredDistance(QPoint p1, QPoint p2) -> qint64
+{
+    const qint64 dx = static_cast<qint64>(p2.x()) - p1.x();
+    const qint64 dy = static_cast<qint64>(p2.y()) - p1.y();
+    return dx * dx + dy * dy;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ReverseRange(QVector<VHPGLStroke> &strokes, vsizetype first, vsizetype last)
+{
+    std::reverse(strokes.begin() + first, strokes.begin() + last + 1);
+    for (vsizetype i = first; i <= last; ++i)
+    {
+        strokes[i].Reverse();
+    }
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+void VHPGLStroke::Reverse()
+{
+    if (IsReversible())
+    {
+        std::reverse(points.begin(), points.end());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Travel calculates pen up travel needed to plot strokes in the given order.
+ * @param strokes strokes.
+ * @param from pen position before the first stroke.
+ * @return travel in plotter units.
+ */
+auto VHPGLPenTravel::Travel(const QVector<VHPGLStroke> &strokes, QPoint from) -> qreal
+{
+    qreal travel = 0;
+    QPoint pos = from;
+
+    for (const auto &stroke : strokes)
+    {
+        travel += Distance(pos, stroke.Start());
+        pos = stroke.End();
+    }
+
+    return travel;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Optimize reorders strokes to minimize pen up travel.
+ * @param strokes strokes in the original order. Each stroke must have at least one point.
+ * @param from pen position before the first stroke.
+ * @return the same strokes in the new order. Never longer than the original order.
+ */
+auto VHPGLPenTravel::Optimize(const QVector<VHPGLStroke> &strokes, QPoint from) -> QVector<VHPGLStroke>
+{
+    if (strokes.size() < 2)
+    {
+        return strokes;
+    }
+
+    QVector<VHPGLStroke> ordered = NearestNeighbour(strokes, from);
+    TwoOpt(ordered, from);
+
+    // Heuristics do not guarantee the result. Keep the original order if it is already better.
+    return Travel(ordered, from) < Travel(strokes, from) ? ordered : strokes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VHPGLPenTravel::NearestNeighbour(const QVector<VHPGLStroke> &strokes, QPoint from) -> QVector<VHPGLStroke>
+{
+    QVector<VHPGLStroke> remaining = strokes;
+    QVector<VHPGLStroke> ordered;
+    ordered.reserve(strokes.size());
+
+    QPoint pos = from;
+
+    while (not remaining.isEmpty())
+    {
+        vsizetype best = 0;
+        bool reverse = false;
+        qint64 bestDistance = std::numeric_limits<qint64>::max();
+
+        for (vsizetype i = 0; i < remaining.size() && bestDistance > 0; ++i)
+        {
+            const VHPGLStroke &stroke = remaining.at(i);
+
+            if (const qint64 distance = SquaredDistance(pos, stroke.Start()); distance < bestDistance)
+            {
+                best = i;
+                reverse = false;
+                bestDistance = distance;
+            }
+
+            if (stroke.IsReversible())
+            {
+                if (const qint64 distance = SquaredDistance(pos, stroke.End()); distance < bestDistance)
+                {
+                    best = i;
+                    reverse = true;
+                    bestDistance = distance;
+                }
+            }
+        }
+
+        VHPGLStroke stroke = remaining.at(best);
+        remaining.swapItemsAt(best, remaining.size() - 1);
+        remaining.removeLast();
+
+        if (reverse)
+        {
+            stroke.Reverse();
+        }
+
+        pos = stroke.End();
+        ordered.append(stroke);
+    }
+
+    return ordered;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VHPGLPenTravel::TwoOpt(QVector<VHPGLStroke> &strokes, QPoint from)
+{
+    const vsizetype count = strokes.size();
+
+    // Reversing a part of the order plots each stroke of the part backwards. Count strokes that do not allow it.
+    QVector<vsizetype> fixed(count + 1, 0);
+    for (vsizetype i = 0; i < count; ++i)
+    {
+        fixed[i + 1] = fixed.at(i) + (strokes.at(i).IsReversible() ? 0 : 1);
+    }
+
+    bool improved = true;
+    for (int pass = 0; improved && pass < maxTwoOptPasses; ++pass)
+    {
+        improved = false;
+
+        for (vsizetype i = 0; i < count; ++i)
+        {
+            const QPoint prev = i == 0 ? from : strokes.at(i - 1).End();
+            const vsizetype last = qMin(count - 1, i + maxTwoOptSpan);
+
+            for (vsizetype j = i; j <= last; ++j)
+            {
+                if (fixed.at(j + 1) - fixed.at(i) > 0)
+                {
+                    break;
+                }
+
+                const bool hasNext = j + 1 < count;
+                const qreal before = Distance(prev, strokes.at(i).Start()) +
+                                     (hasNext ? Distance(strokes.at(j).End(), strokes.at(j + 1).Start()) : 0);
+                const qreal after = Distance(prev, strokes.at(j).End()) +
+                                    (hasNext ? Distance(strokes.at(i).Start(), strokes.at(j + 1).Start()) : 0);
+
+                if (after < before - minTwoOptGain)
+                {
+                    ReverseRange(strokes, i, j);
+                    improved = true;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/************************************************************************
+ **
+ **  @file   vhpglpentravel.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VHPGLPENTRAVEL_H
+#define VHPGLPENTRAVEL_H
+
+#include <QPoint>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VHPGLStroke struct is a piece of plot made without lifting the pen.
+ *
+ * The pen moves up to the first point and goes down through the rest. A stroke can end with an extra command issued at
+ * the last position, for example a circle or a dot.
+ */
+struct VHPGLStroke
+{
+    QVector<QPoint> points{};
+    QString mnemonic{};
+    QString parameters{};
+
+    auto Start() const -> QPoint;
+    auto End() const -> QPoint;
+    auto IsReversible() const -> bool;
+    void Reverse();
+};
+
+/**
+ * @brief The VHPGLPenTravel class orders strokes to shorten pen up moves between them.
+ *
+ * Order is built with the nearest neighbour heuristic and refined with 2-opt. Both may plot a stroke in the opposite
+ * direction.
+ */
+class VHPGLPenTravel
+{
+public:
+    static auto Travel(const QVector<VHPGLStroke> &strokes, QPoint from) -> qreal;
+    static auto Optimize(const QVector<VHPGLStroke> &strokes, QPoint from) -> QVector<VHPGLStroke>;
+
+private:
+    static auto NearestNeighbour(const QVector<VHPGLStroke> &strokes, QPoint from) -> QVector<VHPGLStroke>;
+    static void TwoOpt(QVector<VHPGLStroke> &strokes, QPoint from);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VHPGLStroke::Start() const -> QPoint
+{
+    return points.constFirst();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VHPGLStroke::End() const -> QPoint
+{
+    return points.constLast();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VHPGLStroke::IsReversible() const -> bool
+{
+    return mnemonic.isEmpty() || points.size() == 1;
+}
+
+#endif // VHPGLPENTRAVEL_H
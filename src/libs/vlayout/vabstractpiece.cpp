@@ -42,6 +42,7 @@
 #include "vlayoutpiecepath.h"
 #include "vrawsapoint.h"
 
+#include <QAtomicInteger>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -59,6 +60,13 @@ const qreal maxL = 3.5;
 
 namespace
 {
+//---------------------------------------------------------------------------------------------------------------------
+auto NextRevision() -> quint64
+{
+    static QAtomicInteger<quint64> revision{0};
+    return ++revision;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 inline auto IsSameDirection(QPointF p1, QPointF p2, QPointF px) -> bool
 {
@@ -1351,6 +1359,7 @@ auto operator<<(QDataStream &dataStream, const VAbstractPiece &piece) -> QDataSt
 auto operator>>(QDataStream &dataStream, VAbstractPiece &piece) -> QDataStream &
 {
     dataStream >> *piece.d;
+    piece.Modified();
     return dataStream;
 }
 
@@ -1390,6 +1399,24 @@ auto VAbstractPiece::operator=(VAbstractPiece &&piece) noexcept -> VAbstractPiec
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractPiece::~VAbstractPiece() = default;
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Revision returns the number of the last change of the piece.
+ *
+ * Every setter takes a new number from a counter shared by all pieces, so two pieces with equal revisions are copies
+ * of the same state. Derived classes call Modified() from their own setters. Used to key caches of derived geometry.
+ */
+auto VAbstractPiece::Revision() const -> quint64
+{
+    return d->m_revision;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAbstractPiece::Modified()
+{
+    d->m_revision = NextRevision();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VAbstractPiece::GetName() const -> QString
 {
@@ -1400,6 +1427,7 @@ auto VAbstractPiece::GetName() const -> QString
 void VAbstractPiece::SetName(const QString &value)
 {
     d->m_name = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1417,6 +1445,8 @@ void VAbstractPiece::SetForbidFlipping(bool value)
     {
         d->m_forceFlipping = not value;
     }
+
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1434,6 +1464,8 @@ void VAbstractPiece::SetForceFlipping(bool value)
     {
         d->m_forbidFlipping = not value;
     }
+
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1446,6 +1478,7 @@ auto VAbstractPiece::IsSymmetricalCopy() const -> bool
 void VAbstractPiece::SetSymmetricalCopy(bool value)
 {
     d->m_symmetricalCopy = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1458,6 +1491,7 @@ auto VAbstractPiece::IsFollowGrainline() const -> bool
 void VAbstractPiece::SetFollowGrainline(bool value)
 {
     d->m_followGrainline = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1470,6 +1504,7 @@ auto VAbstractPiece::IsSeamAllowance() const -> bool
 void VAbstractPiece::SetSeamAllowance(bool value)
 {
     d->m_seamAllowance = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1482,6 +1517,7 @@ auto VAbstractPiece::IsSeamAllowanceBuiltIn() const -> bool
 void VAbstractPiece::SetSeamAllowanceBuiltIn(bool value)
 {
     d->m_seamAllowanceBuiltIn = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1494,6 +1530,7 @@ auto VAbstractPiece::IsHideMainPath() const -> bool
 void VAbstractPiece::SetHideMainPath(bool value)
 {
     d->m_hideMainPath = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1506,6 +1543,7 @@ auto VAbstractPiece::IsSewLineOnDrawing() const -> bool
 void VAbstractPiece::SetSewLineOnDrawing(bool value)
 {
     d->m_onDrawing = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1518,6 +1556,7 @@ auto VAbstractPiece::IsShowFullPiece() const -> bool
 void VAbstractPiece::SetShowFullPiece(bool value)
 {
     d->m_showFullPiece = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1530,6 +1569,7 @@ auto VAbstractPiece::IsTrueZeroWidth() const -> bool
 void VAbstractPiece::SetTrueZeroWidth(bool value)
 {
     d->m_trueZeroWidth = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1542,6 +1582,7 @@ auto VAbstractPiece::GetSAWidth() const -> qreal
 void VAbstractPiece::SetSAWidth(qreal value)
 {
     value >= 0 ? d->m_width = value : d->m_width = 0;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1875,6 +1916,7 @@ auto VAbstractPiece::GetMx() const -> qreal
 void VAbstractPiece::SetMx(qreal value)
 {
     d->m_mx = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1887,6 +1929,7 @@ auto VAbstractPiece::GetMy() const -> qreal
 void VAbstractPiece::SetMy(qreal value)
 {
     d->m_my = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1899,6 +1942,7 @@ auto VAbstractPiece::GetPriority() const -> uint
 void VAbstractPiece::SetPriority(uint value)
 {
     d->m_priority = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1911,6 +1955,7 @@ auto VAbstractPiece::GetFoldLineType() const -> FoldLineType
 void VAbstractPiece::SetFoldLineType(FoldLineType lineType)
 {
     d->m_foldLineType = lineType;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1923,6 +1968,7 @@ auto VAbstractPiece::GetFoldLineSvgFontSize() const -> unsigned int
 void VAbstractPiece::SetFoldLineSvgFontSize(unsigned int size)
 {
     d->m_foldLineSvgFontSize = size;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1935,6 +1981,7 @@ auto VAbstractPiece::IsFoldLineLabelFontItalic() const -> bool
 void VAbstractPiece::SetFoldLineLabelFontItalic(bool value)
 {
     d->m_foldLineLabelFontItalic = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1947,6 +1994,7 @@ auto VAbstractPiece::IsFoldLineLabelFontBold() const -> bool
 void VAbstractPiece::SetFoldLineLabelFontBold(bool value)
 {
     d->m_foldLineLabelFontBold = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1959,6 +2007,7 @@ auto VAbstractPiece::GetFoldLineLabel() const -> QString
 void VAbstractPiece::SetFoldLineLabel(const QString &value)
 {
     d->m_foldLineLabel = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1971,6 +2020,7 @@ auto VAbstractPiece::GetFoldLineLabelAlignment() const -> int
 void VAbstractPiece::SetFoldLineLabelAlignment(int alignment)
 {
     d->m_foldLineLabelAlignment = alignment;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1983,6 +2033,7 @@ bool VAbstractPiece::IsShowMirrorLine() const
 void VAbstractPiece::SetShowMirrorLine(bool show)
 {
     d->m_showMirrorLine = show;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1995,6 +2046,7 @@ auto VAbstractPiece::GetUUID() const -> QUuid
 void VAbstractPiece::SetUUID(const QUuid &uuid)
 {
     d->m_uuid = uuid;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2002,6 +2054,8 @@ void VAbstractPiece::SetUUID(const QString &uuid)
 {
     const auto temp = QUuid(uuid);
     d->m_uuid = temp.isNull() ? QUuid::createUuid() : temp;
+
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -157,6 +157,8 @@ public:
      */
     virtual auto GetUniqueID() const -> QString;
 
+    auto Revision() const -> quint64;
+
     static auto Equidistant(QVector<VSAPoint> points, qreal width, bool trueZeroWidth, const QString &name)
         -> QVector<VLayoutPoint>;
     static auto SumTrapezoids(const QVector<QPointF> &points) -> qreal;
@@ -223,6 +225,8 @@ public:
         -> QLineF;
 
 protected:
+    void Modified();
+
     static auto IsEkvPointOnLine(const QPointF &iPoint, const QPointF &prevPoint, const QPointF &nextPoint) -> bool;
     static auto IsEkvPointOnLine(const VSAPoint &iPoint, const VSAPoint &prevPoint, const VSAPoint &nextPoint) -> bool;
     template <class T>
@@ -80,6 +80,9 @@ public:
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     FoldLineType m_foldLineType{FoldLineType::TwoArrowsTextAbove};
 
+    /** @brief m_revision number of the last change. Not stored, only identifies the state for caches. */
+    quint64 m_revision{0}; // NOLINT (misc-non-private-member-variables-in-classes)
+
 private:
     Q_DISABLE_ASSIGN_MOVE(VAbstractPieceData) // NOLINT
 
@@ -244,6 +244,12 @@ void VBank::SetDetails(const QVector<VLayoutPiece> &details)
     Reset();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VBank::GetDetails() const -> QVector<VLayoutPiece>
+{
+    return details;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VBank::GetNext() -> int
 {
@@ -452,6 +458,12 @@ void VBank::Reset()
     diagonal = 0;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VBank::GetCaseType() const -> Cases
+{
+    return caseType;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VBank::SetCaseType(Cases caseType)
 {
@@ -68,6 +68,7 @@ public:
     void SetNestQuantity(bool value);
 
     void SetDetails(const QVector<VLayoutPiece> &details);
+    auto GetDetails() const -> QVector<VLayoutPiece>;
     auto GetNext() -> int;
     auto GetDetail(int i) const -> VLayoutPiece;
 
@@ -77,6 +78,7 @@ public:
     auto PrepareUnsorted() -> bool;
     auto PrepareDetails(bool togetherWithNotches) -> bool;
     void Reset();
+    auto GetCaseType() const -> Cases;
     void SetCaseType(Cases caseType);
 
     auto AllDetailsCount() const -> vsizetype;
@@ -36,6 +36,7 @@
 #include "../vmisc/svgfont/vsvgfontdatabase.h"
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/vcommonsettings.h"
+#include "../vmisc/vtextpathcache.h"
 #include "../vmisc/vtranslator.h"
 #include "../vwidgets/vpiecegrainline.h"
 
@@ -636,7 +637,7 @@ auto VFoldLine::OutlineFontLabel(const QLineF &base, qreal width, qreal textHeig
         Swap(baseLine);
         baseLine.setAngle(baseLine.angle() + 90);
         baseLine.setLength(fm.descent() + CmToPixel(0.2));
-        labelPath.addText(QPointF(), font, label);
+        labelPath.addPath(VTextPathCache::OutlineText(QPointF(), font, label));
 
         labelPath = LabelTransform(labelPath, rotationCenter, baseLine.p2(), labelAngle).map(labelPath);
     }
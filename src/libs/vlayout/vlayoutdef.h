@@ -32,8 +32,11 @@
 #include <QPainterPath>
 #include <QSize>
 #include <QTransform>
+#include <atomic>
 #include <climits>
 
+#include "../vgeometry/vpolygonintersection.h"
+
 enum class LayoutExportFileFormat : qint8
 {
     SVG,
@@ -115,7 +118,7 @@ struct VBestSquareResData
 struct VCachedPositions
 {
     QRectF boundingRect{};              // NOLINT(misc-non-private-member-variables-in-classes)
-    QPainterPath layoutAllowancePath{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    VPolygonEdges layoutAllowance{};    // NOLINT(misc-non-private-member-variables-in-classes)
 };
 
 enum class Cases : qint8
@@ -126,6 +129,35 @@ enum class Cases : qint8
     UnknownCase
 };
 
+enum class NestingEngine : qint8
+{
+    ContourSliding = 0,
+    NoFitPolygon = 1,
+    UnknownEngine
+};
+
+/**
+ * @brief The VLayoutCounters struct counts work done by nesting. Positions are searched in several threads, so all
+ * counters are atomic.
+ */
+struct VLayoutCounters
+{
+    /** @brief placements positions of a piece evaluated on a sheet. */
+    std::atomic<qint64> placements{0}; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    /** @brief collisionChecks tests of a positioned piece against already arranged pieces. */
+    std::atomic<qint64> collisionChecks{0}; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    void CountPlacement() { placements.fetch_add(1, std::memory_order_relaxed); }
+    void CountCollisionCheck() { collisionChecks.fetch_add(1, std::memory_order_relaxed); }
+
+    void Reset()
+    {
+        placements.store(0);
+        collisionChecks.store(0);
+    }
+};
+
 /* Warning! Debugging doesn't work stable in debug mode. If you need big allocation use release mode. Or disable
  * Address Sanitizer. See page https://bitbucket.org/dismine/valentina/wiki/developers/Address_Sanitizer
  */
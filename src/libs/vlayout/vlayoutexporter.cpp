@@ -34,10 +34,13 @@
 #include <QGuiApplication>
 #include <QImageWriter>
 #include <QPainter>
+#include <QPicture>
 #include <QPrinter>
 #include <QProcess>
 #include <QSvgGenerator>
 #include <QTemporaryFile>
+#include <QThread>
+#include <QtConcurrent>
 #include <QtDebug>
 #include <QtMath>
 
@@ -71,6 +74,9 @@ Q_GLOBAL_STATIC_WITH_ARGS(const QString, PDFTOPS, ("pdftops"_L1)) // NOLINT
 
 QT_WARNING_POP
 
+// Height of a band rendered by one worker, in pixels. Keeps memory of each worker bounded on big sheets.
+constexpr int maxRenderBandHeight = 1024;
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief PrepareTextForDXF prepare QGraphicsSimpleTextItem items for export to
@@ -206,7 +212,7 @@ void VLayoutExporter::ExportToPNG(QGraphicsScene *scene, const QList<QGraphicsIt
     drawingSize.setWidth(qFloor(m_imageRect.width() * m_xScale + m_margins.left() + m_margins.right()));
     drawingSize.setHeight(qFloor(m_imageRect.height() * m_yScale + m_margins.top() + m_margins.bottom()));
 
-    QImage image(drawingSize, QImage::Format_ARGB32);
+    const QImage image = RenderImage(scene);
     if (image.isNull())
     {
         qCritical() << qUtf8Printable(tr("Can't create an image %1x%2 for '%3'. The image is too large or empty.")
@@ -216,16 +222,7 @@ void VLayoutExporter::ExportToPNG(QGraphicsScene *scene, const QList<QGraphicsIt
         RestoreGrainlineAfterExport(details);
         return;
     }
-    image.fill(Qt::white);
 
-    QPainter painter(&image);
-    painter.translate(m_margins.left(), m_margins.top());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setPen(m_pen);
-    painter.setBrush(QBrush(Qt::NoBrush));
-    painter.scale(m_xScale, m_yScale);
-
-    scene->render(&painter, m_imageRect, m_imageRect, Qt::IgnoreAspectRatio);
     image.save(m_fileName);
 
     RestoreGrainlineAfterExport(details);
@@ -243,7 +240,7 @@ void VLayoutExporter::ExportToTIF(QGraphicsScene *scene, const QList<QGraphicsIt
     drawingSize.setWidth(qFloor(m_imageRect.width() * m_xScale + m_margins.left() + m_margins.right()));
     drawingSize.setHeight(qFloor(m_imageRect.height() * m_yScale + m_margins.top() + m_margins.bottom()));
 
-    QImage image(drawingSize, QImage::Format_ARGB32);
+    const QImage image = RenderImage(scene);
     if (image.isNull())
     {
         qCritical() << qUtf8Printable(tr("Can't create an image %1x%2 for '%3'. The image is too large or empty.")
@@ -253,16 +250,6 @@ void VLayoutExporter::ExportToTIF(QGraphicsScene *scene, const QList<QGraphicsIt
         RestoreGrainlineAfterExport(details);
         return;
     }
-    image.fill(Qt::white);
-
-    QPainter painter(&image);
-    painter.translate(m_margins.left(), m_margins.top());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setPen(m_pen);
-    painter.setBrush(QBrush(Qt::NoBrush));
-    painter.scale(m_xScale, m_yScale);
-
-    scene->render(&painter, m_imageRect, m_imageRect, Qt::IgnoreAspectRatio);
 
     QImageWriter writer;
     writer.setFormat("TIF");
@@ -279,6 +266,92 @@ void VLayoutExporter::ExportToTIF(QGraphicsScene *scene, const QList<QGraphicsIt
     RestoreGrainlineAfterExport(details);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RenderImage renders the scene into an image of the export size.
+ *
+ * The image is split into horizontal bands. On the calling thread each band records into its own QPicture only the
+ * part of the scene it shows. The bands are rasterized from these recordings in a thread pool directly into the
+ * scanlines of the result.
+ * @param scene scene to render.
+ * @return image, null image if it cannot be allocated.
+ */
+auto VLayoutExporter::RenderImage(QGraphicsScene *scene) const -> QImage
+{
+    QSize drawingSize;
+    drawingSize.setWidth(qFloor(m_imageRect.width() * m_xScale + m_margins.left() + m_margins.right()));
+    drawingSize.setHeight(qFloor(m_imageRect.height() * m_yScale + m_margins.top() + m_margins.bottom()));
+
+    QImage image(drawingSize, QImage::Format_ARGB32);
+    if (image.isNull())
+    {
+        return image;
+    }
+
+    const int width = drawingSize.width();
+    const int height = drawingSize.height();
+    const int bandHeight = qBound(1, qCeil(height / static_cast<qreal>(QThread::idealThreadCount())),
+                                  maxRenderBandHeight);
+
+    struct RenderBand
+    {
+        int top{0};
+        int lines{0};
+        QPicture picture{};
+    };
+
+    // The scene may be touched only from this thread. Antialiasing reaches one pixel over the border of a band, so
+    // each band records one line more on each side than it shows.
+    const qreal overlap = 1. / m_yScale;
+    QVector<RenderBand> bands;
+    for (int top = 0; top < height; top += bandHeight)
+    {
+        RenderBand band;
+        band.top = top;
+        band.lines = qMin(bandHeight, height - top);
+
+        const qreal sceneTop = (top - m_margins.top()) / m_yScale - overlap;
+        const qreal sceneBottom = (top + band.lines - m_margins.top()) / m_yScale + overlap;
+        const QRectF bandRect = m_imageRect.intersected(
+            QRectF(QPointF(m_imageRect.left(), sceneTop), QPointF(m_imageRect.right(), sceneBottom)));
+
+        if (not bandRect.isEmpty())
+        {
+            QPainter painter(&band.picture);
+            painter.translate(m_margins.left(), m_margins.top() - top);
+            painter.setRenderHint(QPainter::Antialiasing, true);
+            painter.setPen(m_pen);
+            painter.setBrush(QBrush(Qt::NoBrush));
+            painter.scale(m_xScale, m_yScale);
+            scene->render(&painter, bandRect, bandRect, Qt::IgnoreAspectRatio);
+            painter.end();
+        }
+
+        bands.append(band);
+    }
+
+    // Workers paint different lines of the result. Take the pointer once to avoid detaching from several threads.
+    uchar *bits = image.bits();
+    const auto bytesPerLine = image.bytesPerLine();
+
+    QtConcurrent::blockingMap(bands,
+                              [bits, bytesPerLine, width](RenderBand &band)
+                              {
+                                  // The band shares the scanlines of the result, so nothing is copied after painting.
+                                  QImage bandImage(bits + static_cast<vsizetype>(band.top) * bytesPerLine, width,
+                                                   band.lines, bytesPerLine, QImage::Format_ARGB32);
+                                  bandImage.fill(Qt::white);
+
+                                  QPainter painter(&bandImage);
+                                  painter.drawPicture(0, 0, band.picture);
+                                  painter.end();
+
+                                  band.picture = QPicture(); // Release the recording as soon as possible
+                              });
+
+    return image;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutExporter::ExportToPDF(QGraphicsScene *scene, const QList<QGraphicsItem *> &details) const
 {
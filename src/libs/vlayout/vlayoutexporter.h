@@ -39,6 +39,7 @@
 
 class QGraphicsScene;
 class QGraphicsItem;
+class QImage;
 class VLayoutPiece;
 
 class VLayoutExporter
@@ -149,6 +150,7 @@ private:
     DXFApparelCompatibility m_dxfCompatibility{DXFApparelCompatibility::STANDARD};
 
     void ExportToPDF(QGraphicsScene *scene, const QList<QGraphicsItem *> &details, const QString &filename) const;
+    auto RenderImage(QGraphicsScene *scene) const -> QImage;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -31,14 +31,60 @@
 #include <QElapsedTimer>
 #include <QGraphicsRectItem>
 #include <QRectF>
+#include <QThread>
 #include <QThreadPool>
 #include <QtMath>
+#include <functional>
+#include <limits>
 
 #include "../ifc/exception/vexceptionterminatedposition.h"
 #include "../vmisc/compatibility.h"
 #include "../vmisc/def.h"
 #include "vlayoutpaper.h"
 #include "vlayoutpiece.h"
+#include "vnofitpolygon.h"
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wunused-member-function")
+
+Q_GLOBAL_STATIC(QThreadPool, multiStartThreadPool) // NOLINT
+
+QT_WARNING_POP
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LayoutScore packs sheets count and efficiency into one number, the lower the better. Fewer sheets always win,
+ * efficiency in percents decides between layouts with the same sheets count.
+ */
+auto LayoutScore(vsizetype papersCount, qreal efficiency) -> qint64
+{
+    constexpr qint64 efficiencyRange = 100000;
+    const qint64 efficiencyPart = qRound64(qBound(0.0, efficiency, 100.0) * 1000);
+    return static_cast<qint64>(papersCount) * (efficiencyRange + 1) + (efficiencyRange - efficiencyPart);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto PapersEfficiency(const QVector<VLayoutPaper> &papers) -> qreal
+{
+    qreal square = 0;
+    qreal area = 0;
+    for (const auto &paper : papers)
+    {
+        const QVector<VLayoutPiece> details = paper.GetDetails();
+        for (const auto &detail : details)
+        {
+            square += static_cast<qreal>(detail.Square());
+        }
+
+        const QRectF rect = paper.DetailsBoundingRect();
+        area += rect.width() * rect.height();
+    }
+
+    return qFuzzyIsNull(area) ? 0 : square / area * 100.0;
+}
+} // namespace
 
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutGenerator::VLayoutGenerator(QObject *parent)
@@ -56,12 +102,14 @@ VLayoutGenerator::~VLayoutGenerator()
 void VLayoutGenerator::SetDetails(const QVector<VLayoutPiece> &details)
 {
     bank->SetDetails(details);
+    nfpCache.clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::SetLayoutWidth(qreal width)
 {
     bank->SetLayoutWidth(width);
+    nfpCache.clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -103,6 +151,7 @@ void VLayoutGenerator::Generate(const QElapsedTimer &timer, qint64 timeout, Layo
     papers.clear();
     bank->Reset();
     state = previousState;
+    counters->Reset();
 
     int width = PageWidth();
     int height = PageHeight();
@@ -141,116 +190,281 @@ void VLayoutGenerator::Generate(const QElapsedTimer &timer, qint64 timeout, Layo
         return;
     }
 
-    if (bank->PrepareUnsorted())
+    if (nestingEngine == NestingEngine::NoFitPolygon && nfpCache.isNull())
+    {
+        // Pieces and their layout allowance don't change between runs, keep no-fit polygons for the next one.
+        nfpCache = QSharedPointer<VNoFitPolygonCache>::create();
+    }
+
+    const VLayoutAttemptResult result =
+        multiStart ? ArrangeMultiStart(width, height, timer, timeout)
+                   : Arrange(bank,
+                             {.caseType = bank->GetCaseType(),
+                              .rotate = rotate,
+                              .rotationNumber = rotationNumber,
+                              .shift = shift},
+                             width, height, timer, timeout, nullptr);
+
+    if (not result.completed)
     {
-        if (HasExpired())
+        if (result.state != LayoutErrors::NoError)
         {
-            return;
+            state = result.state;
+        }
+        else if (result.expired)
+        {
+            Timeout();
         }
+        return;
+    }
+
+    papers = result.papers;
 
-        while (bank->AllDetailsCount() > 0)
+    if (HasExpired())
+    {
+        return;
+    }
+
+    if (stripOptimizationEnabled)
+    {
+        GatherPages();
+    }
+
+    if (autoCropWidth)
+    {
+        OptimizeWidth();
+    }
+
+    if (IsUnitePages())
+    {
+        UnitePages();
+    }
+
+    if (result.failed == 0)
+    {
+        state = LayoutErrors::NoError;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Arrange does one greedy layout pass. Details are taken from the bank one by one and put on the first sheet
+ * they fit, new sheet is opened when nothing else fits.
+ * @param attemptBank bank with details to arrange.
+ * @param attempt settings of the pass.
+ * @param width sheet width.
+ * @param height sheet height.
+ * @param timer nesting timer.
+ * @param timeout nesting time limit.
+ * @param bestScore score of the best finished pass in multi-start mode, nullptr otherwise. The pass stops as soon as
+ * it cannot beat it.
+ * @return result of the pass.
+ */
+auto VLayoutGenerator::Arrange(VBank *attemptBank, const VLayoutAttempt &attempt, int width, int height,
+                               const QElapsedTimer &timer, qint64 timeout, std::atomic<qint64> *bestScore)
+    -> VLayoutAttemptResult
+{
+    VLayoutAttemptResult result;
+
+    auto Interrupted = [this, &result, &timer, timeout]()
+    {
+        if (stopGeneration.load())
         {
-            if (stopGeneration.load())
-            {
-                return;
-            }
+            return true;
+        }
 
-            if (HasExpired())
-            {
-                return;
-            }
+        if (timer.hasExpired(timeout))
+        {
+            result.expired = true;
+            return true;
+        }
+        return false;
+    };
 
-            VLayoutPaper paper(height, width, bank->GetLayoutWidth());
-            paper.SetShift(shift);
-            paper.SetPaperIndex(static_cast<quint32>(papers.count()));
-            paper.SetRotate(rotate);
-            paper.SetFollowGrainline(followGrainline);
-            paper.SetRotationNumber(rotationNumber);
-            paper.SetSaveLength(saveLength);
-            paper.SetOriginPaperPortrait(IsPortrait());
-            do
-            {
-                const int index = bank->GetNext();
-                try
-                {
-                    if (paper.ArrangeDetail(bank->GetDetail(index), stopGeneration))
-                    {
-                        bank->Arranged(index);
-                    }
-                    else
-                    {
-                        bank->NotArranged(index);
-                    }
-                }
-                catch (const VExceptionTerminatedPosition &e)
-                {
-                    qCritical() << e.ErrorMessage();
-                    state = LayoutErrors::TerminatedByException;
-                    return;
-                }
+    if (not attemptBank->PrepareUnsorted())
+    {
+        result.state = LayoutErrors::PrepareLayoutError;
+        return result;
+    }
+
+    if (Interrupted())
+    {
+        return result;
+    }
 
-                if (stopGeneration.load())
+    while (attemptBank->AllDetailsCount() > 0)
+    {
+        if (Interrupted())
+        {
+            return result;
+        }
+
+        // One more sheet is needed. Stop if even a perfectly packed last sheet would lose to the best pass.
+        if (bestScore != nullptr && LayoutScore(result.papers.size() + 1, 100) >= bestScore->load())
+        {
+            return result;
+        }
+
+        VLayoutPaper paper(height, width, attemptBank->GetLayoutWidth());
+        paper.SetShift(attempt.shift);
+        paper.SetPaperIndex(static_cast<quint32>(result.papers.count()));
+        paper.SetRotate(attempt.rotate);
+        paper.SetFollowGrainline(followGrainline);
+        paper.SetRotationNumber(attempt.rotationNumber);
+        paper.SetSaveLength(saveLength);
+        paper.SetOriginPaperPortrait(IsPortrait());
+        paper.SetNestingEngine(nestingEngine);
+        paper.SetNoFitPolygonCache(nfpCache);
+        paper.SetCounters(counters);
+        do
+        {
+            const int index = attemptBank->GetNext();
+            try
+            {
+                if (paper.ArrangeDetail(attemptBank->GetDetail(index), stopGeneration))
                 {
-                    break;
+                    attemptBank->Arranged(index);
                 }
-
-                if (HasExpired())
+                else
                 {
-                    return;
+                    attemptBank->NotArranged(index);
                 }
-            } while (bank->LeftToArrange() > 0);
-
-            if (stopGeneration.load())
-            {
-                return;
             }
-
-            if (HasExpired())
+            catch (const VExceptionTerminatedPosition &e)
             {
-                return;
+                qCritical() << e.ErrorMessage();
+                result.state = LayoutErrors::TerminatedByException;
+                return result;
             }
 
-            if (paper.Count() > 0)
+            if (stopGeneration.load())
             {
-                papers.append(paper);
+                break;
             }
-            else
+
+            if (timer.hasExpired(timeout))
             {
-                state = LayoutErrors::EmptyPaperError;
-                return;
+                result.expired = true;
+                return result;
             }
+        } while (attemptBank->LeftToArrange() > 0);
+
+        if (Interrupted())
+        {
+            return result;
+        }
+
+        if (paper.Count() > 0)
+        {
+            result.papers.append(paper);
+        }
+        else
+        {
+            result.state = LayoutErrors::EmptyPaperError;
+            return result;
         }
     }
-    else
+
+    result.completed = true;
+    result.failed = attemptBank->FailedToArrange();
+    result.efficiency = PapersEfficiency(result.papers);
+
+    if (bestScore != nullptr && result.failed == 0)
     {
-        state = LayoutErrors::PrepareLayoutError;
-        return;
+        const qint64 score = LayoutScore(result.papers.size(), result.efficiency);
+        qint64 current = bestScore->load();
+        while (score < current && not bestScore->compare_exchange_weak(current, score))
+        {
+        }
     }
 
-    if (HasExpired())
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangeMultiStart runs independent layout passes in parallel and returns the best one.
+ *
+ * Each pass gets its own bank and its own mix of grouping case, rotation number and shift. The first pass uses the
+ * settings of a single run, so the result is never worse. Passes share the score of the best finished layout and give
+ * up once they need more sheets than it.
+ */
+auto VLayoutGenerator::ArrangeMultiStart(int width, int height, const QElapsedTimer &timer, qint64 timeout)
+    -> VLayoutAttemptResult
+{
+    const QVector<VLayoutPiece> details = bank->GetDetails();
+    const QVector<VLayoutAttempt> attempts = MultiStartAttempts();
+    std::atomic<qint64> bestScore{std::numeric_limits<qint64>::max()};
+
+    std::function<VLayoutAttemptResult(const VLayoutAttempt &attempt)> const Run =
+        [this, &details, width, height, &timer, timeout, &bestScore](const VLayoutAttempt &attempt)
     {
-        return;
-    }
+        VBank attemptBank;
+        attemptBank.SetLayoutWidth(bank->GetLayoutWidth());
+        attemptBank.SetManualPriority(bank->GetManualPriority());
+        attemptBank.SetCaseType(attempt.caseType);
+        attemptBank.SetDetails(details);
+        return Arrange(&attemptBank, attempt, width, height, timer, timeout, &bestScore);
+    };
 
-    if (stripOptimizationEnabled)
+    // Passes wait for their own position search on nestingThreadPool. Keep them on a separate pool to never block it.
+    QList<VLayoutAttemptResult> const results = MappedOnPool(multiStartThreadPool, attempts, Run);
+
+    const VLayoutAttemptResult *best = nullptr;
+    for (const auto &result : results)
     {
-        GatherPages();
+        if (not result.completed)
+        {
+            continue;
+        }
+
+        if (best == nullptr || result.failed < best->failed ||
+            (result.failed == best->failed && LayoutScore(result.papers.size(), result.efficiency) <
+                                                  LayoutScore(best->papers.size(), best->efficiency)))
+        {
+            best = &result;
+        }
     }
 
-    if (autoCropWidth)
+    if (best != nullptr)
     {
-        OptimizeWidth();
+        return *best;
     }
 
-    if (IsUnitePages())
+    for (const auto &result : results)
     {
-        UnitePages();
+        if (result.state != LayoutErrors::NoError || result.expired)
+        {
+            return result;
+        }
     }
 
-    if (bank->FailedToArrange() == 0)
+    return {};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutGenerator::MultiStartAttempts() const -> QVector<VLayoutAttempt>
+{
+    const int count = qMax(1, QThread::idealThreadCount());
+    const int casesCount = static_cast<int>(Cases::UnknownCase);
+    const int baseCase = static_cast<int>(bank->GetCaseType());
+
+    QVector<VLayoutAttempt> attempts;
+    attempts.reserve(count);
+
+    for (int i = 0; i < count; ++i)
     {
-        state = LayoutErrors::NoError;
+        const int round = i / casesCount;
+
+        VLayoutAttempt attempt;
+        attempt.caseType = static_cast<Cases>((baseCase + i) % casesCount);
+        attempt.rotate = rotate;
+        attempt.rotationNumber = rotate ? qMin(rotationNumber + round, 360) : rotationNumber;
+        attempt.shift = shift / static_cast<qreal>(1 << (round % 3));
+        attempts.append(attempt);
     }
+
+    return attempts;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -264,6 +478,24 @@ auto VLayoutGenerator::LayoutEfficiency() const -> qreal
     return efficiency;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PlacementsCount return number of piece positions evaluated by the last generation.
+ */
+auto VLayoutGenerator::PlacementsCount() const -> qint64
+{
+    return counters->placements.load();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CollisionChecksCount return number of collision tests against arranged pieces done by the last generation.
+ */
+auto VLayoutGenerator::CollisionChecksCount() const -> qint64
+{
+    return counters->collisionChecks.load();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutGenerator::State() const -> LayoutErrors
 {
@@ -376,6 +608,7 @@ auto VLayoutGenerator::IsBoundaryTogetherWithNotches() const -> bool
 void VLayoutGenerator::SetBoundaryTogetherWithNotches(bool value)
 {
     togetherWithNotches = value;
+    nfpCache.clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -390,6 +623,30 @@ void VLayoutGenerator::SetShowLayoutAllowance(bool value)
     showLayoutAllowance = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutGenerator::GetNestingEngine() const -> NestingEngine
+{
+    return nestingEngine;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetNestingEngine(NestingEngine engine)
+{
+    nestingEngine = engine;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutGenerator::IsMultiStart() const -> bool
+{
+    return multiStart;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetMultiStart(bool value)
+{
+    multiStart = value;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutGenerator::IsRotationNeeded() const -> bool
 {
@@ -33,6 +33,7 @@
 #include <QMargins>
 #include <QMetaObject>
 #include <QObject>
+#include <QSharedPointer>
 #include <QString>
 #include <QVector>
 #include <QtGlobal>
@@ -45,6 +46,7 @@
 
 class QGraphicsItem;
 class QElapsedTimer;
+class VNoFitPolygonCache;
 
 class VLayoutGenerator : public QObject
 {
@@ -83,6 +85,9 @@ public:
 
     auto LayoutEfficiency() const -> qreal;
 
+    auto PlacementsCount() const -> qint64;
+    auto CollisionChecksCount() const -> qint64;
+
     auto State() const -> LayoutErrors;
 
     auto PapersCount() const -> vsizetype;
@@ -138,6 +143,12 @@ public:
     auto IsShowLayoutAllowance() const -> bool;
     void SetShowLayoutAllowance(bool value);
 
+    auto GetNestingEngine() const -> NestingEngine;
+    void SetNestingEngine(NestingEngine engine);
+
+    auto IsMultiStart() const -> bool;
+    void SetMultiStart(bool value);
+
     auto IsRotationNeeded() const -> bool;
 
     auto IsPortrait() const -> bool;
@@ -148,6 +159,25 @@ public slots:
 
 private:
     Q_DISABLE_COPY_MOVE(VLayoutGenerator) // NOLINT
+
+    struct VLayoutAttempt
+    {
+        Cases caseType{Cases::CaseDesc};
+        bool rotate{true};
+        int rotationNumber{2};
+        qreal shift{0};
+    };
+
+    struct VLayoutAttemptResult
+    {
+        QVector<VLayoutPaper> papers{};
+        LayoutErrors state{LayoutErrors::NoError};
+        bool completed{false};
+        bool expired{false};
+        vsizetype failed{0};
+        qreal efficiency{0};
+    };
+
     QVector<VLayoutPaper> papers{};
     VBank *bank{new VBank()};
     qreal paperHeight{0};
@@ -179,6 +209,15 @@ private:
     int nestingTime{1};
     qreal efficiencyCoefficient{0.0};
     bool showLayoutAllowance{false};
+    NestingEngine nestingEngine{NestingEngine::ContourSliding};
+    QSharedPointer<VNoFitPolygonCache> nfpCache{};
+    bool multiStart{false};
+    QSharedPointer<VLayoutCounters> counters{QSharedPointer<VLayoutCounters>::create()};
+
+    auto Arrange(VBank *attemptBank, const VLayoutAttempt &attempt, int width, int height, const QElapsedTimer &timer,
+                 qint64 timeout, std::atomic<qint64> *bestScore) -> VLayoutAttemptResult;
+    auto ArrangeMultiStart(int width, int height, const QElapsedTimer &timer, qint64 timeout) -> VLayoutAttemptResult;
+    auto MultiStartAttempts() const -> QVector<VLayoutAttempt>;
 
     auto PageHeight() const -> int;
     auto PageWidth() const -> int;
@@ -51,6 +51,8 @@
 #include "vcontour.h"
 #include "vlayoutpaper_p.h"
 #include "vlayoutpiece.h"
+#include "vnfpposition.h"
+#include "vnofitpolygon.h"
 #include "vposition.h"
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -220,6 +222,30 @@ void VLayoutPaper::SetOriginPaperPortrait(bool portrait)
     d->originPaperOrientation = portrait;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutPaper::GetNestingEngine() const -> NestingEngine
+{
+    return d->nestingEngine;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPaper::SetNestingEngine(NestingEngine engine)
+{
+    d->nestingEngine = engine;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPaper::SetNoFitPolygonCache(const QSharedPointer<VNoFitPolygonCache> &cache)
+{
+    d->nfpCache = cache;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPaper::SetCounters(const QSharedPointer<VLayoutCounters> &counters)
+{
+    d->counters = counters;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPaper::ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop) -> bool
 {
@@ -239,6 +265,11 @@ auto VLayoutPaper::ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &s
         d->localRotationNumber = d->globalRotationNumber;
     }
 
+    if (d->nestingEngine == NestingEngine::NoFitPolygon)
+    {
+        return ArrangeDetailNoFitPolygon(detail, stop);
+    }
+
 #ifdef LAYOUT_DEBUG
     QMutex mutex;
 #endif
@@ -248,8 +279,9 @@ auto VLayoutPaper::ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &s
                                 .rotate = d->localRotate,
                                 .rotationNumber = d->localRotationNumber,
                                 .followGrainline = d->followGrainline,
-                                .positionsCache = d->positionsCache,
+                                .positionsIndex = d->positionsIndex,
                                 .isOriginPaperOrientationPortrait = d->originPaperOrientation,
+                                .counters = d->counters.data(),
 #ifdef LAYOUT_DEBUG
                                 .details = d->details,
                                 .mutex = &mutex
@@ -299,8 +331,8 @@ auto VLayoutPaper::SaveResult(const VBestSquare &bestResult, const VLayoutPiece
         d->globalContour.SetContour(newGContour);
 
         QVector<QPointF> const layoutPoints = workDetail.GetMappedLayoutAllowancePoints();
-        d->positionsCache.append({.boundingRect = VLayoutPiece::BoundingRect(layoutPoints),
-                                  .layoutAllowancePath = VGObject::PainterPath(layoutPoints)});
+        d->positionsIndex.Append({.boundingRect = VLayoutPiece::BoundingRect(layoutPoints),
+                                  .layoutAllowance = VPolygonEdges(layoutPoints)});
 
 #ifdef LAYOUT_DEBUG
 #ifdef SHOW_BEST
@@ -316,6 +348,55 @@ auto VLayoutPaper::SaveResult(const VBestSquare &bestResult, const VLayoutPiece
     return bestResult.HasValidResult(); // Do we have the best result?
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangeDetailNoFitPolygon place a piece with the no-fit polygon engine.
+ *
+ * The engine knows placed pieces from their hulls and the positions index, the global contour is neither used nor
+ * updated. From the sheet it takes only the size and the save length option. The shift is a sliding step and has no
+ * meaning here.
+ */
+auto VLayoutPaper::ArrangeDetailNoFitPolygon(const VLayoutPiece &detail, std::atomic_bool &stop) -> bool
+{
+    if (d->nfpCache.isNull())
+    {
+        d->nfpCache = QSharedPointer<VNoFitPolygonCache>::create();
+    }
+
+    const VNfpPositionData data = {.height = d->globalContour.GetHeight(),
+                                   .width = d->globalContour.GetWidth(),
+                                   .detail = detail,
+                                   .rotate = d->localRotate,
+                                   .rotationNumber = d->localRotationNumber,
+                                   .followGrainline = d->followGrainline,
+                                   .isOriginPaperOrientationPortrait = d->originPaperOrientation,
+                                   .saveLength = d->saveLength,
+                                   .positionsIndex = d->positionsIndex,
+                                   .placed = d->nfpPlaced,
+                                   .cache = d->nfpCache.data(),
+                                   .counters = d->counters.data()};
+
+    const VNfpBestResult result = VNfpPosition::ArrangeDetail(data, &stop);
+
+    if (result.valid)
+    {
+        d->details.append(result.detail);
+        d->nfpPlaced.append(result.placed);
+
+        QVector<QPointF> const layoutPoints = result.detail.GetMappedLayoutAllowancePoints();
+        d->positionsIndex.Append({.boundingRect = VLayoutPiece::BoundingRect(layoutPoints),
+                                  .layoutAllowance = VPolygonEdges(layoutPoints)});
+        return true;
+    }
+
+    if (not result.terminatedReason.isEmpty())
+    {
+        throw VExceptionTerminatedPosition(result.terminatedReason);
+    }
+
+    return false;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPaper::GetPaperItem(bool autoCropLength, bool autoCropWidth, bool textAsPaths, bool togetherWithNotches,
                                 bool showLayoutAllowance) const -> QGraphicsRectItem *
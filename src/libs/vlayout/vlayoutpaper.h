@@ -31,12 +31,14 @@
 
 #include <QGraphicsPathItem>
 #include <QSharedDataPointer>
+#include <QSharedPointer>
 #include <QTypeInfo>
 #include <QtCore/qcontainerfwd.h>
 #include <QtGlobal>
 #include <atomic>
 
 #include "../vmisc/defglobal.h"
+#include "vlayoutdef.h"
 
 class VBestSquare;
 class VLayoutPaperData;
@@ -45,6 +47,7 @@ class QGraphicsRectItem;
 class QRectF;
 class QGraphicsItem;
 class QMutex;
+class VNoFitPolygonCache;
 
 class VLayoutPaper
 {
@@ -89,6 +92,12 @@ public:
     auto IsOriginPaperPortrait() const -> bool;
     void SetOriginPaperPortrait(bool portrait);
 
+    auto GetNestingEngine() const -> NestingEngine;
+    void SetNestingEngine(NestingEngine engine);
+
+    void SetNoFitPolygonCache(const QSharedPointer<VNoFitPolygonCache> &cache);
+    void SetCounters(const QSharedPointer<VLayoutCounters> &counters);
+
     auto ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop) -> bool;
     auto Count() const -> vsizetype;
     Q_REQUIRED_RESULT auto GetPaperItem(bool autoCropLength, bool autoCropWidth, bool textAsPaths,
@@ -117,6 +126,8 @@ private:
                     QMutex *mutex
 #endif
                     ) -> bool;
+
+    auto ArrangeDetailNoFitPolygon(const VLayoutPiece &detail, std::atomic_bool &stop) -> bool;
 };
 
 Q_DECLARE_TYPEINFO(VLayoutPaper, Q_MOVABLE_TYPE); // NOLINT
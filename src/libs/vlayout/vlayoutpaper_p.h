@@ -31,10 +31,15 @@
 
 #include <QPointF>
 #include <QSharedData>
+#include <QSharedPointer>
 #include <QVector>
 
 #include "vcontour.h"
+#include "vlayoutdef.h"
 #include "vlayoutpiece.h"
+#include "vnfpposition.h"
+#include "vnofitpolygon.h"
+#include "vpositionsindex.h"
 
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
@@ -51,11 +56,23 @@ public:
     /** @brief details list of arranged details. */
     QVector<VLayoutPiece> details{}; // NOLINT (misc-non-private-member-variables-in-classes)
 
-    QVector<VCachedPositions> positionsCache{}; // NOLINT (misc-non-private-member-variables-in-classes)
+    /** @brief positionsIndex spatial index of arranged details for collision checks. */
+    VPositionsIndex positionsIndex{}; // NOLINT (misc-non-private-member-variables-in-classes)
 
     /** @brief globalContour list of global points contour. */
     VContour globalContour{}; // NOLINT (misc-non-private-member-variables-in-classes)
 
+    /** @brief nfpPlaced arranged details as seen by no-fit polygon engine. */
+    QVector<VNfpPlacedPiece> nfpPlaced{}; // NOLINT (misc-non-private-member-variables-in-classes)
+
+    /** @brief nfpCache no-fit polygons shared between sheets. */
+    QSharedPointer<VNoFitPolygonCache> nfpCache{}; // NOLINT (misc-non-private-member-variables-in-classes)
+
+    /** @brief counters nesting statistics shared between sheets. */
+    QSharedPointer<VLayoutCounters> counters{}; // NOLINT (misc-non-private-member-variables-in-classes)
+
+    NestingEngine nestingEngine{NestingEngine::ContourSliding}; // NOLINT (misc-non-private-member-variables-in-classes)
+
     quint32 paperIndex{0};             // NOLINT (misc-non-private-member-variables-in-classes)
     qreal layoutWidth{0};              // NOLINT (misc-non-private-member-variables-in-classes)
     bool globalRotate{true};           // NOLINT (misc-non-private-member-variables-in-classes)
@@ -46,6 +46,7 @@
 #include <QtConcurrent/QtConcurrentRun>
 #include <QtDebug>
 #include <QtMath>
+#include <atomic>
 
 #include "../vformat/vsinglelineoutlinechar.h"
 #include "../vgeometry/vgobject.h"
@@ -59,6 +60,7 @@
 #include "../vmisc/svgfont/vsvgfontengine.h"
 #include "../vmisc/testpath.h"
 #include "../vmisc/vabstractvalapplication.h"
+#include "../vmisc/vtextpathcache.h"
 #include "../vpatterndb/calculator.h"
 #include "../vpatterndb/floatItemData/vgrainlinedata.h"
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
@@ -75,6 +77,7 @@
 #include "vfoldline.h"
 #include "vgraphicsfillitem.h"
 #include "vlayoutpiece_p.h"
+#include "vlayoutpointarray.h"
 #include "vtextmanager.h"
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 9, 0)
@@ -414,7 +417,7 @@ auto PrepareGradationPlaceholders(const VContainer *data) -> QMap<QString, QStri
         auto i = measurements.constBegin();
         while (i != measurements.constEnd())
         {
-            placeholders.insert(pl_measurement + i.key(), QString::number(*i.value()->GetValue()));
+            placeholders.insert(pl_measurement + i.key(), QString::number(std::as_const(*i.value()).GetValue()));
             placeholders.insert(pl_measurement + i.key() + pl_valueAlias, i.value()->GetValueAlias());
             ++i;
         }
@@ -527,6 +530,37 @@ void InitFoldLine(VLayoutPiece &det, const VPiece &piece, const VContainer *patt
         }
     }
 }
+
+std::atomic<quint64> mappedCacheHits{0};   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<quint64> mappedCacheMisses{0}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+//---------------------------------------------------------------------------------------------------------------------
+auto MappedCacheKey(const VLayoutPiece &piece) -> VLayoutPieceMappedKey
+{
+    return {.matrix = piece.GetMatrix(),
+            .mirrored = piece.IsVerticallyFlipped() || piece.IsHorizontallyFlipped(),
+            .showFullPiece = piece.IsShowFullPiece(),
+            .seamAllowance = piece.IsSeamAllowance(),
+            .seamAllowanceBuiltIn = piece.IsSeamAllowanceBuiltIn(),
+            .hideMainPath = piece.IsHideMainPath()};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T, typename Field, typename Compute>
+auto CachedMappedValue(const VLayoutPiece &piece, VLayoutPieceMappedCache &cache, Field field, Compute compute) -> T
+{
+    const VLayoutPieceMappedKey key = MappedCacheKey(piece);
+    if (std::optional<T> value = cache.Value<T>(key, field); value.has_value())
+    {
+        mappedCacheHits.fetch_add(1, std::memory_order_relaxed);
+        return *value;
+    }
+
+    mappedCacheMisses.fetch_add(1, std::memory_order_relaxed);
+    T value = compute();
+    cache.SetValue(key, field, value);
+    return value;
+}
 } // namespace
 
 // Friend functions
@@ -762,7 +796,13 @@ auto VLayoutPiece::Map(const GrainlineShape &shape) const -> GrainlineShape
 // cppcheck-suppress unusedFunction
 auto VLayoutPiece::GetMappedContourPoints() const -> QVector<VLayoutPoint>
 {
-    return Map(d->m_contour);
+    return CachedMappedValue<QVector<VLayoutPoint>>(
+        *this, d->m_mappedCache, [](auto &geometry) -> auto & { return geometry.contour; },
+        [this]()
+        {
+            const bool mirror = d->m_verticallyFlipped || d->m_horizontallyFlipped;
+            return d->m_contour.MappedLayoutPoints(d->m_matrix, mirror);
+        });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -776,17 +816,12 @@ auto VLayoutPiece::GetMappedFullContourPoints(bool togetherWithNotches, bool dra
 auto VLayoutPiece::GetFullContourPoints(bool togetherWithNotches, bool drawMode, bool layoutAllowance) const
     -> QVector<VLayoutPoint>
 {
-    QVector<VLayoutPoint> points;
-    points.reserve(d->m_contour.size());
+    QVector<VLayoutPoint> points = d->m_contour.ToLayoutPoints();
     if (!d->m_seamMirrorLine.isNull() && IsShowFullPiece())
     {
-        points = VAbstractPiece::FullSeamPath(d->m_contour, d->m_seamMirrorLine, GetName());
+        points = VAbstractPiece::FullSeamPath(points, d->m_seamMirrorLine, GetName());
         points = CheckLoops(CorrectEquidistantPoints(points)); // A path can contains loops
     }
-    else
-    {
-        points = d->m_contour;
-    }
 
     if (togetherWithNotches)
     {
@@ -818,13 +853,14 @@ auto VLayoutPiece::GetFullContourPoints(bool togetherWithNotches, bool drawMode,
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::GetContourPoints() const -> QVector<VLayoutPoint>
 {
-    return d->m_contour;
+    return d->m_contour.ToLayoutPoints();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::SetContourPoints(const QVector<VLayoutPoint> &points, bool hideMainPath)
 {
-    d->m_contour = RemoveDublicates(points, false);
+    d->m_contour = VLayoutPointArray(RemoveDublicates(points, false));
+    d->m_mappedCache.Clear();
     SetHideMainPath(hideMainPath);
 }
 
@@ -832,7 +868,13 @@ void VLayoutPiece::SetContourPoints(const QVector<VLayoutPoint> &points, bool hi
 // cppcheck-suppress unusedFunction
 auto VLayoutPiece::GetMappedSeamAllowancePoints() const -> QVector<VLayoutPoint>
 {
-    return Map(d->m_seamAllowance);
+    return CachedMappedValue<QVector<VLayoutPoint>>(
+        *this, d->m_mappedCache, [](auto &geometry) -> auto & { return geometry.seamAllowance; },
+        [this]()
+        {
+            const bool mirror = d->m_verticallyFlipped || d->m_horizontallyFlipped;
+            return d->m_seamAllowance.MappedLayoutPoints(d->m_matrix, mirror);
+        });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -847,8 +889,7 @@ auto VLayoutPiece::CorrectSeamAllowanceMirrorLine() const -> QLineF
 {
     QLineF correctedSeamAllowanceMirrorLine = d->m_seamAllowanceMirrorLine;
 
-    QVector<QPointF> seamAllowancePoints;
-    CastTo(d->m_seamAllowance, seamAllowancePoints);
+    const QVector<QPointF> seamAllowancePoints = d->m_seamAllowance.ToPoints();
 
     if (!VAbstractCurve::IsPointOnCurve(seamAllowancePoints, d->m_seamAllowanceMirrorLine.p1()) ||
         !VAbstractCurve::IsPointOnCurve(seamAllowancePoints, d->m_seamAllowanceMirrorLine.p2()))
@@ -863,19 +904,14 @@ auto VLayoutPiece::CorrectSeamAllowanceMirrorLine() const -> QLineF
 auto VLayoutPiece::GetFullSeamAllowancePoints(bool togetherWithNotches, bool drawMode, bool layoutAllowance) const
     -> QVector<VLayoutPoint>
 {
-    QVector<VLayoutPoint> points;
-    points.reserve(d->m_seamAllowance.size());
+    QVector<VLayoutPoint> points = d->m_seamAllowance.ToLayoutPoints();
     if (!d->m_seamAllowanceMirrorLine.isNull() && IsShowFullPiece())
     {
         // Trying to correct a seam allowance mirror line based on seam mirror line
         const QLineF seamAllowanceMirrorLine = CorrectSeamAllowanceMirrorLine();
-        points = VAbstractPiece::FullSeamAllowancePath(d->m_seamAllowance, seamAllowanceMirrorLine, GetName());
+        points = VAbstractPiece::FullSeamAllowancePath(points, seamAllowanceMirrorLine, GetName());
         points = CheckLoops(CorrectEquidistantPoints(points)); // A path can contains loops
     }
-    else
-    {
-        points = d->m_seamAllowance;
-    }
 
     if (togetherWithNotches)
     {
@@ -907,7 +943,7 @@ auto VLayoutPiece::GetFullSeamAllowancePoints(bool togetherWithNotches, bool dra
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::GetSeamAllowancePoints() const -> QVector<VLayoutPoint>
 {
-    return d->m_seamAllowance;
+    return d->m_seamAllowance.ToLayoutPoints();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -918,29 +954,40 @@ void VLayoutPiece::SetSeamAllowancePoints(const QVector<VLayoutPoint> &points, b
     {
         SetSeamAllowance(seamAllowance);
         SetSeamAllowanceBuiltIn(seamAllowanceBuiltIn);
-        d->m_seamAllowance = points;
-        if (not d->m_seamAllowance.isEmpty())
+        if (not points.isEmpty())
         {
-            d->m_seamAllowance = RemoveDublicates(d->m_seamAllowance, false);
+            d->m_seamAllowance = VLayoutPointArray(RemoveDublicates(points, false));
         }
-        else if (not IsSeamAllowanceBuiltIn())
+        else
+        {
+            d->m_seamAllowance.Clear();
+        }
+
+        if (d->m_seamAllowance.IsEmpty() && not IsSeamAllowanceBuiltIn())
         {
             qWarning() << "Seam allowance is empty.";
             SetSeamAllowance(false);
         }
+        d->m_mappedCache.Clear();
     }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::GetMappedLayoutAllowancePoints() const -> QVector<QPointF>
 {
-    return Map(d->m_layoutAllowance);
+    return CachedMappedValue<QVector<QPointF>>(
+        *this, d->m_mappedCache, [](auto &geometry) -> auto & { return geometry.layoutAllowance; },
+        [this]()
+        {
+            const bool mirror = d->m_verticallyFlipped || d->m_horizontallyFlipped;
+            return d->m_layoutAllowance.MappedPoints(d->m_matrix, mirror);
+        });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::GetLayoutAllowancePoints() const -> QVector<QPointF>
 {
-    return d->m_layoutAllowance;
+    return d->m_layoutAllowance.ToPoints();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1163,6 +1210,7 @@ auto VLayoutPiece::GetSeamMirrorLine() const -> QLineF
 void VLayoutPiece::SetSeamMirrorLine(const QLineF &line)
 {
     d->m_seamMirrorLine = line;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1181,6 +1229,7 @@ auto VLayoutPiece::GetSeamAllowanceMirrorLine() const -> QLineF
 void VLayoutPiece::SetSeamAllowanceMirrorLine(const QLineF &line)
 {
     d->m_seamAllowanceMirrorLine = line;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1320,7 +1369,11 @@ auto VLayoutPiece::GetMatrix() const -> QTransform
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::SetMatrix(const QTransform &matrix)
 {
-    d->m_matrix = matrix;
+    if (d->m_matrix != matrix)
+    {
+        d->m_matrix = matrix;
+        d->m_mappedCache.Clear();
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1371,6 +1424,7 @@ void VLayoutPiece::Translate(const QPointF &p)
     QTransform m;
     m.translate(p.x(), p.y());
     d->m_matrix *= m;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1382,6 +1436,7 @@ void VLayoutPiece::Scale(qreal sx, qreal sy)
     QTransform m;
     m.scale(sx, sy);
     d->m_matrix *= m;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1392,6 +1447,7 @@ void VLayoutPiece::Rotate(const QPointF &originPoint, qreal degrees)
     m.rotate(-degrees);
     m.translate(-originPoint.x(), -originPoint.y());
     d->m_matrix *= m;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1425,6 +1481,7 @@ void VLayoutPiece::Mirror(const QLineF &edge)
     d->m_matrix *= m;
 
     d->m_verticallyFlipped = !d->m_verticallyFlipped;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1434,18 +1491,46 @@ void VLayoutPiece::Mirror()
     m.scale(-1, 1);
     d->m_matrix *= m;
     d->m_verticallyFlipped = !d->m_verticallyFlipped;
+    d->m_mappedCache.Clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedCacheHits return how many times mapped geometry was taken from cache.
+ *
+ * Counts requests of all pieces since the last reset.
+ */
+auto VLayoutPiece::MappedCacheHits() -> quint64
+{
+    return mappedCacheHits.load(std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedCacheMisses return how many times mapped geometry had to be built.
+ */
+auto VLayoutPiece::MappedCacheMisses() -> quint64
+{
+    return mappedCacheMisses.load(std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPiece::ResetMappedCacheCounters()
+{
+    mappedCacheHits.store(0, std::memory_order_relaxed);
+    mappedCacheMisses.store(0, std::memory_order_relaxed);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::DetailEdgesCount() const -> vsizetype
 {
-    return DetailPath().count();
+    return IsSeamAllowance() && not IsSeamAllowanceBuiltIn() ? d->m_seamAllowance.Size() : d->m_contour.Size();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::LayoutEdgesCount() const -> vsizetype
 {
-    const auto count = d->m_layoutAllowance.count();
+    const auto count = d->m_layoutAllowance.Size();
     return count > 2 ? count : 0;
 }
 
@@ -1464,9 +1549,14 @@ auto VLayoutPiece::LayoutEdgeByPoint(const QPointF &p1) const -> EdgeIndex
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::MappedDetailBoundingRect() const -> QRectF
 {
-    QVector<QPointF> points;
-    CastTo(GetMappedExternalContourPoints(), points);
-    return BoundingRect(points);
+    return CachedMappedValue<QRectF>(*this, d->m_mappedCache,
+                                     [](auto &geometry) -> auto & { return geometry.detailBoundingRect; },
+                                     [this]()
+                                     {
+                                         QVector<QPointF> points;
+                                         CastTo(GetMappedExternalContourPoints(), points);
+                                         return BoundingRect(points);
+                                     });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1480,7 +1570,9 @@ auto VLayoutPiece::DetailBoundingRect() const -> QRectF
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::MappedLayoutBoundingRect() const -> QRectF
 {
-    return BoundingRect(GetMappedLayoutAllowancePoints());
+    return CachedMappedValue<QRectF>(*this, d->m_mappedCache,
+                                     [](auto &geometry) -> auto & { return geometry.layoutBoundingRect; },
+                                     [this]() { return d->m_layoutAllowance.MappedBoundingRect(d->m_matrix); });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1517,9 +1609,9 @@ auto VLayoutPiece::FoldLine() const -> VFoldLine
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::isNull() const -> bool
 {
-    if (not d->m_contour.isEmpty() && d->m_layoutWidth > 0)
+    if (not d->m_contour.IsEmpty() && d->m_layoutWidth > 0)
     {
-        return !IsSeamAllowance() || IsSeamAllowanceBuiltIn() || d->m_seamAllowance.isEmpty();
+        return !IsSeamAllowance() || IsSeamAllowanceBuiltIn() || d->m_seamAllowance.IsEmpty();
     }
     return true;
 }
@@ -1545,11 +1637,13 @@ void VLayoutPiece::SetLayoutAllowancePoints(bool togetherWithNotches)
 
         QVector<VSAPoint> pieceBoundaryPoints;
         CastTo(pieceBoundary, pieceBoundaryPoints);
-        CastTo(Equidistant(pieceBoundaryPoints, d->m_layoutWidth, false, GetName()), d->m_layoutAllowance);
-        if (not d->m_layoutAllowance.isEmpty())
+        QVector<QPointF> layoutAllowance;
+        CastTo(Equidistant(pieceBoundaryPoints, d->m_layoutWidth, false, GetName()), layoutAllowance);
+        if (not layoutAllowance.isEmpty())
         {
-            d->m_layoutAllowance.removeLast();
+            layoutAllowance.removeLast();
         }
+        d->m_layoutAllowance = VLayoutPointArray(layoutAllowance);
 
         QVector<QPointF> points;
         CastTo(IsSeamAllowance() && not IsSeamAllowanceBuiltIn() ? GetSeamAllowancePoints() : GetContourPoints(),
@@ -1558,15 +1652,22 @@ void VLayoutPiece::SetLayoutAllowancePoints(bool togetherWithNotches)
     }
     else
     {
-        d->m_layoutAllowance.clear();
+        d->m_layoutAllowance.Clear();
     }
+
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::GetMappedExternalContourPoints() const -> QVector<VLayoutPoint>
 {
-    return IsSeamAllowance() && not IsSeamAllowanceBuiltIn() ? GetMappedFullSeamAllowancePoints()
-                                                             : GetMappedFullContourPoints();
+    return CachedMappedValue<QVector<VLayoutPoint>>(
+        *this, d->m_mappedCache, [](auto &geometry) -> auto & { return geometry.externalContour; },
+        [this]()
+        {
+            return IsSeamAllowance() && not IsSeamAllowanceBuiltIn() ? GetMappedFullSeamAllowancePoints()
+                                                                     : GetMappedFullContourPoints();
+        });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1593,6 +1694,7 @@ void VLayoutPiece::SetPassmarks(const QVector<VLayoutPassmark> &passmarks)
     if (IsSeamAllowance())
     {
         d->m_passmarks = passmarks;
+        d->m_mappedCache.Clear();
     }
 }
 
@@ -1642,7 +1744,11 @@ void VLayoutPiece::SetInternalPaths(const QVector<VLayoutPiecePath> &internalPat
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::MappedContourPath(bool togetherWithNotches, bool showLayoutAllowance) const -> QPainterPath
 {
-    return d->m_matrix.map(ContourPath(togetherWithNotches, showLayoutAllowance));
+    const auto index = static_cast<std::size_t>((togetherWithNotches ? 2 : 0) + (showLayoutAllowance ? 1 : 0));
+    return CachedMappedValue<QPainterPath>(
+        *this, d->m_mappedCache, [index](auto &geometry) -> auto & { return geometry.contourPaths.at(index); },
+        [this, togetherWithNotches, showLayoutAllowance]()
+        { return d->m_matrix.map(ContourPath(togetherWithNotches, showLayoutAllowance)); });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1707,7 +1813,7 @@ auto VLayoutPiece::ContourPath(bool togetherWithNotches, bool showLayoutAllowanc
 
     if (showLayoutAllowance)
     {
-        path.addPath(VGObject::PainterPath(d->m_layoutAllowance));
+        path.addPath(VGObject::PainterPath(d->m_layoutAllowance.ToPoints()));
     }
 
     return path;
@@ -1716,7 +1822,9 @@ auto VLayoutPiece::ContourPath(bool togetherWithNotches, bool showLayoutAllowanc
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::MappedLayoutAllowancePath() const -> QPainterPath
 {
-    return VGObject::PainterPath(GetMappedLayoutAllowancePoints());
+    return CachedMappedValue<QPainterPath>(*this, d->m_mappedCache,
+                                           [](auto &geometry) -> auto & { return geometry.layoutAllowancePath; },
+                                           [this]() { return VGObject::PainterPath(GetMappedLayoutAllowancePoints()); });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1851,7 +1959,7 @@ auto VLayoutPiece::IsLayoutAllowanceValid(bool togetherWithNotches) const -> boo
 
     QVector<QPointF> points;
     CastTo(base, points);
-    return VAbstractPiece::IsAllowanceValid(points, d->m_layoutAllowance);
+    return VAbstractPiece::IsAllowanceValid(points, d->m_layoutAllowance.ToPoints());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2147,7 +2255,7 @@ void VLayoutPiece::LabelStringsOutlineFont(QGraphicsItem *parent, const QVector<
             }
             else
             {
-                path.addText(0, static_cast<qreal>(fm.ascent()), fnt, tl.qsText);
+                path.addPath(VTextPathCache::OutlineText(QPointF(0, fm.ascent()), fnt, tl.qsText));
             }
 
             auto *item = new QGraphicsPathItem(parent);
@@ -2288,17 +2396,6 @@ void VLayoutPiece::CreateFoldLineItem(QGraphicsItem *parent, bool textAsPaths) c
     }
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-auto VLayoutPiece::DetailPath() const -> QVector<VLayoutPoint>
-{
-    if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
-    {
-        return d->m_seamAllowance;
-    }
-
-    return d->m_contour;
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 auto VLayoutPiece::GetMainItem(bool togetherWithNotches, bool showLayoutAllowance) const -> QGraphicsPathItem *
 {
@@ -2344,6 +2441,7 @@ auto VLayoutPiece::IsVerticallyFlipped() const -> bool
 void VLayoutPiece::SetVerticallyFlipped(bool value)
 {
     d->m_verticallyFlipped = value;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2356,6 +2454,7 @@ auto VLayoutPiece::IsHorizontallyFlipped() const -> bool
 void VLayoutPiece::SetHorizontallyFlipped(bool value)
 {
     d->m_horizontallyFlipped = value;
+    d->m_mappedCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2395,7 +2494,7 @@ void VLayoutPiece::SetYScale(qreal ys)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const -> QLineF
+auto VLayoutPiece::Edge(const VLayoutPointArray &path, int i) const -> QLineF
 {
     if (i < 1)
     { // Doesn't exist such edge
@@ -2403,39 +2502,33 @@ auto VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const -> QLineF
     }
 
     vsizetype i1, i2;
-    if (i < path.count())
+    if (i < path.Size())
     {
         i1 = i - 1;
         i2 = i;
     }
     else
     {
-        i1 = path.count() - 1;
+        i1 = path.Size() - 1;
         i2 = 0;
     }
 
-    if (d->m_verticallyFlipped || d->m_horizontallyFlipped)
-    {
-        QVector<QPointF> const newPath = Map(path);
-        return {newPath.at(i1), newPath.at(i2)};
-    }
-    return {d->m_matrix.map(path.at(i1)), d->m_matrix.map(path.at(i2))};
+    return path.MappedEdge(i1, i2, d->m_matrix, d->m_verticallyFlipped || d->m_horizontallyFlipped);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const -> EdgeIndex
+auto VLayoutPiece::EdgeByPoint(const VLayoutPointArray &path, const QPointF &p1) const -> EdgeIndex
 {
-    if (p1.isNull() || path.count() < 3)
+    if (p1.isNull() || path.Size() < 3)
     {
         return {};
     }
 
-    const QVector<QPointF> points = Map(path);
-    auto posIter = std::find_if(points.cbegin(), points.cend(),
-                                [&p1](const QPointF &point) { return VFuzzyComparePoints(point, p1); });
-    if (posIter != points.cend())
+    const bool mirror = d->m_verticallyFlipped || d->m_horizontallyFlipped;
+    const vsizetype index = path.MappedIndexOf(p1, d->m_matrix, mirror);
+    if (index >= 0)
     {
-        return static_cast<int>(posIter - points.cbegin() + 1);
+        return static_cast<int>(index + 1);
     }
     return {}; // Did not find edge
 }
@@ -58,6 +58,7 @@ class VPieceLabelData;
 class VAbstractPattern;
 class VPatternLabelData;
 class VLayoutPoint;
+class VLayoutPointArray;
 class VFoldLine;
 
 QT_WARNING_PUSH
@@ -230,6 +231,10 @@ public:
 
     static auto GrainlinePath(const GrainlineShape &shape) -> QPainterPath;
 
+    static auto MappedCacheHits() -> quint64;
+    static auto MappedCacheMisses() -> quint64;
+    static void ResetMappedCacheCounters();
+
     auto isNull() const -> bool;
     auto Square() const -> qint64;
 
@@ -262,8 +267,6 @@ protected:
 private:
     QSharedDataPointer<VLayoutPieceData> d;
 
-    auto DetailPath() const -> QVector<VLayoutPoint>;
-
     Q_REQUIRED_RESULT auto GetMainItem(bool togetherWithNotches, bool showLayoutAllowance) const -> QGraphicsPathItem *;
     Q_REQUIRED_RESULT auto GetExternalContourPathItem() const -> QGraphicsPathItem *;
 
@@ -280,8 +283,8 @@ private:
     template <class T> auto Map(QVector<T> points) const -> QVector<T>;
     auto Map(const GrainlineShape &shape) const -> GrainlineShape;
 
-    auto Edge(const QVector<QPointF> &path, int i) const -> QLineF;
-    auto EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const -> EdgeIndex;
+    auto Edge(const VLayoutPointArray &path, int i) const -> QLineF;
+    auto EdgeByPoint(const VLayoutPointArray &path, const QPointF &p1) const -> EdgeIndex;
 
     auto CorrectSeamAllowanceMirrorLine() const -> QLineF;
 };
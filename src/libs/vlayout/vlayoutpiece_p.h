@@ -29,10 +29,15 @@
 #ifndef VLAYOUTDETAIL_P_H
 #define VLAYOUTDETAIL_P_H
 
+#include <QMutex>
+#include <QPainterPath>
 #include <QPointF>
+#include <QRectF>
 #include <QSharedData>
 #include <QTransform>
 #include <QVector>
+#include <array>
+#include <optional>
 
 #include "../vgeometry/vgeometrydef.h"
 #include "../vgeometry/vlayoutplacelabel.h"
@@ -41,8 +46,154 @@
 #include "../vwidgets/vpiecegrainline.h"
 #include "vlayoutpiecepath.h"
 #include "vlayoutpoint.h"
+#include "vlayoutpointarray.h"
 #include "vtextmanager.h"
 
+/**
+ * @brief The VLayoutPieceMappedKey struct describes the state mapped geometry of a piece was built for.
+ *
+ * Besides the transformation it holds the piece flags that select which outline is external and what a contour path
+ * contains.
+ */
+struct VLayoutPieceMappedKey
+{
+    QTransform matrix{};
+    bool mirrored{false};
+    bool showFullPiece{false};
+    bool seamAllowance{false};
+    bool seamAllowanceBuiltIn{false};
+    bool hideMainPath{false};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto operator==(const VLayoutPieceMappedKey &lhs, const VLayoutPieceMappedKey &rhs) -> bool
+{
+    return lhs.matrix == rhs.matrix && lhs.mirrored == rhs.mirrored && lhs.showFullPiece == rhs.showFullPiece &&
+           lhs.seamAllowance == rhs.seamAllowance && lhs.seamAllowanceBuiltIn == rhs.seamAllowanceBuiltIn &&
+           lhs.hideMainPath == rhs.hideMainPath;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto operator!=(const VLayoutPieceMappedKey &lhs, const VLayoutPieceMappedKey &rhs) -> bool
+{
+    return not(lhs == rhs);
+}
+
+/**
+ * @brief The VLayoutPieceMappedGeometry struct holds geometry of a piece already mapped by its transformation.
+ *
+ * Each value is filled on first request.
+ */
+struct VLayoutPieceMappedGeometry
+{
+    VLayoutPieceMappedKey key{};
+
+    std::optional<QVector<VLayoutPoint>> contour{};
+    std::optional<QVector<VLayoutPoint>> seamAllowance{};
+    std::optional<QVector<VLayoutPoint>> externalContour{};
+    std::optional<QVector<QPointF>> layoutAllowance{};
+    std::optional<QRectF> detailBoundingRect{};
+    std::optional<QRectF> layoutBoundingRect{};
+    std::optional<QPainterPath> layoutAllowancePath{};
+
+    /** @brief contourPaths contour path for each combination of notches and layout allowance flags. */
+    std::array<std::optional<QPainterPath>, 4> contourPaths{};
+};
+
+/**
+ * @brief The VLayoutPieceMappedCache class keeps mapped geometry of a piece between calls.
+ *
+ * Pieces are read from several threads, access is guarded by a mutex. A copy gets a snapshot of the values, the piece
+ * clears its own cache when the transformation or the source geometry change.
+ */
+class VLayoutPieceMappedCache
+{
+public:
+    VLayoutPieceMappedCache() = default;
+    VLayoutPieceMappedCache(const VLayoutPieceMappedCache &cache);
+    auto operator=(const VLayoutPieceMappedCache &cache) -> VLayoutPieceMappedCache &;
+    ~VLayoutPieceMappedCache() = default;
+
+    template <typename T, typename Field>
+    auto Value(const VLayoutPieceMappedKey &key, Field field) const -> std::optional<T>;
+
+    template <typename T, typename Field>
+    void SetValue(const VLayoutPieceMappedKey &key, Field field, const T &value);
+
+    void Clear();
+
+private:
+    mutable QMutex m_mutex{};
+    VLayoutPieceMappedGeometry m_geometry{};
+
+    auto Geometry() const -> VLayoutPieceMappedGeometry;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline VLayoutPieceMappedCache::VLayoutPieceMappedCache(const VLayoutPieceMappedCache &cache)
+  : m_geometry(cache.Geometry())
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VLayoutPieceMappedCache::operator=(const VLayoutPieceMappedCache &cache) -> VLayoutPieceMappedCache &
+{
+    if (&cache == this)
+    {
+        return *this;
+    }
+
+    const VLayoutPieceMappedGeometry geometry = cache.Geometry();
+    QMutexLocker const locker(&m_mutex);
+    m_geometry = geometry;
+    return *this;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Value return cached value.
+ * @param key state of the piece.
+ * @param field generic callable that returns reference to the value in VLayoutPieceMappedGeometry.
+ * @return value or nothing if the value was not built yet or was built for another state.
+ */
+template <typename T, typename Field>
+inline auto VLayoutPieceMappedCache::Value(const VLayoutPieceMappedKey &key, Field field) const -> std::optional<T>
+{
+    QMutexLocker const locker(&m_mutex);
+    if (m_geometry.key != key)
+    {
+        return std::nullopt;
+    }
+    return field(m_geometry);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T, typename Field>
+inline void VLayoutPieceMappedCache::SetValue(const VLayoutPieceMappedKey &key, Field field, const T &value)
+{
+    QMutexLocker const locker(&m_mutex);
+    if (m_geometry.key != key)
+    {
+        m_geometry = VLayoutPieceMappedGeometry();
+        m_geometry.key = key;
+    }
+    field(m_geometry) = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline void VLayoutPieceMappedCache::Clear()
+{
+    QMutexLocker const locker(&m_mutex);
+    m_geometry = VLayoutPieceMappedGeometry();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VLayoutPieceMappedCache::Geometry() const -> VLayoutPieceMappedGeometry
+{
+    QMutexLocker const locker(&m_mutex);
+    return m_geometry;
+}
+
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
@@ -58,13 +209,13 @@ public:
     friend auto operator>>(QDataStream &dataStream, VLayoutPieceData &piece) -> QDataStream &;
 
     /** @brief contour list of contour points. */
-    QVector<VLayoutPoint> m_contour{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    VLayoutPointArray m_contour{}; // NOLINT(misc-non-private-member-variables-in-classes)
 
     /** @brief seamAllowance list of seam allowance points. */
-    QVector<VLayoutPoint> m_seamAllowance{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    VLayoutPointArray m_seamAllowance{}; // NOLINT(misc-non-private-member-variables-in-classes)
 
     /** @brief layoutAllowance list of layout allowance points. */
-    QVector<QPointF> m_layoutAllowance{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    VLayoutPointArray m_layoutAllowance{}; // NOLINT(misc-non-private-member-variables-in-classes)
 
     /** @brief passmarks list of passmakrs. */
     QVector<VLayoutPassmark> m_passmarks{}; // NOLINT(misc-non-private-member-variables-in-classes)
@@ -120,6 +271,9 @@ public:
     QFont m_foldLineOutlineFont{};     // NOLINT (misc-non-private-member-variables-in-classes)
     QString m_foldLineSvgFontFamily{}; // NOLINT (misc-non-private-member-variables-in-classes)
 
+    /** @brief m_mappedCache mapped geometry, not serialized. */
+    mutable VLayoutPieceMappedCache m_mappedCache{}; // NOLINT(misc-non-private-member-variables-in-classes)
+
 private:
     Q_DISABLE_ASSIGN_MOVE(VLayoutPieceData) // NOLINT
 
@@ -135,9 +289,9 @@ inline auto operator<<(QDataStream &dataStream, const VLayoutPieceData &piece) -
 {
     dataStream << VLayoutPieceData::streamHeader << VLayoutPieceData::classVersion;
 
-    dataStream << piece.m_contour;
-    dataStream << piece.m_seamAllowance;
-    dataStream << piece.m_layoutAllowance;
+    dataStream << piece.m_contour.ToLayoutPoints();
+    dataStream << piece.m_seamAllowance.ToLayoutPoints();
+    dataStream << piece.m_layoutAllowance.ToPoints();
     dataStream << piece.m_passmarks;
     dataStream << piece.m_internalPaths;
     dataStream << piece.m_matrix;
@@ -200,9 +354,7 @@ inline auto operator>>(QDataStream &dataStream, VLayoutPieceData &piece) -> QDat
         {
             QVector<QPointF> points;
             dataStream >> points;
-            QVector<VLayoutPoint> casted;
-            CastTo(points, casted);
-            return casted;
+            return VLayoutPointArray(points);
         };
 
         piece.m_contour = ReadPoints();
@@ -210,11 +362,20 @@ inline auto operator>>(QDataStream &dataStream, VLayoutPieceData &piece) -> QDat
     }
     else
     {
-        dataStream >> piece.m_contour;
-        dataStream >> piece.m_seamAllowance;
+        auto ReadPoints = [&dataStream]()
+        {
+            QVector<VLayoutPoint> points;
+            dataStream >> points;
+            return VLayoutPointArray(points);
+        };
+
+        piece.m_contour = ReadPoints();
+        piece.m_seamAllowance = ReadPoints();
     }
 
-    dataStream >> piece.m_layoutAllowance;
+    QVector<QPointF> layoutAllowance;
+    dataStream >> layoutAllowance;
+    piece.m_layoutAllowance = VLayoutPointArray(layoutAllowance);
     dataStream >> piece.m_passmarks;
     dataStream >> piece.m_internalPaths;
     dataStream >> piece.m_matrix;
@@ -292,6 +453,8 @@ inline auto operator>>(QDataStream &dataStream, VLayoutPieceData &piece) -> QDat
         dataStream >> piece.m_foldLineSvgFontFamily;
     }
 
+    piece.m_mappedCache.Clear();
+
     return dataStream;
 }
 
@@ -0,0 +1,268 @@
+/************************************************************************
+ **
+ **  @file   vlayoutpointarray.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vlayoutpointarray.h"
+
+#include "../vgeometry/vgeometrydef.h"
+
+#include <limits>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+inline auto IsAffine(const QTransform &matrix) -> bool
+{
+    return matrix.type() < QTransform::TxProject;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPointArray::VLayoutPointArray(const QVector<VLayoutPoint> &points)
+{
+    m_x.reserve(points.size());
+    m_y.reserve(points.size());
+    m_flags.reserve(points.size());
+
+    for (const auto &point : points)
+    {
+        m_x.append(point.x());
+        m_y.append(point.y());
+
+        quint8 flags = 0;
+        if (point.TurnPoint())
+        {
+            flags |= TurnPointFlag;
+        }
+
+        if (point.CurvePoint())
+        {
+            flags |= CurvePointFlag;
+        }
+        m_flags.append(flags);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPointArray::VLayoutPointArray(const QVector<QPointF> &points)
+{
+    m_x.reserve(points.size());
+    m_y.reserve(points.size());
+
+    for (const auto &point : points)
+    {
+        m_x.append(point.x());
+        m_y.append(point.y());
+    }
+
+    m_flags.fill(0, points.size());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPointArray::Clear()
+{
+    m_x.clear();
+    m_y.clear();
+    m_flags.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutPointArray::MappedPoint(vsizetype i, const QTransform &matrix) const -> QPointF
+{
+    const qreal x = m_x.at(i);
+    const qreal y = m_y.at(i);
+
+    if (IsAffine(matrix))
+    {
+        return {matrix.m11() * x + matrix.m21() * y + matrix.dx(), matrix.m12() * x + matrix.m22() * y + matrix.dy()};
+    }
+
+    return matrix.map(QPointF(x, y));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutPointArray::ToPoints() const -> QVector<QPointF>
+{
+    return MappedPoints(QTransform(), false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutPointArray::ToLayoutPoints() const -> QVector<VLayoutPoint>
+{
+    return MappedLayoutPoints(QTransform(), false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutPointArray::MappedPoints(const QTransform &matrix, bool mirror) const -> QVector<QPointF>
+{
+    QVector<QPointF> points;
+    MapInto(points, matrix, mirror);
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VLayoutPointArray::MappedLayoutPoints(const QTransform &matrix, bool mirror) const -> QVector<VLayoutPoint>
+{
+    QVector<VLayoutPoint> points;
+    MapInto(points, matrix, mirror);
+
+    const vsizetype size = points.size();
+    for (vsizetype i = 0; i < size; ++i)
+    {
+        const quint8 flags = m_flags.at(mirror ? size - 1 - i : i);
+        points[i].SetTurnPoint((flags & TurnPointFlag) != 0);
+        points[i].SetCurvePoint((flags & CurvePointFlag) != 0);
+    }
+
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedBoundingRect return bounding rect of the points after transformation.
+ *
+ * Mirroring changes only the order of points and does not affect the result.
+ */
+auto VLayoutPointArray::MappedBoundingRect(const QTransform &matrix) const -> QRectF
+{
+    if (m_x.isEmpty())
+    {
+        return {};
+    }
+
+    if (not IsAffine(matrix))
+    {
+        return matrix.map(ToPoints()).boundingRect();
+    }
+
+    const qreal m11 = matrix.m11();
+    const qreal m12 = matrix.m12();
+    const qreal m21 = matrix.m21();
+    const qreal m22 = matrix.m22();
+    const qreal dx = matrix.dx();
+    const qreal dy = matrix.dy();
+
+    const qreal *x = m_x.constData();
+    const qreal *y = m_y.constData();
+    const vsizetype size = m_x.size();
+
+    qreal minX = std::numeric_limits<qreal>::max();
+    qreal minY = std::numeric_limits<qreal>::max();
+    qreal maxX = std::numeric_limits<qreal>::lowest();
+    qreal maxY = std::numeric_limits<qreal>::lowest();
+
+    for (vsizetype i = 0; i < size; ++i)
+    {
+        const qreal mx = m11 * x[i] + m21 * y[i] + dx;
+        const qreal my = m12 * x[i] + m22 * y[i] + dy;
+        minX = qMin(minX, mx);
+        maxX = qMax(maxX, mx);
+        minY = qMin(minY, my);
+        maxY = qMax(maxY, my);
+    }
+
+    return {QPointF(minX, minY), QPointF(maxX, maxY)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedEdge return edge between two points of mapped contour.
+ * @param i1 index of the first point in mapped order.
+ * @param i2 index of the second point in mapped order.
+ * @param matrix transformation.
+ * @param mirror true if mapped points go in reverse order.
+ */
+auto VLayoutPointArray::MappedEdge(vsizetype i1, vsizetype i2, const QTransform &matrix, bool mirror) const -> QLineF
+{
+    if (mirror)
+    {
+        i1 = m_x.size() - 1 - i1;
+        i2 = m_x.size() - 1 - i2;
+    }
+
+    return {MappedPoint(i1, matrix), MappedPoint(i2, matrix)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedIndexOf find the point in mapped contour.
+ * @return index in mapped order or -1 if the point was not found.
+ */
+auto VLayoutPointArray::MappedIndexOf(const QPointF &point, const QTransform &matrix, bool mirror) const -> vsizetype
+{
+    const vsizetype size = m_x.size();
+    for (vsizetype i = 0; i < size; ++i)
+    {
+        if (VFuzzyComparePoints(MappedPoint(mirror ? size - 1 - i : i, matrix), point))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T> void VLayoutPointArray::MapInto(QVector<T> &points, const QTransform &matrix, bool mirror) const
+{
+    const vsizetype size = m_x.size();
+    points.resize(size);
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    const qreal *x = m_x.constData();
+    const qreal *y = m_y.constData();
+    T *out = points.data();
+
+    if (IsAffine(matrix))
+    {
+        const qreal m11 = matrix.m11();
+        const qreal m12 = matrix.m12();
+        const qreal m21 = matrix.m21();
+        const qreal m22 = matrix.m22();
+        const qreal dx = matrix.dx();
+        const qreal dy = matrix.dy();
+
+        for (vsizetype i = 0; i < size; ++i)
+        {
+            T &p = out[mirror ? size - 1 - i : i];
+            p.setX(m11 * x[i] + m21 * y[i] + dx);
+            p.setY(m12 * x[i] + m22 * y[i] + dy);
+        }
+        return;
+    }
+
+    for (vsizetype i = 0; i < size; ++i)
+    {
+        const QPointF mapped = matrix.map(QPointF(x[i], y[i]));
+        T &p = out[mirror ? size - 1 - i : i];
+        p.setX(mapped.x());
+        p.setY(mapped.y());
+    }
+}
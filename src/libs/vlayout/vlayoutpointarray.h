@@ -0,0 +1,105 @@
+/************************************************************************
+ **
+ **  @file   vlayoutpointarray.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VLAYOUTPOINTARRAY_H
+#define VLAYOUTPOINTARRAY_H
+
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <QTransform>
+#include <QVector>
+#include <QtGlobal>
+
+#include "../vmisc/defglobal.h"
+#include "vlayoutpoint.h"
+
+/**
+ * @brief The VLayoutPointArray class stores a layout contour as structure of arrays.
+ *
+ * Coordinates are kept in two contiguous arrays and point flags in a third one. Transformation, bounding box and edge
+ * queries walk the coordinate arrays directly and do not build intermediate point vectors. Mapped points are returned
+ * in reverse order for a mirrored piece, the same way VAbstractPiece::MapVector does.
+ */
+class VLayoutPointArray
+{
+public:
+    VLayoutPointArray() = default;
+    explicit VLayoutPointArray(const QVector<VLayoutPoint> &points);
+    explicit VLayoutPointArray(const QVector<QPointF> &points);
+
+    auto Size() const -> vsizetype;
+    auto IsEmpty() const -> bool;
+    void Clear();
+
+    auto Point(vsizetype i) const -> QPointF;
+    auto MappedPoint(vsizetype i, const QTransform &matrix) const -> QPointF;
+
+    auto ToPoints() const -> QVector<QPointF>;
+    auto ToLayoutPoints() const -> QVector<VLayoutPoint>;
+
+    auto MappedPoints(const QTransform &matrix, bool mirror) const -> QVector<QPointF>;
+    auto MappedLayoutPoints(const QTransform &matrix, bool mirror) const -> QVector<VLayoutPoint>;
+    auto MappedBoundingRect(const QTransform &matrix) const -> QRectF;
+    auto MappedEdge(vsizetype i1, vsizetype i2, const QTransform &matrix, bool mirror) const -> QLineF;
+    auto MappedIndexOf(const QPointF &point, const QTransform &matrix, bool mirror) const -> vsizetype;
+
+private:
+    enum PointFlag : quint8
+    {
+        TurnPointFlag = 0x1,
+        CurvePointFlag = 0x2
+    };
+
+    QVector<qreal> m_x{};
+    QVector<qreal> m_y{};
+    QVector<quint8> m_flags{};
+
+    template <typename T> void MapInto(QVector<T> &points, const QTransform &matrix, bool mirror) const;
+};
+
+Q_DECLARE_TYPEINFO(VLayoutPointArray, Q_MOVABLE_TYPE); // NOLINT
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VLayoutPointArray::Size() const -> vsizetype
+{
+    return m_x.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VLayoutPointArray::IsEmpty() const -> bool
+{
+    return m_x.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VLayoutPointArray::Point(vsizetype i) const -> QPointF
+{
+    return {m_x.at(i), m_y.at(i)};
+}
+
+#endif // VLAYOUTPOINTARRAY_H
@@ -0,0 +1,510 @@
+/************************************************************************
+ **
+ **  @file   vnfpposition.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vnfpposition.h"
+
+#include <QLineF>
+#include <QPair>
+#include <QRectF>
+#include <QSizeF>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+
+#include "../vgeometry/vgeometrydef.h"
+#include "../vmisc/exception/vexception.h"
+#include "vlayoutpoint.h"
+#include "vnofitpolygon.h"
+#include "vpiecegrainline.h"
+
+namespace
+{
+struct VNfpOrientation
+{
+    VLayoutPiece detail{};
+    QString key{};
+    QVector<QPointF> hull{};
+    QSizeF size{};
+};
+
+struct VNfpCandidate
+{
+    qreal square{0};
+    qreal depth{0};
+    qreal side{0};
+    vsizetype orientation{0};
+    QPointF offset{};
+};
+
+struct VNfpObstacles
+{
+    QVector<QVector<QPointF>> polygons{};
+    QVector<QRectF> rects{};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+auto NormalizeAngle(qreal angle) -> qreal
+{
+    angle = std::fmod(angle, 360.0);
+    if (angle < 0)
+    {
+        angle += 360.0;
+    }
+    return angle;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto MirrorAxis() -> QLineF
+{
+    return {10, 10, 10, 100};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GrainlineAngles return rotation angles that align piece grainline with fabric grainline. Follows
+ * VPosition::FollowGrainline.
+ */
+auto GrainlineAngles(const VLayoutPiece &detail, bool mirror, bool portrait) -> QVector<qreal>
+{
+    const VPieceGrainline pieceGrainline = detail.GetGrainline();
+    QLineF detailGrainline(10, 10, -100, 10);
+    detailGrainline.setAngle(pieceGrainline.GetMainLine().angle());
+
+    if (mirror)
+    {
+        VLayoutPiece workDetail = detail; // We need copy for temp change
+        workDetail.Mirror(MirrorAxis());
+        detailGrainline = workDetail.GetMatrix().map(detailGrainline);
+    }
+
+    QLineF fabricGrainline(detailGrainline.p1().x(), detailGrainline.p1().y(), detailGrainline.p1().x() - 100,
+                           detailGrainline.p1().y());
+    if (portrait)
+    {
+        fabricGrainline.setAngle(fabricGrainline.angle() - 90);
+    }
+
+    QVector<qreal> angles;
+
+    if (pieceGrainline.IsArrowUpEnabled())
+    {
+        angles.append(detailGrainline.angleTo(fabricGrainline));
+    }
+
+    auto ArrowAngle = [detailGrainline, fabricGrainline](qreal shift)
+    {
+        QLineF arrow = detailGrainline;
+        arrow.setAngle(arrow.angle() + shift);
+        return arrow.angleTo(fabricGrainline);
+    };
+
+    if (pieceGrainline.IsArrowDownEnabled())
+    {
+        angles.append(ArrowAngle(180));
+    }
+
+    if (pieceGrainline.IsArrowLeftEnabled())
+    {
+        angles.append(ArrowAngle(90));
+    }
+
+    if (pieceGrainline.IsArrowRightEnabled())
+    {
+        angles.append(ArrowAngle(-90));
+    }
+
+    return angles;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Orientate(const VLayoutPiece &detail, qreal angle, bool mirror) -> VNfpOrientation
+{
+    VNfpOrientation orientation;
+    orientation.detail = detail;
+
+    if (mirror)
+    {
+        orientation.detail.Mirror(MirrorAxis());
+    }
+    orientation.detail.Rotate(QPointF(), angle);
+
+    // Move piece to the origin. Position on a sheet is then just an offset of the bounding rect top left corner.
+    QVector<QPointF> points = orientation.detail.GetMappedLayoutAllowancePoints();
+    const QRectF rect = VLayoutPiece::BoundingRect(points);
+    orientation.detail.Translate(-rect.x(), -rect.y());
+
+    for (auto &p : points)
+    {
+        p -= rect.topLeft();
+    }
+
+    orientation.hull = ConvexHull(points);
+    orientation.size = rect.size();
+    orientation.key = QStringLiteral("%1:%2:%3")
+                          .arg(detail.GetUniqueID())
+                          .arg(qRound(NormalizeAngle(angle) * 1000))
+                          .arg(mirror ? 1 : 0);
+    return orientation;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Orientations(const VNfpPositionData &data) -> QVector<VNfpOrientation>
+{
+    const VLayoutPiece &detail = data.detail;
+
+    QVector<QPair<qreal, bool>> angles;
+
+    if (detail.IsGrainlineEnabled() && (data.followGrainline || detail.IsFollowGrainline()))
+    {
+        const bool mirror = detail.IsForceFlipping();
+        const QVector<qreal> grainlineAngles = GrainlineAngles(detail, mirror, data.isOriginPaperOrientationPortrait);
+        for (auto angle : grainlineAngles)
+        {
+            angles.append(qMakePair(angle, mirror));
+        }
+    }
+    else
+    {
+        QVector<bool> mirrors;
+        if (detail.IsForceFlipping())
+        {
+            mirrors = {true};
+        }
+        else if (detail.IsForbidFlipping())
+        {
+            mirrors = {false};
+        }
+        else
+        {
+            mirrors = {false, true};
+        }
+
+        const int number = data.rotate && data.rotationNumber >= 1 && data.rotationNumber <= 360 ? data.rotationNumber
+                                                                                                  : 1;
+        const qreal step = 360.0 / number;
+
+        for (auto mirror : mirrors)
+        {
+            for (int i = 0; i < number; ++i)
+            {
+                angles.append(qMakePair(i * step, mirror));
+            }
+        }
+    }
+
+    QVector<VNfpOrientation> orientations;
+    orientations.reserve(angles.size());
+
+    for (const auto &angle : angles)
+    {
+        VNfpOrientation orientation = Orientate(detail, angle.first, angle.second);
+        auto SameKey = [&orientation](const VNfpOrientation &o) { return o.key == orientation.key; };
+        if (orientation.hull.size() >= 3 && std::none_of(orientations.cbegin(), orientations.cend(), SameKey))
+        {
+            orientations.append(orientation);
+        }
+    }
+
+    return orientations;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Obstacles(const VNfpPositionData &data, const VNfpOrientation &orientation, const QRectF &innerFit)
+    -> VNfpObstacles
+{
+    const QRectF area = innerFit.adjusted(-accuracyPointOnLine, -accuracyPointOnLine, accuracyPointOnLine,
+                                          accuracyPointOnLine);
+
+    VNfpObstacles obstacles;
+    for (const auto &placed : data.placed)
+    {
+        QVector<QPointF> nfp = data.cache->NoFitPolygon(placed.key, placed.hull, orientation.key, orientation.hull);
+        for (auto &p : nfp)
+        {
+            p += placed.offset;
+        }
+
+        const QRectF rect = VLayoutPiece::BoundingRect(nfp);
+        if (rect.intersects(area))
+        {
+            obstacles.polygons.append(nfp);
+            obstacles.rects.append(rect);
+        }
+    }
+
+    return obstacles;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Edges(const QVector<QPointF> &polygon) -> QVector<QLineF>
+{
+    QVector<QLineF> edges;
+    edges.reserve(polygon.size());
+    for (vsizetype i = 0; i < polygon.size(); ++i)
+    {
+        edges.append(QLineF(polygon.at(i), polygon.at((i + 1) % polygon.size())));
+    }
+    return edges;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AppendIntersections(const QVector<QLineF> &edges1, const QVector<QLineF> &edges2, QVector<QPointF> &points)
+{
+    for (const auto &edge1 : edges1)
+    {
+        const QRectF rect1 = QRectF(edge1.p1(), edge1.p2()).normalized();
+        for (const auto &edge2 : edges2)
+        {
+            const QRectF rect2 = QRectF(edge2.p1(), edge2.p2()).normalized();
+            if (rect1.right() < rect2.left() || rect2.right() < rect1.left() || rect1.bottom() < rect2.top() ||
+                rect2.bottom() < rect1.top())
+            {
+                continue;
+            }
+
+            QPointF point;
+            if (edge1.intersects(edge2, &point) == QLineF::BoundedIntersection)
+            {
+                points.append(point);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CandidatePoints collect reference points where a piece touches other pieces or the sheet border.
+ */
+auto CandidatePoints(const VNfpObstacles &obstacles, const QRectF &innerFit) -> QVector<QPointF>
+{
+    QVector<QPointF> points{innerFit.topLeft(), innerFit.topRight(), innerFit.bottomLeft(), innerFit.bottomRight()};
+
+    const QVector<QLineF> border{QLineF(innerFit.topLeft(), innerFit.topRight()),
+                                 QLineF(innerFit.topRight(), innerFit.bottomRight()),
+                                 QLineF(innerFit.bottomRight(), innerFit.bottomLeft()),
+                                 QLineF(innerFit.bottomLeft(), innerFit.topLeft())};
+
+    QVector<QVector<QLineF>> edges;
+    edges.reserve(obstacles.polygons.size());
+
+    for (const auto &polygon : obstacles.polygons)
+    {
+        points.append(polygon);
+        edges.append(Edges(polygon));
+        AppendIntersections(edges.constLast(), border, points);
+    }
+
+    // Pockets between two pieces
+    for (vsizetype i = 0; i < edges.size(); ++i)
+    {
+        for (vsizetype j = i + 1; j < edges.size(); ++j)
+        {
+            if (obstacles.rects.at(i).intersects(obstacles.rects.at(j)))
+            {
+                AppendIntersections(edges.at(i), edges.at(j), points);
+            }
+        }
+    }
+
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto IsFree(const VNfpObstacles &obstacles, const QPointF &point) -> bool
+{
+    for (vsizetype i = 0; i < obstacles.polygons.size(); ++i)
+    {
+        if (obstacles.rects.at(i).contains(point) && NoFitPolygonContains(obstacles.polygons.at(i), point))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Crossing(const VPositionsIndex &positionsIndex, const VLayoutPiece &detail, VLayoutCounters *counters) -> bool
+{
+    if (positionsIndex.IsEmpty())
+    {
+        return false;
+    }
+
+    if (counters != nullptr)
+    {
+        counters->CountCollisionCheck();
+    }
+
+    QVector<QPointF> contourPoints;
+    CastTo(detail.IsSeamAllowance() && not detail.IsSeamAllowanceBuiltIn() ? detail.GetMappedSeamAllowancePoints()
+                                                                           : detail.GetMappedContourPoints(),
+           contourPoints);
+
+    return positionsIndex.Intersects(detail.GetMappedLayoutAllowancePoints(), contourPoints);
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VNfpPosition::ArrangeDetail(const VNfpPositionData &data, std::atomic_bool *stop) -> VNfpBestResult
+{
+    VNfpBestResult bestResult;
+
+    if (stop->load() || data.cache == nullptr || data.height <= 0 || data.width <= 0)
+    {
+        return bestResult;
+    }
+
+    try
+    {
+        const QVector<VNfpOrientation> orientations = Orientations(data);
+
+        QVector<VNfpObstacles> obstacles;
+        obstacles.reserve(orientations.size());
+
+        QVector<VNfpCandidate> candidates;
+
+        // Bounding rect of already placed pieces
+        QRectF usedRect;
+        for (const auto &position : data.positionsIndex.Positions())
+        {
+            usedRect = usedRect.united(position.boundingRect);
+        }
+
+        for (vsizetype i = 0; i < orientations.size(); ++i)
+        {
+            if (stop->load())
+            {
+                return bestResult;
+            }
+
+            const VNfpOrientation &orientation = orientations.at(i);
+            const qreal maxX = data.width - orientation.size.width();
+            const qreal maxY = data.height - orientation.size.height();
+
+            if (maxX < -accuracyPointOnLine || maxY < -accuracyPointOnLine)
+            {
+                obstacles.append(VNfpObstacles());
+                continue; // Doesn't fit the sheet in this orientation
+            }
+
+            const QRectF innerFit(0, 0, qMax(maxX, 0.0), qMax(maxY, 0.0));
+            obstacles.append(Obstacles(data, orientation, innerFit));
+
+            const QVector<QPointF> points = CandidatePoints(obstacles.constLast(), innerFit);
+            for (auto point : points)
+            {
+                if (point.x() < -accuracyPointOnLine || point.y() < -accuracyPointOnLine ||
+                    point.x() > innerFit.right() + accuracyPointOnLine ||
+                    point.y() > innerFit.bottom() + accuracyPointOnLine)
+                {
+                    continue;
+                }
+
+                point.setX(qBound(0.0, point.x(), innerFit.right()));
+                point.setY(qBound(0.0, point.y(), innerFit.bottom()));
+
+                // Ranking keys, the order depends on saving length
+                VNfpCandidate candidate;
+                candidate.orientation = i;
+                candidate.offset = point;
+
+                const QRectF united = usedRect.united(QRectF(point, orientation.size));
+                candidate.square = united.width() * united.height();
+
+                if (data.isOriginPaperOrientationPortrait)
+                {
+                    candidate.depth = point.y() + orientation.size.height();
+                    candidate.side = point.x();
+                }
+                else
+                {
+                    candidate.depth = point.x() + orientation.size.width();
+                    candidate.side = point.y();
+                }
+                candidates.append(candidate);
+            }
+        }
+
+        auto ByDepth = [](const VNfpCandidate &c1, const VNfpCandidate &c2)
+        { return c1.depth < c2.depth || (c1.depth == c2.depth && c1.side < c2.side); };
+
+        if (data.saveLength)
+        {
+            std::sort(candidates.begin(), candidates.end(), ByDepth);
+        }
+        else
+        {
+            std::sort(candidates.begin(), candidates.end(),
+                      [ByDepth](const VNfpCandidate &c1, const VNfpCandidate &c2)
+                      { return c1.square < c2.square || (c1.square == c2.square && ByDepth(c1, c2)); });
+        }
+
+        for (const auto &candidate : candidates)
+        {
+            if (stop->load())
+            {
+                return bestResult;
+            }
+
+            if (data.counters != nullptr)
+            {
+                data.counters->CountPlacement();
+            }
+
+            if (not IsFree(obstacles.at(candidate.orientation), candidate.offset))
+            {
+                continue;
+            }
+
+            const VNfpOrientation &orientation = orientations.at(candidate.orientation);
+
+            VLayoutPiece workDetail = orientation.detail;
+            workDetail.Translate(candidate.offset);
+
+            // Hulls touch here, pieces themselves may still cross because of rounding. Exact test has the last word.
+            if (Crossing(data.positionsIndex, workDetail, data.counters))
+            {
+                continue;
+            }
+
+            bestResult.valid = true;
+            bestResult.detail = workDetail;
+            bestResult.placed = {.key = orientation.key, .hull = orientation.hull, .offset = candidate.offset};
+            return bestResult;
+        }
+    }
+    catch (const VException &e)
+    {
+        bestResult.terminatedReason = QStringLiteral("%1\n\n%2").arg(e.ErrorMessage(), e.DetailedInformation());
+    }
+    catch (std::exception &e)
+    {
+        bestResult.terminatedReason = QString::fromLatin1(e.what());
+    }
+
+    return bestResult;
+}
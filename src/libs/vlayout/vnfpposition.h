@@ -0,0 +1,90 @@
+/************************************************************************
+ **
+ **  @file   vnfpposition.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VNFPPOSITION_H
+#define VNFPPOSITION_H
+
+#include <QPointF>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+
+#include "vlayoutpiece.h"
+#include "vpositionsindex.h"
+
+class VNoFitPolygonCache;
+
+struct VNfpPlacedPiece
+{
+    QString key{};           // NOLINT(misc-non-private-member-variables-in-classes)
+    QVector<QPointF> hull{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    QPointF offset{};        // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+struct VNfpPositionData
+{
+    int height{0};
+    int width{0};
+    VLayoutPiece detail{};
+    bool rotate{false};
+    int rotationNumber{0};
+    bool followGrainline{false};
+    bool isOriginPaperOrientationPortrait{true};
+    bool saveLength{false};
+    VPositionsIndex positionsIndex{};
+    QVector<VNfpPlacedPiece> placed{};
+    VNoFitPolygonCache *cache{nullptr};
+    VLayoutCounters *counters{nullptr};
+};
+
+struct VNfpBestResult
+{
+    bool valid{false};
+    VLayoutPiece detail{};
+    VNfpPlacedPiece placed{};
+    QString terminatedReason{};
+};
+
+/**
+ * @brief The VNfpPosition class places a piece on a sheet using no-fit polygons.
+ *
+ * For every allowed orientation of the piece the positions where it touches, but does not overlap, already placed
+ * pieces are taken from vertexes and edge intersections of no-fit polygons clipped by the sheet (inner-fit rectangle).
+ * With saving length the candidate that keeps the used part of the sheet shortest wins (bottom-left-fill). Otherwise
+ * the candidate with the smallest bounding rect of all placed pieces wins, like in the contour sliding engine.
+ *
+ * No-fit polygons are built from convex hulls. A piece therefore never goes into a concavity of another piece, concave
+ * pieces are placed as if they were convex. Every candidate is still validated with exact polygon tests.
+ */
+class VNfpPosition
+{
+public:
+    static auto ArrangeDetail(const VNfpPositionData &data, std::atomic_bool *stop) -> VNfpBestResult;
+};
+
+#endif // VNFPPOSITION_H
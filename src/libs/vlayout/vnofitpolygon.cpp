@@ -0,0 +1,263 @@
+/************************************************************************
+ **
+ **  @file   vnofitpolygon.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vnofitpolygon.h"
+
+#include <QMutexLocker>
+#include <QtMath>
+#include <algorithm>
+
+#include "../vgeometry/vgeometrydef.h"
+#include "../vgeometry/vpolygonintersection.h"
+
+namespace
+{
+// Distance inside a no-fit polygon below which a point still counts as touching.
+constexpr qreal nfpTolerance = 1e-6;
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Cross(const QPointF &a, const QPointF &b) -> qreal
+{
+    return a.x() * b.y() - a.y() * b.x();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto LowerPoint(const QPointF &p1, const QPointF &p2) -> bool
+{
+    // Exact compare, a fuzzy one is not a strict weak ordering
+    return p1.y() < p2.y() || (p1.y() == p2.y() && p1.x() < p2.x());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StartFromLowest rotates a convex polygon so that it starts from the lowest vertex.
+ */
+auto StartFromLowest(QVector<QPointF> polygon) -> QVector<QPointF>
+{
+    auto lowest = std::min_element(polygon.begin(), polygon.end(), LowerPoint);
+    std::rotate(polygon.begin(), lowest, polygon.end());
+    return polygon;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ConvexHull builds convex hull of points (Andrew's monotone chain).
+ *
+ * Collinear and near duplicate points are removed. The hull is returned counterclockwise (positive orientation)
+ * without repeating the first point.
+ * @param points list of points.
+ * @return convex hull.
+ */
+auto ConvexHull(QVector<QPointF> points) -> QVector<QPointF>
+{
+    // Exact lexicographic order. A fuzzy compare is not a strict weak ordering and breaks std::sort.
+    std::sort(points.begin(), points.end(),
+              [](const QPointF &p1, const QPointF &p2)
+              { return p1.x() < p2.x() || (p1.x() == p2.x() && p1.y() < p2.y()); });
+    auto NearDuplicate = [](const QPointF &p1, const QPointF &p2) { return VFuzzyComparePoints(p1, p2, nfpTolerance); };
+    points.erase(std::unique(points.begin(), points.end(), NearDuplicate), points.end());
+
+    if (points.size() < 3)
+    {
+        return points;
+    }
+
+    QVector<QPointF> hull(points.size() * 2);
+    vsizetype k = 0;
+
+    for (const auto &p : points)
+    {
+        while (k >= 2 && Orient2D(hull.at(k - 2), hull.at(k - 1), p) <= 0)
+        {
+            --k;
+        }
+        hull[k++] = p;
+    }
+
+    for (vsizetype i = points.size() - 2, lower = k + 1; i >= 0; --i)
+    {
+        while (k >= lower && Orient2D(hull.at(k - 2), hull.at(k - 1), points.at(i)) <= 0)
+        {
+            --k;
+        }
+        hull[k++] = points.at(i);
+    }
+
+    hull.resize(k - 1); // Last point is equal to the first one
+    return hull;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MinkowskiNoFitPolygon builds no-fit polygon of two convex polygons.
+ *
+ * The no-fit polygon is the Minkowski sum of the fixed polygon and the moving polygon reflected through the origin. If
+ * the moving polygon is translated by a vector strictly inside the no-fit polygon both polygons overlap, on its
+ * boundary they touch. The sum of two convex polygons is built by merging their edges sorted by angle, so the cost is
+ * linear.
+ * @param fixedHull convex polygon that stays in place, counterclockwise.
+ * @param movingHull convex polygon that is moved, counterclockwise.
+ * @return no-fit polygon, counterclockwise.
+ */
+auto MinkowskiNoFitPolygon(const QVector<QPointF> &fixedHull, const QVector<QPointF> &movingHull) -> QVector<QPointF>
+{
+    if (fixedHull.isEmpty() || movingHull.isEmpty())
+    {
+        return {};
+    }
+
+    QVector<QPointF> reflected;
+    reflected.reserve(movingHull.size());
+    for (const auto &p : movingHull)
+    {
+        reflected.append(-p);
+    }
+
+    QVector<QPointF> p = StartFromLowest(fixedHull);
+    QVector<QPointF> q = StartFromLowest(reflected);
+
+    const vsizetype n = p.size();
+    const vsizetype m = q.size();
+
+    // Close both polygons to be able to take an edge after the last vertex
+    p.append(p.at(0));
+    p.append(p.at(1 % n));
+    q.append(q.at(0));
+    q.append(q.at(1 % m));
+
+    QVector<QPointF> nfp;
+    nfp.reserve(n + m);
+
+    vsizetype i = 0;
+    vsizetype j = 0;
+    while (i < n || j < m)
+    {
+        nfp.append(p.at(i) + q.at(j));
+
+        const qreal cross = Cross(p.at(i + 1) - p.at(i), q.at(j + 1) - q.at(j));
+        const bool nextI = i < n && (j >= m || cross >= 0);
+        const bool nextJ = j < m && (i >= n || cross <= 0);
+
+        i += nextI ? 1 : 0;
+        j += nextJ ? 1 : 0;
+    }
+
+    return nfp;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief NoFitPolygonContains check if a point lies strictly inside a convex no-fit polygon.
+ *
+ * Points on the boundary mean touching pieces and are not contained.
+ * @param nfp convex no-fit polygon, counterclockwise.
+ * @param point point to test.
+ * @return true if point is inside.
+ */
+auto NoFitPolygonContains(const QVector<QPointF> &nfp, const QPointF &point) -> bool
+{
+    if (nfp.size() < 3)
+    {
+        return false;
+    }
+
+    for (vsizetype i = 0; i < nfp.size(); ++i)
+    {
+        const QPointF &p1 = nfp.at(i);
+        const QPointF &p2 = nfp.at((i + 1) % nfp.size());
+        const QPointF edge = p2 - p1;
+        const qreal length = qSqrt(QPointF::dotProduct(edge, edge));
+
+        if (qFuzzyIsNull(length))
+        {
+            continue;
+        }
+
+        if (Cross(edge, point - p1) / length <= nfpTolerance)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VNoFitPolygonCache::NoFitPolygon(const QString &fixedKey, const QVector<QPointF> &fixedHull,
+                                      const QString &movingKey, const QVector<QPointF> &movingHull) -> QVector<QPointF>
+{
+    const QString key = QStringLiteral("%1|%2").arg(fixedKey, movingKey);
+
+    {
+        QMutexLocker const locker(&m_mutex);
+        auto polygon = m_polygons.constFind(key);
+        if (polygon != m_polygons.constEnd())
+        {
+            ++m_hits;
+            return *polygon;
+        }
+        ++m_misses;
+    }
+
+    // Build outside the lock. Two threads may do the same work once, but never wait for each other.
+    QVector<QPointF> nfp = MinkowskiNoFitPolygon(fixedHull, movingHull);
+
+    QMutexLocker const locker(&m_mutex);
+    m_polygons.insert(key, nfp);
+    return nfp;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VNoFitPolygonCache::Clear()
+{
+    QMutexLocker const locker(&m_mutex);
+    m_polygons.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VNoFitPolygonCache::Count() const -> vsizetype
+{
+    QMutexLocker const locker(&m_mutex);
+    return m_polygons.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VNoFitPolygonCache::Hits() const -> quint64
+{
+    QMutexLocker const locker(&m_mutex);
+    return m_hits;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VNoFitPolygonCache::Misses() const -> quint64
+{
+    QMutexLocker const locker(&m_mutex);
+    return m_misses;
+}
@@ -0,0 +1,76 @@
+/************************************************************************
+ **
+ **  @file   vnofitpolygon.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VNOFITPOLYGON_H
+#define VNOFITPOLYGON_H
+
+#include <QHash>
+#include <QMutex>
+#include <QPointF>
+#include <QRectF>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+#include "../vmisc/defglobal.h"
+
+auto ConvexHull(QVector<QPointF> points) -> QVector<QPointF>;
+auto MinkowskiNoFitPolygon(const QVector<QPointF> &fixedHull, const QVector<QPointF> &movingHull) -> QVector<QPointF>;
+auto NoFitPolygonContains(const QVector<QPointF> &nfp, const QPointF &point) -> bool;
+
+/**
+ * @brief The VNoFitPolygonCache class keeps no-fit polygons of piece pairs.
+ *
+ * A no-fit polygon depends only on the shape of both pieces, not on their position, so it is computed once for each
+ * pair of piece orientations and reused for every sheet and every copy of a piece. The cache is shared between
+ * nesting threads.
+ */
+class VNoFitPolygonCache
+{
+public:
+    VNoFitPolygonCache() = default;
+    ~VNoFitPolygonCache() = default;
+
+    auto NoFitPolygon(const QString &fixedKey, const QVector<QPointF> &fixedHull, const QString &movingKey,
+                      const QVector<QPointF> &movingHull) -> QVector<QPointF>;
+
+    void Clear();
+
+    auto Count() const -> vsizetype;
+    auto Hits() const -> quint64;
+    auto Misses() const -> quint64;
+
+private:
+    Q_DISABLE_COPY_MOVE(VNoFitPolygonCache) // NOLINT
+
+    mutable QMutex m_mutex{};
+    QHash<QString, QVector<QPointF>> m_polygons{};
+    quint64 m_hits{0};
+    quint64 m_misses{0};
+};
+
+#endif // VNOFITPOLYGON_H
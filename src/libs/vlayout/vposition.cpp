@@ -299,6 +299,7 @@ auto VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge) -> bo
     bool flagSquare = false;
 
     CombineEdges(detail, globalEdge, dEdge);
+    CountPlacement();
 
 #ifdef LAYOUT_DEBUG
 #ifdef SHOW_COMBINE
@@ -349,6 +350,7 @@ auto VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge) -> bo
         }
 
         dEdge = *layoutEdge;
+        CountPlacement();
         CrossingType type = CrossingType::Intersection;
         if (SheetContains(detail.MappedDetailBoundingRect()))
         {
@@ -384,6 +386,7 @@ auto VPosition::CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, qreal
     }
 
     RotateEdges(detail, globalEdge, dEdge, angle);
+    CountPlacement();
 
 #ifdef LAYOUT_DEBUG
 #ifdef SHOW_ROTATION
@@ -439,35 +442,33 @@ void VPosition::RotateOnAngle(qreal angle)
 //---------------------------------------------------------------------------------------------------------------------
 auto VPosition::Crossing(const VLayoutPiece &detail) const -> VPosition::CrossingType
 {
-    if (m_data.positionsCache.isEmpty())
+    if (m_data.positionsIndex.IsEmpty())
     {
         return CrossingType::NoIntersection;
     }
 
-    const QVector<QPointF> layoutPoints = detail.GetMappedLayoutAllowancePoints();
-    const QRectF layoutBoundingRect = VLayoutPiece::BoundingRect(layoutPoints);
-    const QPainterPath layoutAllowancePath = VGObject::PainterPath(layoutPoints);
+    if (m_data.counters != nullptr)
+    {
+        m_data.counters->CountCollisionCheck();
+    }
 
     QVector<QPointF> contourPoints;
     CastTo(detail.IsSeamAllowance() && not detail.IsSeamAllowanceBuiltIn() ? detail.GetMappedSeamAllowancePoints()
                                                                            : detail.GetMappedContourPoints(),
            contourPoints);
-    const QRectF detailBoundingRect = VLayoutPiece::BoundingRect(contourPoints);
-    const QPainterPath contourPath = VGObject::PainterPath(contourPoints);
 
-    for (const auto &position : m_data.positionsCache)
+    return m_data.positionsIndex.Intersects(detail.GetMappedLayoutAllowancePoints(), contourPoints)
+               ? CrossingType::Intersection
+               : CrossingType::NoIntersection;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPosition::CountPlacement() const
+{
+    if (m_data.counters != nullptr)
     {
-        if ((position.boundingRect.intersects(layoutBoundingRect) ||
-             position.boundingRect.contains(detailBoundingRect) ||
-             detailBoundingRect.contains(position.boundingRect)) &&
-            (position.layoutAllowancePath.contains(contourPath) || contourPath.contains(position.layoutAllowancePath) ||
-             position.layoutAllowancePath.intersects(layoutAllowancePath)))
-        {
-            return CrossingType::Intersection;
-        }
+        m_data.counters->CountPlacement();
     }
-
-    return CrossingType::NoIntersection;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -42,6 +42,7 @@
 #include "vcontour.h"
 #include "vlayoutdef.h"
 #include "vlayoutpiece.h"
+#include "vpositionsindex.h"
 
 struct VPositionData
 {
@@ -52,8 +53,9 @@ struct VPositionData
     bool rotate{false};
     int rotationNumber{0};
     bool followGrainline{false};
-    QVector<VCachedPositions> positionsCache{};
+    VPositionsIndex positionsIndex{};
     bool isOriginPaperOrientationPortrait{true};
+    VLayoutCounters *counters{nullptr};
 #ifdef LAYOUT_DEBUG
     QVector<VLayoutPiece> details{};
     QMutex *mutex{nullptr};
@@ -119,6 +121,7 @@ private:
     void RotateOnAngle(qreal angle);
 
     auto Crossing(const VLayoutPiece &detail) const -> CrossingType;
+    void CountPlacement() const;
     auto SheetContains(const QRectF &rect) const -> bool;
 
     void CombineEdges(VLayoutPiece &detail, const QLineF &globalEdge, int dEdge);
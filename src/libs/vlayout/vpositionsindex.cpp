@@ -0,0 +1,196 @@
+/************************************************************************
+ **
+ **  @file   vpositionsindex.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vpositionsindex.h"
+
+#include "vlayoutpiece.h"
+
+#include <QtMath>
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+constexpr int maxCellIndex = 1 << 30;
+
+//---------------------------------------------------------------------------------------------------------------------
+auto CellIndex(qreal value, qreal cellSize) -> int
+{
+    const qreal index = qFloor(value / cellSize);
+    return static_cast<int>(qBound(static_cast<qreal>(-maxCellIndex), index, static_cast<qreal>(maxCellIndex)));
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPositionsIndex::Append(const VCachedPositions &position)
+{
+    const vsizetype index = m_positions.size();
+    m_positions.append(position);
+
+    const QRectF rect = position.boundingRect.normalized();
+
+    if (m_cellSize <= 0)
+    {
+        m_cellSize = qMax(qMax(rect.width(), rect.height()), 1.0);
+    }
+
+    int left = 0;
+    int top = 0;
+    int right = 0;
+    int bottom = 0;
+    if (not CellRange(rect, left, top, right, bottom))
+    {
+        return;
+    }
+
+    for (int column = left; column <= right; ++column)
+    {
+        for (int row = top; row <= bottom; ++row)
+        {
+            m_cells[CellKey(column, row)].append(index);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Candidates return indexes of all positions whose cells overlap the rect.
+ *
+ * The result is a superset of positions whose bounding rect intersects or contains the rect, sorted in the order the
+ * positions were appended. Exact tests are left to the caller.
+ * @param rect probe rect.
+ * @return list of position indexes.
+ */
+auto VPositionsIndex::Candidates(const QRectF &rect) const -> QVector<vsizetype>
+{
+    QVector<vsizetype> candidates;
+
+    if (m_positions.isEmpty())
+    {
+        return candidates;
+    }
+
+    int left = 0;
+    int top = 0;
+    int right = 0;
+    int bottom = 0;
+    if (not CellRange(rect.normalized(), left, top, right, bottom))
+    {
+        return candidates;
+    }
+
+    const qint64 cellsCount = (static_cast<qint64>(right) - left + 1) * (static_cast<qint64>(bottom) - top + 1);
+    if (cellsCount >= m_cells.size())
+    {
+        // The probe covers the whole occupied area anyway. Walking the cells would be slower than taking all.
+        candidates.resize(m_positions.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+        return candidates;
+    }
+
+    for (int column = left; column <= right; ++column)
+    {
+        for (int row = top; row <= bottom; ++row)
+        {
+            auto cell = m_cells.constFind(CellKey(column, row));
+            if (cell != m_cells.constEnd())
+            {
+                candidates.append(*cell);
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    return candidates;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Intersects check if a piece collides with any registered piece.
+ * @param layoutPoints layout allowance of the piece.
+ * @param contourPoints seam allowance or main path of the piece.
+ * @return true if the piece overlaps or contains a registered piece or is contained by it.
+ */
+auto VPositionsIndex::Intersects(const QVector<QPointF> &layoutPoints, const QVector<QPointF> &contourPoints) const
+    -> bool
+{
+    if (m_positions.isEmpty())
+    {
+        return false;
+    }
+
+    const QRectF layoutBoundingRect = VLayoutPiece::BoundingRect(layoutPoints);
+    const QRectF detailBoundingRect = VLayoutPiece::BoundingRect(contourPoints);
+
+    // Only pieces sharing a grid cell with the candidate can pass the bounding rect test below.
+    const QVector<vsizetype> candidates = Candidates(layoutBoundingRect.united(detailBoundingRect));
+    if (candidates.isEmpty())
+    {
+        return false;
+    }
+
+    const VPolygonEdges layoutAllowance(layoutPoints);
+    const VPolygonEdges contour(contourPoints);
+
+    for (auto index : candidates)
+    {
+        const VCachedPositions &position = m_positions.at(index);
+        if ((position.boundingRect.intersects(layoutBoundingRect) ||
+             position.boundingRect.contains(detailBoundingRect) ||
+             detailBoundingRect.contains(position.boundingRect)) &&
+            (PolygonContains(position.layoutAllowance, contour) || PolygonContains(contour, position.layoutAllowance) ||
+             PolygonsOverlap(position.layoutAllowance, layoutAllowance)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPositionsIndex::CellRange(const QRectF &rect, int &left, int &top, int &right, int &bottom) const -> bool
+{
+    if (m_cellSize <= 0 || not qIsFinite(rect.left()) || not qIsFinite(rect.top()) || not qIsFinite(rect.right()) ||
+        not qIsFinite(rect.bottom()))
+    {
+        return false;
+    }
+
+    left = CellIndex(rect.left(), m_cellSize);
+    top = CellIndex(rect.top(), m_cellSize);
+    right = CellIndex(rect.right(), m_cellSize);
+    bottom = CellIndex(rect.bottom(), m_cellSize);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPositionsIndex::CellKey(int column, int row) -> quint64
+{
+    return (static_cast<quint64>(static_cast<quint32>(column)) << 32U) | static_cast<quint32>(row);
+}
@@ -0,0 +1,102 @@
+/************************************************************************
+ **
+ **  @file   vpositionsindex.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VPOSITIONSINDEX_H
+#define VPOSITIONSINDEX_H
+
+#include <QHash>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+
+#include "../vmisc/defglobal.h"
+#include "vlayoutdef.h"
+
+/**
+ * @brief The VPositionsIndex class is a uniform grid over the pieces already placed on a sheet.
+ *
+ * Each placed piece is registered in every cell its bounding rect touches. A collision probe asks only for the pieces
+ * that share a cell with the probe rect instead of scanning the whole sheet. The cell size is taken from the first
+ * piece, layout pieces are usually of comparable size.
+ */
+class VPositionsIndex
+{
+public:
+    VPositionsIndex() = default;
+
+    void Append(const VCachedPositions &position);
+
+    auto Candidates(const QRectF &rect) const -> QVector<vsizetype>;
+    auto Intersects(const QVector<QPointF> &layoutPoints, const QVector<QPointF> &contourPoints) const -> bool;
+    auto Positions() const -> const QVector<VCachedPositions> &;
+
+    auto At(vsizetype i) const -> const VCachedPositions &;
+    auto Count() const -> vsizetype;
+    auto IsEmpty() const -> bool;
+
+    auto CellSize() const -> qreal;
+
+private:
+    QVector<VCachedPositions> m_positions{};
+    QHash<quint64, QVector<vsizetype>> m_cells{};
+    qreal m_cellSize{0};
+
+    auto CellRange(const QRectF &rect, int &left, int &top, int &right, int &bottom) const -> bool;
+    static auto CellKey(int column, int row) -> quint64;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPositionsIndex::Positions() const -> const QVector<VCachedPositions> &
+{
+    return m_positions;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPositionsIndex::At(vsizetype i) const -> const VCachedPositions &
+{
+    return m_positions.at(i);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPositionsIndex::Count() const -> vsizetype
+{
+    return m_positions.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPositionsIndex::IsEmpty() const -> bool
+{
+    return m_positions.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VPositionsIndex::CellSize() const -> qreal
+{
+    return m_cellSize;
+}
+
+#endif // VPOSITIONSINDEX_H
@@ -43,7 +43,7 @@
 using namespace Qt::Literals::StringLiterals;
 
 const QByteArray VRawLayout::fileHeaderByteArray = "RLD!..."_ba;
-const quint16 VRawLayout::fileVersion = 1;
+const quint16 VRawLayout::fileVersion = 2;
 
 const quint32 VRawLayoutData::streamHeader = 0x8B0E8A27; // CRC-32Q string "VRawLayoutData"
 const quint16 VRawLayoutData::classVersion = 1;
@@ -51,52 +51,93 @@ const quint16 VRawLayoutData::classVersion = 1;
 //---------------------------------------------------------------------------------------------------------------------
 auto operator<<(QDataStream &dataStream, const VRawLayoutData &data) -> QDataStream &
 {
-    dataStream << VRawLayoutData::streamHeader << VRawLayoutData::classVersion;
+    VRawLayoutData::WriteStreamHeader(dataStream);
 
     // Added in classVersion = 1
     dataStream << data.pieces;
 
-    // Added in classVersion = 2
+    data.WriteProperties(dataStream);
 
     return dataStream;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto operator>>(QDataStream &dataStream, VRawLayoutData &data) -> QDataStream &
+{
+    const quint16 actualClassVersion = VRawLayoutData::ReadStreamHeader(dataStream);
+
+    dataStream >> data.pieces;
+
+    data.ReadProperties(dataStream, actualClassVersion);
+
+    return dataStream;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VRawLayoutData::WriteStreamHeader(QDataStream &dataStream)
+{
+    dataStream << streamHeader << classVersion;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadStreamHeader checks the header of the stream.
+ * @return class version of the stream. Throws VException if the stream is corrupt or from a future version.
+ */
+auto VRawLayoutData::ReadStreamHeader(QDataStream &dataStream) -> quint16
 {
     quint32 actualStreamHeader = 0;
     dataStream >> actualStreamHeader;
 
-    if (actualStreamHeader != VRawLayoutData::streamHeader)
+    if (actualStreamHeader != streamHeader)
     {
         QString const message =
             QCoreApplication::tr("VRawLayoutData prefix mismatch error: actualStreamHeader = 0x%1 and "
                                  "streamHeader = 0x%2")
                 .arg(actualStreamHeader, 8, 0x10, '0'_L1)
-                .arg(VRawLayoutData::streamHeader, 8, 0x10, '0'_L1);
+                .arg(streamHeader, 8, 0x10, '0'_L1);
         throw VException(message);
     }
 
     quint16 actualClassVersion = 0;
     dataStream >> actualClassVersion;
 
-    if (actualClassVersion > VRawLayoutData::classVersion)
+    if (actualClassVersion > classVersion)
     {
         QString const message = QCoreApplication::tr("VRawLayoutData compatibility error: actualClassVersion = %1 and "
                                                      "classVersion = %2")
                                     .arg(actualClassVersion)
-                                    .arg(VRawLayoutData::classVersion);
+                                    .arg(classVersion);
         throw VException(message);
     }
 
-    dataStream >> data.pieces;
+    return actualClassVersion;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WriteProperties writes all fields except pieces.
+ */
+void VRawLayoutData::WriteProperties(QDataStream &dataStream) const
+{
+    Q_UNUSED(dataStream)
+
+    // Added in classVersion = 2
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadProperties reads all fields except pieces.
+ */
+void VRawLayoutData::ReadProperties(QDataStream &dataStream, quint16 actualClassVersion)
+{
+    Q_UNUSED(dataStream)
+    Q_UNUSED(actualClassVersion)
 
     //    if (actualClassVersion >= 2)
     //    {
     //        // read value in version 2
     //    }
-
-    return dataStream;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -112,10 +153,24 @@ auto VRawLayout::WriteFile(QIODevice *ioDevice, const VRawLayoutData &data) -> b
         QDataStream dataStream(ioDevice);
         dataStream.setVersion(QDataStream::Qt_5_15);
 
+        // The piece index needs random access. Sequential devices get the format of the first version.
+        const quint16 version = ioDevice->isSequential() ? 1 : fileVersion;
+
         // Don't use the << operator for QByteArray. See the note in ReadFile() below.
         dataStream.writeRawData(fileHeaderByteArray.constData(), static_cast<int>(fileHeaderByteArray.size()));
-        dataStream << fileVersion;
-        dataStream << data;
+        dataStream << version;
+
+        if (version == 1)
+        {
+            dataStream << data;
+        }
+        else
+        {
+            // Everything except pieces goes before the piece index
+            VRawLayoutData::WriteStreamHeader(dataStream);
+            data.WriteProperties(dataStream);
+            WritePieces(ioDevice, dataStream, data.pieces);
+        }
 
         if (not wasOpen)
         {
@@ -152,31 +207,9 @@ auto VRawLayout::ReadFile(QIODevice *ioDevice, VRawLayoutData &data) -> bool
         QDataStream dataStream(ioDevice);
         dataStream.setVersion(QDataStream::Qt_5_15);
 
-        // Note: we could have used the QDataStream << and >> operators on QByteArray but since the first
-        // bytes of the stream will be the size of the array, we might end up attempting to allocate
-        // a large amount of memory if the wrong file type was read. Instead, we'll just read the
-        // same number of bytes that are in the array we are comparing it to. No size was written.
-        const auto len = static_cast<int>(fileHeaderByteArray.size());
-        QByteArray actualFileHeaderByteArray(len, '\0');
-        dataStream.readRawData(actualFileHeaderByteArray.data(), len);
-
-        if (actualFileHeaderByteArray != fileHeaderByteArray)
-        {
-            // prefixes don't match
-            m_errorString = tr("VRawLayout::ReadFile() failed. Raw layout format prefix mismatch error.");
-            return false;
-        }
-
         quint16 actualFileVersion = 0;
-        dataStream >> actualFileVersion;
-
-        if (actualFileVersion > fileVersion)
+        if (not ReadHeader(dataStream, actualFileVersion))
         {
-            // file is from a future version that we don't know how to load
-            m_errorString = tr("VRawLayout::ReadFile() failed.\n"
-                               "Raw layout format compatibility error: actualFileVersion = %1 and fileVersion = %2")
-                                .arg(actualFileVersion)
-                                .arg(fileVersion);
             return false;
         }
 
@@ -184,7 +217,15 @@ auto VRawLayout::ReadFile(QIODevice *ioDevice, VRawLayoutData &data) -> bool
         {
             // This may throw an exception if one of the VRawLayoutData objects is corrupt or unsupported.
             // For example, if this file is from a future version of this code.
-            dataStream >> data;
+            if (actualFileVersion == 1)
+            {
+                dataStream >> data;
+            }
+            else
+            {
+                data.ReadProperties(dataStream, VRawLayoutData::ReadStreamHeader(dataStream));
+                ReadPieces(dataStream, data.pieces);
+            }
         }
         catch (const VException &e)
         {
@@ -194,6 +235,12 @@ auto VRawLayout::ReadFile(QIODevice *ioDevice, VRawLayoutData &data) -> bool
             return false;
         }
 
+        if (dataStream.status() != QDataStream::Ok)
+        {
+            m_errorString = tr("VRawLayout::ReadFile() failed. Unexpected end of data.");
+            return false;
+        }
+
         return true;
     }
 
@@ -240,3 +287,252 @@ auto VRawLayout::ReadFile(const QString &filePath, VRawLayoutData &data) -> bool
     m_errorString = file.errorString();
     return false;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VRawLayout::ReadHeader(QDataStream &dataStream, quint16 &version) -> bool
+{
+    // Note: we could have used the QDataStream << and >> operators on QByteArray but since the first
+    // bytes of the stream will be the size of the array, we might end up attempting to allocate
+    // a large amount of memory if the wrong file type was read. Instead, we'll just read the
+    // same number of bytes that are in the array we are comparing it to. No size was written.
+    const auto len = static_cast<int>(fileHeaderByteArray.size());
+    QByteArray actualFileHeaderByteArray(len, '\0');
+    dataStream.readRawData(actualFileHeaderByteArray.data(), len);
+
+    if (actualFileHeaderByteArray != fileHeaderByteArray)
+    {
+        // prefixes don't match
+        m_errorString = tr("VRawLayout::ReadFile() failed. Raw layout format prefix mismatch error.");
+        return false;
+    }
+
+    version = 0;
+    dataStream >> version;
+
+    if (version > fileVersion)
+    {
+        // file is from a future version that we don't know how to load
+        m_errorString = tr("VRawLayout::ReadFile() failed.\n"
+                           "Raw layout format compatibility error: actualFileVersion = %1 and fileVersion = %2")
+                            .arg(version)
+                            .arg(fileVersion);
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WritePieces writes the piece index followed by pieces.
+ *
+ * The index holds the position of each piece in the file. It is filled after pieces were written.
+ */
+void VRawLayout::WritePieces(QIODevice *ioDevice, QDataStream &dataStream, const QVector<VLayoutPiece> &pieces)
+{
+    dataStream << static_cast<quint32>(pieces.size());
+
+    const qint64 indexPos = ioDevice->pos();
+    for (vsizetype i = 0; i < pieces.size(); ++i)
+    {
+        dataStream << static_cast<quint64>(0);
+    }
+
+    QVector<quint64> offsets;
+    offsets.reserve(pieces.size());
+
+    for (const auto &piece : pieces)
+    {
+        offsets.append(static_cast<quint64>(ioDevice->pos()));
+        dataStream << piece;
+    }
+
+    const qint64 endPos = ioDevice->pos();
+    ioDevice->seek(indexPos);
+
+    for (auto offset : offsets)
+    {
+        dataStream << offset;
+    }
+
+    ioDevice->seek(endPos);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadPieces reads the piece index and pieces sequentially.
+ */
+void VRawLayout::ReadPieces(QDataStream &dataStream, QVector<VLayoutPiece> &pieces)
+{
+    quint32 count = 0;
+    dataStream >> count;
+
+    // Pieces follow the index in the same order. Sequential reading does not need offsets.
+    for (quint32 i = 0; i < count && dataStream.status() == QDataStream::Ok; ++i)
+    {
+        quint64 offset = 0;
+        dataStream >> offset;
+    }
+
+    pieces.clear();
+    for (quint32 i = 0; i < count && dataStream.status() == QDataStream::Ok; ++i)
+    {
+        VLayoutPiece piece;
+        dataStream >> piece;
+        pieces.append(piece);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VMappedRawLayout::VMappedRawLayout(const QString &filePath)
+  : m_file(filePath)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VMappedRawLayout::Open() -> bool
+{
+    m_errorString.clear();
+
+    if (not m_file.open(QIODevice::ReadOnly))
+    {
+        m_errorString = m_file.errorString();
+        return false;
+    }
+
+    QDataStream dataStream(&m_file);
+    dataStream.setVersion(QDataStream::Qt_5_15);
+
+    VRawLayout reader;
+    quint16 version = 0;
+    if (not reader.ReadHeader(dataStream, version))
+    {
+        m_errorString = reader.ErrorString();
+        return false;
+    }
+
+    if (version == 1)
+    {
+        // No piece index, read the whole file
+        m_file.seek(0);
+
+        VRawLayoutData data;
+        if (not reader.ReadFile(&m_file, data))
+        {
+            m_errorString = reader.ErrorString();
+            return false;
+        }
+
+        m_pieces = data.pieces;
+        m_file.close();
+        return true;
+    }
+
+    m_size = m_file.size();
+
+    try
+    {
+        // Fields other than pieces are not used here, but they must be read to get to the piece index
+        VRawLayoutData properties;
+        properties.ReadProperties(dataStream, VRawLayoutData::ReadStreamHeader(dataStream));
+    }
+    catch (const VException &e)
+    {
+        m_errorString = e.ErrorMessage();
+        return false;
+    }
+
+    quint32 count = 0;
+    dataStream >> count;
+
+    if (dataStream.status() != QDataStream::Ok)
+    {
+        m_errorString = tr("Raw layout piece index is corrupted.");
+        return false;
+    }
+
+    if (static_cast<qint64>(count) * static_cast<qint64>(sizeof(quint64)) > m_size)
+    {
+        m_errorString = tr("Raw layout piece index is corrupted.");
+        return false;
+    }
+
+    m_offsets.resize(static_cast<vsizetype>(count));
+    for (auto &offset : m_offsets)
+    {
+        dataStream >> offset;
+    }
+
+    const qint64 dataPos = m_file.pos();
+    for (vsizetype i = 0; i < m_offsets.size(); ++i)
+    {
+        const quint64 previous = i > 0 ? m_offsets.at(i - 1) : static_cast<quint64>(dataPos);
+        if (dataStream.status() != QDataStream::Ok || m_offsets.at(i) < previous ||
+            m_offsets.at(i) >= static_cast<quint64>(m_size))
+        {
+            m_errorString = tr("Raw layout piece index is corrupted.");
+            return false;
+        }
+    }
+
+    m_data = m_file.map(0, m_size);
+    if (m_data == nullptr)
+    {
+        m_errorString = m_file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Piece decodes a piece from the mapped file. Geometry of other pieces stays on disk.
+ * @param index piece index.
+ * @param piece decoded piece.
+ * @return true if success.
+ */
+auto VMappedRawLayout::Piece(vsizetype index, VLayoutPiece &piece) -> bool
+{
+    m_errorString.clear();
+
+    if (index < 0 || index >= PieceCount())
+    {
+        m_errorString = tr("Raw layout has no piece with index %1.").arg(index);
+        return false;
+    }
+
+    if (m_data == nullptr)
+    {
+        piece = m_pieces.at(index);
+        return true;
+    }
+
+    const quint64 begin = m_offsets.at(index);
+    const quint64 end = index + 1 < m_offsets.size() ? m_offsets.at(index + 1) : static_cast<quint64>(m_size);
+
+    // Wraps the mapped memory without copying
+    const QByteArray record = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data + begin),
+                                                      static_cast<vsizetype>(end - begin));
+
+    QDataStream dataStream(record);
+    dataStream.setVersion(QDataStream::Qt_5_15);
+
+    try
+    {
+        dataStream >> piece;
+    }
+    catch (const VException &e)
+    {
+        m_errorString = e.ErrorMessage();
+        return false;
+    }
+
+    if (dataStream.status() != QDataStream::Ok)
+    {
+        m_errorString = tr("Raw layout piece %1 is corrupted.").arg(index);
+        return false;
+    }
+
+    return true;
+}
@@ -28,6 +28,8 @@
 #ifndef VRAWLAYOUT_H
 #define VRAWLAYOUT_H
 
+#include <QFile>
+
 #include "vlayoutpiece.h"
 
 struct VRawLayoutData
@@ -38,8 +40,17 @@ struct VRawLayoutData
     friend auto operator>>(QDataStream &dataStream, VRawLayoutData &data) -> QDataStream &;
 
 private:
+    friend class VRawLayout;
+    friend class VMappedRawLayout;
+
     static const quint32 streamHeader;
     static const quint16 classVersion;
+
+    static void WriteStreamHeader(QDataStream &dataStream);
+    static auto ReadStreamHeader(QDataStream &dataStream) -> quint16;
+
+    void WriteProperties(QDataStream &dataStream) const;
+    void ReadProperties(QDataStream &dataStream, quint16 actualClassVersion);
 };
 
 class VRawLayout
@@ -58,10 +69,48 @@ public:
     auto ErrorString() const -> QString;
 
 private:
+    friend class VMappedRawLayout;
+
     QString m_errorString{};
 
     static const QByteArray fileHeaderByteArray;
     static const quint16 fileVersion;
+
+    auto ReadHeader(QDataStream &dataStream, quint16 &version) -> bool;
+    static void WritePieces(QIODevice *ioDevice, QDataStream &dataStream, const QVector<VLayoutPiece> &pieces);
+    static void ReadPieces(QDataStream &dataStream, QVector<VLayoutPiece> &pieces);
+};
+
+/**
+ * @brief The VMappedRawLayout class reads pieces of a raw layout file one by one.
+ *
+ * The file is mapped to memory and a piece is decoded only when asked for. Files of the first format version have no
+ * piece index and are read whole on open.
+ */
+class VMappedRawLayout
+{
+    Q_DECLARE_TR_FUNCTIONS(VMappedRawLayout) // NOLINT
+
+public:
+    explicit VMappedRawLayout(const QString &filePath);
+    ~VMappedRawLayout() = default;
+
+    auto Open() -> bool;
+
+    auto PieceCount() const -> vsizetype;
+    auto Piece(vsizetype index, VLayoutPiece &piece) -> bool;
+
+    auto ErrorString() const -> QString;
+
+private:
+    Q_DISABLE_COPY_MOVE(VMappedRawLayout) // NOLINT
+
+    QFile m_file;
+    const uchar *m_data{nullptr};
+    qint64 m_size{0};
+    QVector<quint64> m_offsets{};
+    QVector<VLayoutPiece> m_pieces{};
+    QString m_errorString{};
 };
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -70,4 +119,16 @@ inline auto VRawLayout::ErrorString() const -> QString
     return m_errorString;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VMappedRawLayout::PieceCount() const -> vsizetype
+{
+    return m_data != nullptr ? m_offsets.size() : m_pieces.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VMappedRawLayout::ErrorString() const -> QString
+{
+    return m_errorString;
+}
+
 #endif // VRAWLAYOUT_H
@@ -331,7 +331,7 @@ void PrepareMeasurementsPlaceholders(const VPieceLabelInfo &info, QMap<QString,
     auto i = measurements.constBegin();
     while (i != measurements.constEnd())
     {
-        AddPlaceholder(pl_measurement + i.key(), QString::number(*i.value()->GetValue()));
+        AddPlaceholder(pl_measurement + i.key(), QString::number(std::as_const(*i.value()).GetValue()));
         AddPlaceholder(pl_measurement + i.key() + pl_valueAlias, i.value()->GetValueAlias());
         ++i;
     }
@@ -27,9 +27,13 @@
  *************************************************************************/
 
 #include "commandoptions.h"
+#include "compatibility.h"
 #include "literals.h"
 
 #include <QStringList>
+#include <limits>
+
+using namespace Qt::Literals::StringLiterals;
 
 const QString LONG_OPTION_BASENAME = QStringLiteral("basename");
 const QString SINGLE_OPTION_BASENAME = QStringLiteral("b");
@@ -92,6 +96,9 @@ const QString LONG_OPTION_PENDANTIC = QStringLiteral("pedantic");
 const QString LONG_OPTION_DIMENSION_A = QStringLiteral("dimensionA");
 const QString LONG_OPTION_DIMENSION_B = QStringLiteral("dimensionB");
 const QString LONG_OPTION_DIMENSION_C = QStringLiteral("dimensionC");
+const QString LONG_OPTION_DIMENSION_A_VALUES = QStringLiteral("dimensionAValues");
+const QString LONG_OPTION_DIMENSION_B_VALUES = QStringLiteral("dimensionBValues");
+const QString LONG_OPTION_DIMENSION_C_VALUES = QStringLiteral("dimensionCValues");
 
 const QString LONG_OPTION_USER_MATERIAL = QStringLiteral("userMaterial");
 const QString LONG_OPTION_CURVE_APPROXIMATION_SCALE = QStringLiteral("curveApproximationScale");
@@ -134,6 +141,8 @@ const QString LONG_OPTION_MANUAL_PRIORITY = QStringLiteral("manualPriority");
 const QString LONG_OPTION_LANDSCAPE_ORIENTATION = QStringLiteral("landscapeOrientation");
 
 const QString LONG_OPTION_NEST_QUANTITY = QStringLiteral("nestQuantity");
+const QString LONG_OPTION_NESTING_ENGINE = QStringLiteral("nestingEngine");
+const QString LONG_OPTION_MULTI_START = QStringLiteral("multiStart");
 const QString LONG_OPTION_PREFER_ONE_SHEET_SOLUTION = QStringLiteral("preferOneSheetSolution");
 const QString LONG_OPTION_BOUNDARY_TOGETHER_WITH_NOTCHES = QStringLiteral("boundaryTogetherWithNotches");
 
@@ -188,6 +197,9 @@ auto AllKeys() -> QStringList
                        LONG_OPTION_DIMENSION_A,
                        LONG_OPTION_DIMENSION_B,
                        LONG_OPTION_DIMENSION_C,
+                       LONG_OPTION_DIMENSION_A_VALUES,
+                       LONG_OPTION_DIMENSION_B_VALUES,
+                       LONG_OPTION_DIMENSION_C_VALUES,
                        LONG_OPTION_USER_MATERIAL,
                        LONG_OPTION_IGNORE_MARGINS,
                        SINGLE_OPTION_IGNORE_MARGINS,
@@ -217,6 +229,63 @@ auto AllKeys() -> QStringList
                        LONG_OPTION_MANUAL_PRIORITY,
                        LONG_OPTION_LANDSCAPE_ORIENTATION,
                        LONG_OPTION_NEST_QUANTITY,
+                       LONG_OPTION_NESTING_ENGINE,
+                       LONG_OPTION_MULTI_START,
                        LONG_OPTION_PREFER_ONE_SHEET_SOLUTION,
                        LONG_OPTION_BOUNDARY_TOGETHER_WITH_NOTCHES};
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseDimensionValues parse list of dimension values. The list contains values, ranges in form <min>-<max> and
+ * the keyword "all" separated by commas. For example, 40,44-50.
+ * @param list list of values.
+ * @param ok false if the list is empty or contains an invalid item.
+ * @return ranges of values. A single value is a range with equal bounds.
+ */
+auto ParseDimensionValues(const QString &list, bool *ok) -> QVector<QPair<int, int>>
+{
+    QVector<QPair<int, int>> ranges;
+
+    auto ToValue = [](const QString &value, bool *valueOk) -> int
+    {
+        const int number = value.trimmed().toInt(valueOk);
+        *valueOk = *valueOk && number > 0;
+        return number;
+    };
+
+    const QStringList items = list.split(',', Qt::SkipEmptyParts);
+    for (const auto &item : items)
+    {
+        bool itemOk = false;
+
+        if (item.trimmed() == "all"_L1)
+        {
+            ranges.append(qMakePair(1, std::numeric_limits<int>::max()));
+            itemOk = true;
+        }
+        else if (const QStringList range = item.split('-'); range.size() == 2)
+        {
+            bool okMin = false;
+            bool okMax = false;
+            const int min = ToValue(range.at(0), &okMin);
+            const int max = ToValue(range.at(1), &okMax);
+            itemOk = okMin && okMax && min <= max;
+            ranges.append(qMakePair(min, max));
+        }
+        else if (range.size() == 1)
+        {
+            const int value = ToValue(item, &itemOk);
+            ranges.append(qMakePair(value, value));
+        }
+
+        if (not itemOk)
+        {
+            *ok = false;
+            return {};
+        }
+    }
+
+    *ok = not ranges.isEmpty();
+    return ranges;
+}
@@ -29,7 +29,9 @@
 #ifndef COMMANDOPTIONS_H
 #define COMMANDOPTIONS_H
 
+#include <QPair>
 #include <QString>
+#include <QVector>
 
 extern const QString LONG_OPTION_BASENAME;
 extern const QString SINGLE_OPTION_BASENAME;
@@ -92,6 +94,9 @@ extern const QString LONG_OPTION_PENDANTIC;
 extern const QString LONG_OPTION_DIMENSION_A;
 extern const QString LONG_OPTION_DIMENSION_B;
 extern const QString LONG_OPTION_DIMENSION_C;
+extern const QString LONG_OPTION_DIMENSION_A_VALUES;
+extern const QString LONG_OPTION_DIMENSION_B_VALUES;
+extern const QString LONG_OPTION_DIMENSION_C_VALUES;
 
 extern const QString LONG_OPTION_USER_MATERIAL;
 extern const QString LONG_OPTION_CURVE_APPROXIMATION_SCALE;
@@ -131,9 +136,13 @@ extern const QString LONG_OPTION_FOLLOW_GRAINLINE;
 extern const QString LONG_OPTION_MANUAL_PRIORITY;
 extern const QString LONG_OPTION_LANDSCAPE_ORIENTATION;
 extern const QString LONG_OPTION_NEST_QUANTITY;
+extern const QString LONG_OPTION_NESTING_ENGINE;
+extern const QString LONG_OPTION_MULTI_START;
 extern const QString LONG_OPTION_PREFER_ONE_SHEET_SOLUTION;
 extern const QString LONG_OPTION_BOUNDARY_TOGETHER_WITH_NOTCHES;
 
 auto AllKeys() -> QStringList;
 
+auto ParseDimensionValues(const QString &list, bool *ok) -> QVector<QPair<int, int>>;
+
 #endif // COMMANDOPTIONS_H
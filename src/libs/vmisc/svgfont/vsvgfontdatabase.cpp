@@ -27,13 +27,16 @@
  *************************************************************************/
 #include "vsvgfontdatabase.h"
 
+#include <QDataStream>
 #include <QDir>
-#include <QDirIterator>
+#include <QFileInfo>
 #include <QMutex>
 #include <QString>
 
 #include "../vabstractapplication.h"
 #include "../vcommonsettings.h"
+#include "../vfileindexcache.h"
+#include "../vtextpathcache.h"
 #include "vsvgfont.h"
 #include "vsvgfontengine.h"
 #include "vsvgfontreader.h"
@@ -57,6 +60,75 @@ Q_GLOBAL_STATIC(QMutex, svgFontDatabaseMutex) // NOLINT
 
 QT_WARNING_POP
 
+// Increase if the set of fields stored by FontHeaderRecord() changes
+constexpr quint32 fontHeaderRecordVersion = 1;
+
+//---------------------------------------------------------------------------------------------------------------------
+auto FontHeaderRecord(const VSvgFont &font) -> QByteArray
+{
+    QByteArray record;
+    QDataStream dataStream(&record, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_15);
+    dataStream << font.Id() << font.FamilyName() << font.Name() << font.UnitsPerEm() << font.Ascent()
+               << font.Descent() << font.HorizAdvX() << static_cast<int>(font.Style())
+               << static_cast<int>(font.Weight());
+    return record;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto FontFromHeaderRecord(const QByteArray &record) -> VSvgFont
+{
+    QDataStream dataStream(record);
+    dataStream.setVersion(QDataStream::Qt_5_15);
+
+    QString id;
+    QString familyName;
+    QString name;
+    qreal unitsPerEm = 0;
+    qreal ascent = 0;
+    qreal descent = 0;
+    qreal horizAdvX = 0;
+    int style = 0;
+    int weight = 0;
+    dataStream >> id >> familyName >> name >> unitsPerEm >> ascent >> descent >> horizAdvX >> style >> weight;
+
+    if (dataStream.status() != QDataStream::Ok)
+    {
+        return {};
+    }
+
+    VSvgFont font(horizAdvX);
+    font.SetId(id);
+    font.SetFamilyName(familyName);
+    font.SetName(name);
+    font.SetUnitsPerEm(unitsPerEm);
+    font.SetAscent(ascent);
+    font.SetDescent(descent);
+    font.SetStyle(static_cast<SVGFontStyle>(style));
+    font.SetWeight(static_cast<SVGFontWeight>(weight));
+    return font;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto ParseFontHeader(const QString &fontFilePath, QByteArray &record) -> bool
+{
+    QFile fontFile(fontFilePath);
+    if (not fontFile.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    VSvgFontReader reader;
+    VSvgFont const font = reader.ReadSvgFontHeader(&fontFile);
+    if (not font.IsValid())
+    {
+        return false;
+    }
+
+    record = FontHeaderRecord(font);
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto GetStyleScore(SVGFontStyle desiredStyle, SVGFontStyle fontStyle) -> int
 {
@@ -108,6 +180,7 @@ void VSvgFontDatabase::PopulateFontDatabase(const QString &path)
 
     m_fontCache.clear();
     m_fontEngineCache.clear();
+    VTextPathCache::Clear();
 
     if (path.isEmpty())
     {
@@ -146,6 +219,7 @@ void VSvgFontDatabase::InvalidatePath(const QString &path)
     QMutexLocker const locker(svgFontDatabaseMutex());
 
     Invalidate(path);
+    VTextPathCache::Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -270,36 +344,32 @@ void VSvgFontDatabase::UpdateIndexes()
 //---------------------------------------------------------------------------------------------------------------------
 void VSvgFontDatabase::ParseDirectory(const QString &path, int priority)
 {
-    VSvgFontReader reader;
-    QDirIterator it(path, {"*.svg"}, QDir::Files, QDirIterator::Subdirectories);
-    while (it.hasNext())
-    {
-        QString const fontFilePath = it.next();
-        QFile fontFile(fontFilePath);
+    // Only headers of new and changed fonts are read, the rest comes from the index
+    VFileIndexCache index(VFileIndexCache::IndexPath(u"svgfonts"_s, path), fontHeaderRecordVersion);
+    const QMap<QString, QByteArray> records = index.Scan(path, {u"*.svg"_s}, ParseFontHeader);
 
-        if (fontFile.exists() && fontFile.open(QIODevice::ReadOnly))
+    for (auto i = records.constBegin(); i != records.constEnd(); ++i)
+    {
+        VSvgFont font = FontFromHeaderRecord(i.value());
+        if (not font.IsValid())
         {
-            VSvgFont font = reader.ReadSvgFontHeader(&fontFile);
-            if (not font.IsValid())
-            {
-                continue;
-            }
+            continue;
+        }
 
-            font.SetPriority(priority);
-            font.SetPath(fontFilePath);
-            if (m_fontDB.contains(font.Id()))
-            {
-                VSvgFont const duplicate = m_fontDB.value(font.Id());
-                if (font.Priority() >= duplicate.Priority())
-                {
-                    m_fontDB.insert(font.Id(), font);
-                }
-            }
-            else
+        font.SetPriority(priority);
+        font.SetPath(i.key());
+        if (m_fontDB.contains(font.Id()))
+        {
+            VSvgFont const duplicate = m_fontDB.value(font.Id());
+            if (font.Priority() >= duplicate.Priority())
             {
                 m_fontDB.insert(font.Id(), font);
             }
         }
+        else
+        {
+            m_fontDB.insert(font.Id(), font);
+        }
     }
 }
 
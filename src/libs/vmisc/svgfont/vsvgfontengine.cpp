@@ -28,6 +28,7 @@
 #include "vsvgfontengine.h"
 #include "../compatibility.h"
 #include "../def.h"
+#include "../vtextpathcache.h"
 #include "qpainterpath.h"
 #include "svgdef.h"
 #include "vsvgfontengine_p.h"
@@ -204,26 +205,38 @@ auto VSvgFontEngine::DrawPath(const QPointF &point, const QString &str, qreal pe
         return {};
     }
 
-    const qreal baseLine = FromFontUnits(d->m_font.Ascent());
-
-    QTransform matrix;
-    matrix.translate(point.x(), point.y() + baseLine);
-    matrix.scale(pixelSize / d->m_font.UnitsPerEm(), -pixelSize / d->m_font.UnitsPerEm());
-
-    QPainterPath path;
-    for (auto unicode : str)
-    {
-        if (!d->m_glyphs.contains(unicode))
-        {
-            unicode = u'\0';
-            if (!d->m_glyphs.contains(unicode))
-            {
-                continue;
-            }
-        }
-        path.addPath(matrix.map(d->m_glyphs[unicode].Path()));
-        matrix.translate(d->m_glyphs[unicode].HorizAdvX() + penWidth / 2.0, 0);
-    }
+    // The font file path tells apart fonts with the same family, the pixel size changes the outline scale.
+    const QString fontKey = u"svg:%1:%2:%3"_s.arg(d->m_font.Path(), QString::fromLatin1(d->m_font.Hash().toHex()))
+                                .arg(pixelSize);
+
+    QPainterPath path = VTextPathCache::Line(fontKey, str, penWidth,
+                                             [this, &str, penWidth, pixelSize]()
+                                             {
+                                                 const qreal baseLine = FromFontUnits(d->m_font.Ascent());
+
+                                                 QTransform matrix;
+                                                 matrix.translate(0, baseLine);
+                                                 matrix.scale(pixelSize / d->m_font.UnitsPerEm(),
+                                                              -pixelSize / d->m_font.UnitsPerEm());
+
+                                                 QPainterPath line;
+                                                 for (auto unicode : str)
+                                                 {
+                                                     if (!d->m_glyphs.contains(unicode))
+                                                     {
+                                                         unicode = u'\0';
+                                                         if (!d->m_glyphs.contains(unicode))
+                                                         {
+                                                             continue;
+                                                         }
+                                                     }
+                                                     line.addPath(matrix.map(d->m_glyphs[unicode].Path()));
+                                                     matrix.translate(d->m_glyphs[unicode].HorizAdvX() + penWidth / 2.0,
+                                                                      0);
+                                                 }
+                                                 return line;
+                                             });
+    path.translate(point);
 
     if (const QPointF offset = CalcOffset(path); !offset.isNull())
     {
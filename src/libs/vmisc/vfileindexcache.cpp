@@ -0,0 +1,259 @@
+/************************************************************************
+ **
+ **  @file   vfileindexcache.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vfileindexcache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <utility>
+
+#include "compatibility.h"
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wmissing-prototypes")
+QT_WARNING_DISABLE_INTEL(1418)
+
+Q_LOGGING_CATEGORY(vFileIndex, "v.fileindex") // NOLINT
+
+QT_WARNING_POP
+
+namespace
+{
+struct VParsedFile
+{
+    QString path{};
+    VFileIndexEntry entry{};
+};
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VFileIndexCache create an index.
+ * @param indexPath path to the index file. Empty path keeps the index in memory only for one scan.
+ * @param recordVersion version of the records format. Index with other version is dropped.
+ */
+VFileIndexCache::VFileIndexCache(QString indexPath, quint32 recordVersion)
+  : m_indexPath(std::move(indexPath)),
+    m_recordVersion(recordVersion)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Scan find all files matching filters in a directory and its subdirectories and return their records.
+ *
+ * Unchanged files take their record from the index. New and changed files are parsed by the thread pool. The index is
+ * written back only if something changed. Removed files disappear from the index.
+ * @param directory directory to scan.
+ * @param nameFilters file name filters.
+ * @param parse parser for new and changed files.
+ * @return records of valid files by file path.
+ */
+auto VFileIndexCache::Scan(const QString &directory, const QStringList &nameFilters, const Parser &parse)
+    -> QMap<QString, QByteArray>
+{
+    m_reused = 0;
+    m_parsed = 0;
+
+    const QHash<QString, VFileIndexEntry> index = Load();
+    QHash<QString, VFileIndexEntry> entries;
+    QVector<VParsedFile> changed;
+
+    QDirIterator it(directory, nameFilters, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        const QString filePath = it.next();
+        const QFileInfo info = it.fileInfo();
+
+        VFileIndexEntry entry;
+        entry.size = info.size();
+        entry.lastModified = info.lastModified().toMSecsSinceEpoch();
+
+        auto cached = index.constFind(filePath);
+        if (cached != index.constEnd() && cached->size == entry.size && cached->lastModified == entry.lastModified)
+        {
+            entries.insert(filePath, *cached);
+            ++m_reused;
+        }
+        else
+        {
+            changed.append(VParsedFile{.path = filePath, .entry = entry});
+        }
+    }
+
+    if (not changed.isEmpty())
+    {
+        auto Parse = [parse](VParsedFile file) -> VParsedFile
+        {
+            file.entry.valid = parse(file.path, file.entry.record);
+            if (not file.entry.valid)
+            {
+                file.entry.record.clear();
+            }
+            return file;
+        };
+
+        const QList<VParsedFile> parsed = MappedOnPool(QThreadPool::globalInstance(), changed, Parse);
+        for (const auto &file : parsed)
+        {
+            entries.insert(file.path, file.entry);
+        }
+        m_parsed = parsed.size();
+    }
+
+    qCDebug(vFileIndex, "Scan %s: %lld reused, %lld parsed.", qUtf8Printable(directory),
+            static_cast<long long>(m_reused), static_cast<long long>(m_parsed));
+
+    if (m_parsed > 0 || entries.size() != index.size())
+    {
+        Save(entries);
+    }
+
+    QMap<QString, QByteArray> records;
+    for (auto i = entries.constBegin(); i != entries.constEnd(); ++i)
+    {
+        if (i.value().valid)
+        {
+            records.insert(i.key(), i.value().record);
+        }
+    }
+
+    return records;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IndexPath return default location of an index for a directory.
+ * @param name name of the index, one per kind of files.
+ * @param directory scanned directory.
+ * @return path inside the application cache directory or empty string if there is no writable cache location.
+ */
+auto VFileIndexCache::IndexPath(const QString &name, const QString &directory) -> QString
+{
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cacheDir.isEmpty())
+    {
+        return {};
+    }
+
+    const QByteArray directoryHash =
+        QCryptographicHash::hash(QDir(directory).absolutePath().toUtf8(), QCryptographicHash::Md5).toHex();
+    return QStringLiteral("%1/index/%2-%3.idx").arg(cacheDir, name, QString::fromLatin1(directoryHash));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VFileIndexCache::Load() const -> QHash<QString, VFileIndexEntry>
+{
+    if (m_indexPath.isEmpty())
+    {
+        return {};
+    }
+
+    QFile file(m_indexPath);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return {};
+    }
+
+    QDataStream dataStream(&file);
+    dataStream.setVersion(QDataStream::Qt_5_15);
+
+    quint32 actualStreamHeader = 0;
+    quint16 actualClassVersion = 0;
+    quint32 actualRecordVersion = 0;
+    dataStream >> actualStreamHeader >> actualClassVersion >> actualRecordVersion;
+
+    if (actualStreamHeader != streamHeader || actualClassVersion != classVersion ||
+        actualRecordVersion != m_recordVersion)
+    {
+        qCDebug(vFileIndex, "Index %s is outdated.", qUtf8Printable(m_indexPath));
+        return {};
+    }
+
+    qint32 count = 0;
+    dataStream >> count;
+
+    QHash<QString, VFileIndexEntry> entries;
+    entries.reserve(qMax(count, 0));
+    for (qint32 i = 0; i < count && dataStream.status() == QDataStream::Ok; ++i)
+    {
+        QString path;
+        VFileIndexEntry entry;
+        dataStream >> path >> entry.size >> entry.lastModified >> entry.valid >> entry.record;
+        entries.insert(path, entry);
+    }
+
+    if (dataStream.status() != QDataStream::Ok)
+    {
+        qCDebug(vFileIndex, "Index %s is corrupted.", qUtf8Printable(m_indexPath));
+        return {};
+    }
+
+    return entries;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VFileIndexCache::Save(const QHash<QString, VFileIndexEntry> &entries) const
+{
+    if (m_indexPath.isEmpty() || not QDir().mkpath(QFileInfo(m_indexPath).absolutePath()))
+    {
+        return;
+    }
+
+    QSaveFile file(m_indexPath);
+    if (not file.open(QIODevice::WriteOnly))
+    {
+        qCDebug(vFileIndex, "Cannot write index %s: %s", qUtf8Printable(m_indexPath),
+                qUtf8Printable(file.errorString()));
+        return;
+    }
+
+    QDataStream dataStream(&file);
+    dataStream.setVersion(QDataStream::Qt_5_15);
+
+    dataStream << streamHeader << classVersion << m_recordVersion;
+    dataStream << static_cast<qint32>(entries.size());
+    for (auto i = entries.constBegin(); i != entries.constEnd(); ++i)
+    {
+        dataStream << i.key() << i.value().size << i.value().lastModified << i.value().valid << i.value().record;
+    }
+
+    if (dataStream.status() != QDataStream::Ok || not file.commit())
+    {
+        qCDebug(vFileIndex, "Cannot write index %s: %s", qUtf8Printable(m_indexPath),
+                qUtf8Printable(file.errorString()));
+    }
+}
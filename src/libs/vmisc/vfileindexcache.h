@@ -0,0 +1,101 @@
+/************************************************************************
+ **
+ **  @file   vfileindexcache.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VFILEINDEXCACHE_H
+#define VFILEINDEXCACHE_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+#include <functional>
+
+#include "defglobal.h"
+
+struct VFileIndexEntry
+{
+    qint64 size{-1};         // NOLINT(misc-non-private-member-variables-in-classes)
+    qint64 lastModified{-1}; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool valid{false};       // NOLINT(misc-non-private-member-variables-in-classes)
+    QByteArray record{};     // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+/**
+ * @brief The VFileIndexCache class keeps on disk what was read from each file of a directory.
+ *
+ * Databases of known measurements and SVG fonts read only a small header of every file at startup. The index stores
+ * that header as an opaque record together with the size and modification time of the file. The next scan reuses
+ * records of unchanged files and parses only new and changed files, in parallel. Files that failed to parse are
+ * remembered too and are not parsed again until they change.
+ */
+class VFileIndexCache
+{
+public:
+    /**
+     * @brief Parser reads a file and fills its record. Called from worker threads.
+     * @return false if the file is not valid.
+     */
+    using Parser = std::function<bool(const QString &filePath, QByteArray &record)>;
+
+    VFileIndexCache(QString indexPath, quint32 recordVersion);
+
+    auto Scan(const QString &directory, const QStringList &nameFilters, const Parser &parse)
+        -> QMap<QString, QByteArray>;
+
+    auto ReusedCount() const -> vsizetype;
+    auto ParsedCount() const -> vsizetype;
+
+    static auto IndexPath(const QString &name, const QString &directory) -> QString;
+
+private:
+    QString m_indexPath;
+    quint32 m_recordVersion;
+    vsizetype m_reused{0};
+    vsizetype m_parsed{0};
+
+    static constexpr quint32 streamHeader = 0x93E30DF7; // CRC-32Q string "VFileIndexCache"
+    static constexpr quint16 classVersion = 1;
+
+    auto Load() const -> QHash<QString, VFileIndexEntry>;
+    void Save(const QHash<QString, VFileIndexEntry> &entries) const;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VFileIndexCache::ReusedCount() const -> vsizetype
+{
+    return m_reused;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto VFileIndexCache::ParsedCount() const -> vsizetype
+{
+    return m_parsed;
+}
+
+#endif // VFILEINDEXCACHE_H
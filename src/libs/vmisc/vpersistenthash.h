@@ -0,0 +1,542 @@
+/************************************************************************
+ **
+ **  @file   vpersistenthash.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VPERSISTENTHASH_H
+#define VPERSISTENTHASH_H
+
+#include <QExplicitlySharedDataPointer>
+#include <QHash>
+#include <QSharedData>
+#include <QVarLengthArray>
+#include <QVector>
+#include <QtGlobal>
+#include <utility>
+
+#include "defglobal.h"
+
+/**
+ * @brief The VPersistentHash class is an implicitly shared hash with cheap copies.
+ *
+ * QHash copies all items the first time a shared copy is modified. The pattern keeps a copy of its data for every tool,
+ * with QHash each of those snapshots costs time and memory linear in the size of the pattern.
+ *
+ * VPersistentHash is a hash array mapped trie (compressed CHAMP layout). Nodes are shared between copies, a change
+ * copies only nodes on the path from the root to the item, so a copy costs O(1) and a change after the copy O(log n).
+ * The interface follows QHash where the container uses it. Iteration order is unspecified.
+ */
+template <typename Key, typename T> class VPersistentHash
+{
+    struct Entry
+    {
+        quint32 hash{0};
+        Key key{};
+        T value{};
+    };
+
+    struct Node;
+    using NodePointer = QExplicitlySharedDataPointer<Node>;
+
+    struct Node : public QSharedData
+    {
+        quint32 dataMap{0};
+        quint32 nodeMap{0};
+        QVector<Entry> entries{};
+        QVector<NodePointer> children{};
+    };
+
+    static constexpr int bitsPerLevel = 5;
+    static constexpr quint32 levelMask = (1U << bitsPerLevel) - 1;
+    static constexpr int hashBits = 32;
+
+public:
+    class const_iterator // NOLINT(readability-identifier-naming)
+    {
+    public:
+        const_iterator() = default;
+
+        auto key() const -> const Key & { return CurrentEntry().key; }
+        auto value() const -> const T & { return CurrentEntry().value; }
+        auto operator*() const -> const T & { return CurrentEntry().value; }
+        auto operator->() const -> const T * { return &CurrentEntry().value; }
+
+        auto operator++() -> const_iterator &;
+        auto operator++(int) -> const_iterator;
+
+        auto operator==(const const_iterator &other) const -> bool;
+        auto operator!=(const const_iterator &other) const -> bool { return not(*this == other); }
+
+    private:
+        friend class VPersistentHash;
+
+        struct Frame
+        {
+            const Node *node{nullptr};
+            vsizetype entry{0};
+            vsizetype child{0};
+        };
+
+        // 7 trie levels and a collision node
+        QVarLengthArray<Frame, 8> m_stack{};
+
+        auto CurrentEntry() const -> const Entry & { return m_stack.last().node->entries.at(m_stack.last().entry); }
+
+        void SettleOnEntry();
+    };
+
+    using ConstIterator = const_iterator;
+
+    VPersistentHash() = default;
+
+    auto size() const -> vsizetype { return m_size; }
+    auto count() const -> vsizetype { return m_size; }
+    auto isEmpty() const -> bool { return m_size == 0; }
+
+    auto contains(const Key &key) const -> bool { return Find(key) != nullptr; }
+    auto value(const Key &key, const T &defaultValue = T()) const -> T;
+
+    void insert(const Key &key, const T &value);
+    auto remove(const Key &key) -> bool;
+    void clear();
+
+    auto constFind(const Key &key) const -> const_iterator;
+    auto find(const Key &key) const -> const_iterator { return constFind(key); }
+
+    auto constBegin() const -> const_iterator;
+    auto constEnd() const -> const_iterator { return const_iterator(); }
+    auto begin() const -> const_iterator { return constBegin(); }
+    auto end() const -> const_iterator { return constEnd(); }
+    auto cbegin() const -> const_iterator { return constBegin(); }
+    auto cend() const -> const_iterator { return constEnd(); }
+
+    auto keys() const -> QList<Key>;
+
+    auto IsSharedWith(const VPersistentHash &other) const -> bool { return m_root == other.m_root; }
+
+private:
+    NodePointer m_root{};
+    vsizetype m_size{0};
+
+    static auto Hash(const Key &key) -> quint32;
+    static auto Index(quint32 hash, int shift) -> quint32 { return (hash >> shift) & levelMask; }
+    static auto Rank(quint32 map, quint32 bit) -> vsizetype
+    {
+        return static_cast<vsizetype>(qPopulationCount(map & (bit - 1)));
+    }
+
+    auto Find(const Key &key) const -> const Entry *;
+
+    static auto Insert(NodePointer &node, Entry &&entry, int shift) -> bool;
+    static auto Merge(Entry &&first, Entry &&second, int shift) -> NodePointer;
+    static void Remove(NodePointer &node, const Key &key, quint32 hash, int shift);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::Hash(const Key &key) -> quint32
+{
+    // Qt 6 returns size_t, fold it into 32 bits used by the trie
+    const auto hash = static_cast<quint64>(qHash(key));
+    return static_cast<quint32>(hash ^ (hash >> 32U));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::Find(const Key &key) const -> const Entry *
+{
+    const quint32 hash = Hash(key);
+    const Node *node = m_root.constData();
+    int shift = 0;
+
+    while (node != nullptr)
+    {
+        if (shift >= hashBits)
+        {
+            // Collision node, all keys here have the same hash
+            for (const auto &entry : node->entries)
+            {
+                if (entry.key == key)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        const quint32 bit = 1U << Index(hash, shift);
+        if ((node->dataMap & bit) != 0U)
+        {
+            const Entry &entry = node->entries.at(Rank(node->dataMap, bit));
+            return entry.hash == hash && entry.key == key ? &entry : nullptr;
+        }
+
+        if ((node->nodeMap & bit) == 0U)
+        {
+            return nullptr;
+        }
+
+        node = node->children.at(Rank(node->nodeMap, bit)).constData();
+        shift += bitsPerLevel;
+    }
+
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::value(const Key &key, const T &defaultValue) const -> T
+{
+    const Entry *entry = Find(key);
+    return entry != nullptr ? entry->value : defaultValue;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> void VPersistentHash<Key, T>::insert(const Key &key, const T &value)
+{
+    if (not m_root)
+    {
+        m_root = NodePointer(new Node);
+    }
+
+    if (Insert(m_root, Entry{.hash = Hash(key), .key = key, .value = value}, 0))
+    {
+        ++m_size;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::remove(const Key &key) -> bool
+{
+    // Check first, a missing key must not copy nodes shared with other hashes
+    if (not contains(key))
+    {
+        return false;
+    }
+
+    Remove(m_root, key, Hash(key), 0);
+    --m_size;
+
+    if (m_size == 0)
+    {
+        m_root.reset();
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> void VPersistentHash<Key, T>::clear()
+{
+    m_root.reset();
+    m_size = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::keys() const -> QList<Key>
+{
+    QList<Key> list;
+    list.reserve(m_size);
+    for (auto i = constBegin(); i != constEnd(); ++i)
+    {
+        list.append(i.key());
+    }
+    return list;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Insert put the entry into the subtree.
+ *
+ * Shared nodes on the way are copied before they change, nodes owned only by this hash are changed in place.
+ * @return true if a new key was added, false if the value of an existing key was replaced.
+ */
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::Insert(NodePointer &node, Entry &&entry, int shift) -> bool
+{
+    node.detach();
+    Node *n = node.data();
+
+    if (shift >= hashBits)
+    {
+        for (auto &existing : n->entries)
+        {
+            if (existing.key == entry.key)
+            {
+                existing.value = std::move(entry.value);
+                return false;
+            }
+        }
+        n->entries.append(std::move(entry));
+        return true;
+    }
+
+    const quint32 bit = 1U << Index(entry.hash, shift);
+
+    if ((n->nodeMap & bit) != 0U)
+    {
+        return Insert(n->children[Rank(n->nodeMap, bit)], std::move(entry), shift + bitsPerLevel);
+    }
+
+    if ((n->dataMap & bit) == 0U)
+    {
+        n->dataMap |= bit;
+        n->entries.insert(Rank(n->dataMap, bit), std::move(entry));
+        return true;
+    }
+
+    const vsizetype index = Rank(n->dataMap, bit);
+    Entry &existing = n->entries[index];
+    if (existing.hash == entry.hash && existing.key == entry.key)
+    {
+        existing.value = std::move(entry.value);
+        return false;
+    }
+
+    // Two keys share the slot, move both one level down
+    NodePointer child = Merge(std::move(existing), std::move(entry), shift + bitsPerLevel);
+    n->entries.removeAt(index);
+    n->dataMap &= ~bit;
+    n->nodeMap |= bit;
+    n->children.insert(Rank(n->nodeMap, bit), child);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::Merge(Entry &&first, Entry &&second, int shift) -> NodePointer
+{
+    NodePointer node(new Node);
+
+    if (shift >= hashBits)
+    {
+        node->entries.append(std::move(first));
+        node->entries.append(std::move(second));
+        return node;
+    }
+
+    const quint32 firstIndex = Index(first.hash, shift);
+    const quint32 secondIndex = Index(second.hash, shift);
+
+    if (firstIndex == secondIndex)
+    {
+        node->nodeMap = 1U << firstIndex;
+        node->children.append(Merge(std::move(first), std::move(second), shift + bitsPerLevel));
+        return node;
+    }
+
+    node->dataMap = (1U << firstIndex) | (1U << secondIndex);
+    if (firstIndex < secondIndex)
+    {
+        node->entries.append(std::move(first));
+        node->entries.append(std::move(second));
+    }
+    else
+    {
+        node->entries.append(std::move(second));
+        node->entries.append(std::move(first));
+    }
+    return node;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Remove delete the key from the subtree. The key must exist.
+ *
+ * A subnode left with a single entry is inlined into its parent, so lookups do not walk through chains of nodes.
+ */
+template <typename Key, typename T>
+void VPersistentHash<Key, T>::Remove(NodePointer &node, const Key &key, quint32 hash, int shift)
+{
+    node.detach();
+    Node *n = node.data();
+
+    if (shift >= hashBits)
+    {
+        for (vsizetype i = 0; i < n->entries.size(); ++i)
+        {
+            if (n->entries.at(i).key == key)
+            {
+                n->entries.removeAt(i);
+                return;
+            }
+        }
+        return;
+    }
+
+    const quint32 bit = 1U << Index(hash, shift);
+
+    if ((n->dataMap & bit) != 0U)
+    {
+        n->entries.removeAt(Rank(n->dataMap, bit));
+        n->dataMap &= ~bit;
+        return;
+    }
+
+    const vsizetype index = Rank(n->nodeMap, bit);
+    NodePointer &child = n->children[index];
+    Remove(child, key, hash, shift + bitsPerLevel);
+
+    const Node *c = child.constData();
+    if (not c->children.isEmpty() || c->entries.size() > 1)
+    {
+        return;
+    }
+
+    n->nodeMap &= ~bit;
+    if (c->entries.size() == 1)
+    {
+        Entry last = c->entries.constFirst();
+        n->children.removeAt(index);
+        n->dataMap |= bit;
+        n->entries.insert(Rank(n->dataMap, bit), std::move(last));
+    }
+    else
+    {
+        n->children.removeAt(index);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::constBegin() const -> const_iterator
+{
+    const_iterator i;
+    if (m_root)
+    {
+        i.m_stack.append({m_root.constData(), 0, 0});
+        i.SettleOnEntry();
+    }
+    return i;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T> auto VPersistentHash<Key, T>::constFind(const Key &key) const -> const_iterator
+{
+    // Build the same stack the iterator would have after reaching the key, so the iterator can continue from it
+    const_iterator i;
+    const quint32 hash = Hash(key);
+    const Node *node = m_root.constData();
+    int shift = 0;
+
+    while (node != nullptr)
+    {
+        if (shift >= hashBits)
+        {
+            for (vsizetype e = 0; e < node->entries.size(); ++e)
+            {
+                if (node->entries.at(e).key == key)
+                {
+                    i.m_stack.append({node, e, 0});
+                    return i;
+                }
+            }
+            return {};
+        }
+
+        const quint32 bit = 1U << Index(hash, shift);
+        if ((node->dataMap & bit) != 0U)
+        {
+            const vsizetype e = Rank(node->dataMap, bit);
+            const Entry &entry = node->entries.at(e);
+            if (entry.hash != hash || entry.key != key)
+            {
+                return {};
+            }
+            i.m_stack.append({node, e, 0});
+            return i;
+        }
+
+        if ((node->nodeMap & bit) == 0U)
+        {
+            return {};
+        }
+
+        const vsizetype c = Rank(node->nodeMap, bit);
+        i.m_stack.append({node, node->entries.size(), c + 1});
+        node = node->children.at(c).constData();
+        shift += bitsPerLevel;
+    }
+
+    return {};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SettleOnEntry move the iterator to the nearest entry at or after the current position.
+ *
+ * A node lists its own entries first and then the entries of its children. An empty stack is the end iterator.
+ */
+template <typename Key, typename T> void VPersistentHash<Key, T>::const_iterator::SettleOnEntry()
+{
+    while (not m_stack.isEmpty())
+    {
+        Frame &top = m_stack.last();
+        if (top.entry < top.node->entries.size())
+        {
+            return;
+        }
+
+        if (top.child < top.node->children.size())
+        {
+            const Node *child = top.node->children.at(top.child).constData();
+            ++top.child;
+            m_stack.append({child, 0, 0});
+            continue;
+        }
+
+        m_stack.removeLast();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::const_iterator::operator++() -> const_iterator &
+{
+    if (not m_stack.isEmpty())
+    {
+        ++m_stack.last().entry;
+        SettleOnEntry();
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::const_iterator::operator++(int) -> const_iterator
+{
+    const_iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::const_iterator::operator==(const const_iterator &other) const -> bool
+{
+    if (m_stack.isEmpty() || other.m_stack.isEmpty())
+    {
+        return m_stack.isEmpty() && other.m_stack.isEmpty();
+    }
+
+    return m_stack.last().node == other.m_stack.last().node && m_stack.last().entry == other.m_stack.last().entry;
+}
+
+#endif // VPERSISTENTHASH_H
@@ -0,0 +1,206 @@
+/************************************************************************
+ **
+ **  @file   vtextpathcache.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "vtextpathcache.h"
+
+#include <QCache>
+#include <QFont>
+#include <QGlobalStatic>
+#include <QMutex>
+
+namespace
+{
+struct VTextPathCacheData
+{
+    QCache<QString, QPainterPath> glyphs{VTextPathCache::defaultGlyphCapacity};
+    QCache<QString, QPainterPath> lines{VTextPathCache::defaultLineCapacity};
+    VTextPathCacheStatistics statistics{};
+};
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wunused-member-function")
+
+Q_GLOBAL_STATIC(QMutex, textPathCacheMutex)            // NOLINT
+Q_GLOBAL_STATIC(VTextPathCacheData, textPathCacheData) // NOLINT
+
+QT_WARNING_POP
+
+const QChar keySeparator = QChar(0x1F);
+
+//---------------------------------------------------------------------------------------------------------------------
+auto HitRate(quint64 hits, quint64 misses) -> qreal
+{
+    const quint64 total = hits + misses;
+    return total > 0 ? static_cast<qreal>(hits) / static_cast<qreal>(total) : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto CachedPath(QCache<QString, QPainterPath> &cache, const QString &key, quint64 &hits, quint64 &misses,
+                const VTextPathCache::PathBuilder &build) -> QPainterPath
+{
+    {
+        QMutexLocker const locker(textPathCacheMutex());
+        if (const QPainterPath *path = cache.object(key))
+        {
+            ++hits;
+            return *path;
+        }
+        ++misses;
+    }
+
+    // Building an outline is the expensive part, do not hold the lock while asking the font engine. Two threads may
+    // build the same path at once, the second insert simply replaces the first one.
+    QPainterPath path = build();
+
+    QMutexLocker const locker(textPathCacheMutex());
+    cache.insert(key, new QPainterPath(path));
+    return path;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VTextPathCacheStatistics::GlyphHitRate() const -> qreal
+{
+    return HitRate(glyphHits, glyphMisses);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VTextPathCacheStatistics::LineHitRate() const -> qreal
+{
+    return HitRate(lineHits, lineMisses);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Glyph return outline of a single character.
+ * @param fontKey unique description of the font, its size and of anything else that changes the outline.
+ * @param c character.
+ * @param build creates the outline at the origin if the cache has no copy.
+ * @return glyph outline at the origin.
+ */
+auto VTextPathCache::Glyph(const QString &fontKey, QChar c, const PathBuilder &build) -> QPainterPath
+{
+    VTextPathCacheData *data = textPathCacheData();
+    return CachedPath(data->glyphs, fontKey + keySeparator + c, data->statistics.glyphHits,
+                      data->statistics.glyphMisses, build);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Line return outline of a whole string.
+ * @param fontKey unique description of the font, its size and of anything else that changes the outline.
+ * @param text string.
+ * @param penWidth pen width if it changes the spacing of glyphs, otherwise 0.
+ * @param build creates the outline at the origin if the cache has no copy.
+ * @return line outline at the origin.
+ */
+auto VTextPathCache::Line(const QString &fontKey, const QString &text, qreal penWidth, const PathBuilder &build)
+    -> QPainterPath
+{
+    VTextPathCacheData *data = textPathCacheData();
+    const QString key = fontKey + keySeparator + QString::number(penWidth, 'g', 17) + keySeparator + text;
+    return CachedPath(data->lines, key, data->statistics.lineHits, data->statistics.lineMisses, build);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief OutlineText cached equivalent of QPainterPath::addText.
+ * @param point left end of the baseline.
+ * @param font system font.
+ * @param text string.
+ * @return text outline.
+ */
+auto VTextPathCache::OutlineText(const QPointF &point, const QFont &font, const QString &text) -> QPainterPath
+{
+    if (text.isEmpty())
+    {
+        return {};
+    }
+
+    QPainterPath path = Line(FontKey(font), text, 0,
+                             [&font, &text]()
+                             {
+                                 QPainterPath line;
+                                 line.addText(QPointF(), font, text);
+                                 return line;
+                             });
+    path.translate(point);
+    return path;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VTextPathCache::FontKey(const QFont &font) -> QString
+{
+    // QFont::key() covers family, size, weight and style. Pixel and point sizes are both part of it.
+    return font.key();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTextPathCache::SetCapacity(int glyphs, int lines)
+{
+    QMutexLocker const locker(textPathCacheMutex());
+    VTextPathCacheData *data = textPathCacheData();
+    data->glyphs.setMaxCost(qMax(glyphs, 0));
+    data->lines.setMaxCost(qMax(lines, 0));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VTextPathCache::GlyphCapacity() -> int
+{
+    QMutexLocker const locker(textPathCacheMutex());
+    return static_cast<int>(textPathCacheData()->glyphs.maxCost());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VTextPathCache::LineCapacity() -> int
+{
+    QMutexLocker const locker(textPathCacheMutex());
+    return static_cast<int>(textPathCacheData()->lines.maxCost());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTextPathCache::Clear()
+{
+    QMutexLocker const locker(textPathCacheMutex());
+    VTextPathCacheData *data = textPathCacheData();
+    data->glyphs.clear();
+    data->lines.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VTextPathCache::Statistics() -> VTextPathCacheStatistics
+{
+    QMutexLocker const locker(textPathCacheMutex());
+    return textPathCacheData()->statistics;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTextPathCache::ResetStatistics()
+{
+    QMutexLocker const locker(textPathCacheMutex());
+    textPathCacheData()->statistics = VTextPathCacheStatistics();
+}
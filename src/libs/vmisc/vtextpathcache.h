@@ -0,0 +1,81 @@
+/************************************************************************
+ **
+ **  @file   vtextpathcache.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef VTEXTPATHCACHE_H
+#define VTEXTPATHCACHE_H
+
+#include <QPainterPath>
+#include <QString>
+#include <QtGlobal>
+#include <functional>
+
+class QFont;
+
+struct VTextPathCacheStatistics
+{
+    quint64 glyphHits{0};   // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 glyphMisses{0}; // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 lineHits{0};    // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 lineMisses{0};  // NOLINT(misc-non-private-member-variables-in-classes)
+
+    auto GlyphHitRate() const -> qreal;
+    auto LineHitRate() const -> qreal;
+};
+
+/**
+ * @brief The VTextPathCache class keeps outlines of text that is exported or shown as paths.
+ *
+ * Labels repeat the same strings and glyphs on every piece, tile and export. Building an outline goes through the font
+ * engine each time, so finished paths are kept in two LRU caches shared by all threads. Glyphs are keyed by font and
+ * character, lines by font, pen width and string. All paths are stored at the origin, callers translate them.
+ */
+class VTextPathCache
+{
+public:
+    using PathBuilder = std::function<QPainterPath()>;
+
+    static constexpr int defaultGlyphCapacity = 4096;
+    static constexpr int defaultLineCapacity = 1024;
+
+    static auto Glyph(const QString &fontKey, QChar c, const PathBuilder &build) -> QPainterPath;
+    static auto Line(const QString &fontKey, const QString &text, qreal penWidth, const PathBuilder &build)
+        -> QPainterPath;
+
+    static auto OutlineText(const QPointF &point, const QFont &font, const QString &text) -> QPainterPath;
+    static auto FontKey(const QFont &font) -> QString;
+
+    static void SetCapacity(int glyphs, int lines);
+    static auto GlyphCapacity() -> int;
+    static auto LineCapacity() -> int;
+
+    static void Clear();
+
+    static auto Statistics() -> VTextPathCacheStatistics;
+    static void ResetStatistics();
+};
+
+#endif // VTEXTPATHCACHE_H
@@ -73,8 +73,7 @@ Calculator::Calculator()
  * @param formula string of formula.
  * @return value of formula.
  */
-auto Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> *vars, const QString &formula)
-    -> qreal
+auto Calculator::EvalFormula(const VInternalVariableHash *vars, const QString &formula) -> qreal
 {
     // Converting with locale is much faster in case of single numerical value.
     QLocale const c(QLocale::C);
@@ -101,7 +100,8 @@ auto Calculator::VarFactory(const QString &a_szName, void *a_pUserData) -> qreal
 
     if (calc->m_vars != nullptr && calc->m_vars->contains(a_szName))
     {
-        QSharedPointer<qreal> const val(new qreal(*calc->m_vars->value(a_szName)->GetValue()));
+        // Read through the const overload, the non-const one may store the value and is not safe to call concurrently.
+        QSharedPointer<qreal> const val(new qreal(std::as_const(*calc->m_vars->value(a_szName)).GetValue()));
         calc->m_varsValues.append(val);
         return val.data();
     }
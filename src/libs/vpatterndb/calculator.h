@@ -29,14 +29,13 @@
 #ifndef CALCULATOR_H
 #define CALCULATOR_H
 
-#include <QHash>
 #include <QMap>
 #include <QString>
+#include <QVector>
 #include <QtGlobal>
 
 #include "../qmuparser/qmuformulabase.h"
-
-class VInternalVariable;
+#include "variables/vinternalvariable.h"
 
 /**
  * @brief The Calculator class for calculation formula.
@@ -62,12 +61,12 @@ public:
     Calculator();
     ~Calculator() override = default;
 
-    auto EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> *vars, const QString &formula) -> qreal;
+    auto EvalFormula(const VInternalVariableHash *vars, const QString &formula) -> qreal;
 
 private:
     Q_DISABLE_COPY_MOVE(Calculator) // NOLINT
     QVector<QSharedPointer<qreal>> m_varsValues{};
-    const QHash<QString, QSharedPointer<VInternalVariable>> *m_vars{nullptr};
+    const VInternalVariableHash *m_vars{nullptr};
 
     static auto VarFactory(const QString &a_szName, void *a_pUserData) -> qreal *;
     static auto Warning(const QString &warningMsg, qreal value) -> qreal;
@@ -30,11 +30,13 @@
 #define VINTERNALVARIABLE_H
 
 #include <QSharedDataPointer>
+#include <QSharedPointer>
 #include <QString>
 #include <QTypeInfo>
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
+#include "../vmisc/vpersistenthash.h"
 
 class VInternalVariableData;
 
@@ -85,4 +87,6 @@ QT_WARNING_POP
 
 Q_DECLARE_TYPEINFO(VInternalVariable, Q_MOVABLE_TYPE); // NOLINT
 
+using VInternalVariableHash = VPersistentHash<QString, QSharedPointer<VInternalVariable>>;
+
 #endif // VINTERNALVARIABLE_H
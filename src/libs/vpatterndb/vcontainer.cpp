@@ -64,6 +64,16 @@ Q_LOGGING_CATEGORY(vCon, "v.container") // NOLINT
 
 QT_WARNING_POP
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto NextRevision() -> quint64
+{
+    static QAtomicInteger<quint64> revision{0};
+    return ++revision;
+}
+} // namespace
+
 QMap<QString, quint32> VContainer::_id = QMap<QString, quint32>();
 QMap<QString, QSet<QString>> VContainer::uniqueNames = QMap<QString, QSet<QString>>();
 QMap<QString, quint32> VContainer::copyCounter = QMap<QString, quint32>();
@@ -300,6 +310,7 @@ auto VContainer::AddGObject(const QSharedPointer<VGObject> &obj) -> quint32
         d->modelingObjects->insert(id, obj);
     }
 
+    Modified();
     return id;
 }
 
@@ -308,6 +319,7 @@ auto VContainer::AddPiece(const VPiece &detail) -> quint32
 {
     const quint32 id = getNextId();
     d->pieces->insert(id, detail);
+    Modified();
     return id;
 }
 
@@ -316,6 +328,7 @@ auto VContainer::AddPiecePath(const VPiecePath &path) -> quint32
 {
     const quint32 id = getNextId();
     d->piecePaths->insert(id, path);
+    Modified();
     return id;
 }
 
@@ -383,6 +396,7 @@ void VContainer::Clear()
     ClearVariables();
     ClearGObjects();
     ClearUniqueNames();
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -400,6 +414,7 @@ void VContainer::ClearForFullParse()
                                     VarType::PieceSeamLineArea});
     ClearGObjects();
     ClearUniqueNames();
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -410,12 +425,14 @@ void VContainer::ClearGObjects()
 {
     d->calculationObjects.clear();
     d->modelingObjects->clear();
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VContainer::ClearCalculationGObjects()
 {
     d->calculationObjects.clear();
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -435,18 +452,22 @@ void VContainer::ClearVariables(const QVector<VarType> &types)
         }
         else
         {
-            for (auto i = d->variables.begin(); i != d->variables.end();)
+            QStringList names;
+            for (auto i = d->variables.constBegin(); i != d->variables.constEnd(); ++i)
             {
                 if (types.contains(i.value()->GetType()))
                 {
-                    i = d->variables.erase(i);
-                }
-                else
-                {
-                    ++i;
+                    names.append(i.key());
                 }
             }
+
+            for (const auto &name : names)
+            {
+                d->variables.remove(name);
+            }
         }
+
+        Modified();
     }
 }
 
@@ -532,12 +553,14 @@ void VContainer::AddCurveWithSegments(const QSharedPointer<VAbstractCubicBezierP
 void VContainer::RemoveVariable(const QString &name)
 {
     d->variables.remove(name);
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VContainer::RemovePiece(quint32 id)
 {
     d->pieces->remove(id);
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -545,6 +568,7 @@ void VContainer::UpdatePiece(quint32 id, const VPiece &detail)
 {
     Q_ASSERT_X(id != NULL_ID, Q_FUNC_INFO, "id == 0"); //-V654 //-V712
     d->pieces->insert(id, detail);
+    Modified();
     UpdateId(id);
 }
 
@@ -553,6 +577,7 @@ void VContainer::UpdatePiecePath(quint32 id, const VPiecePath &path)
 {
     Q_ASSERT_X(id != NULL_ID, Q_FUNC_INFO, "id == 0"); //-V654 //-V712
     d->piecePaths->insert(id, path);
+    Modified();
     UpdateId(id);
 }
 
@@ -563,8 +588,8 @@ void VContainer::UpdatePiecePath(quint32 id, const VPiecePath &path)
  */
 void VContainer::RemoveIncrement(const QString &name)
 {
-    d->variables[name].clear();
     d->variables.remove(name);
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -740,6 +765,26 @@ auto VContainer::GetTrVars() const -> const VTranslateVars *
     return d->trVars;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Revision returns the current state of the data.
+ *
+ * Any change through the container or its copies produces a new revision, so it can key caches of values computed
+ * from the data. Objects changed in place bypass the counter, change them only through UpdateGObject().
+ */
+auto VContainer::Revision() const -> VContainerRevision
+{
+    return {.data = d->revision, .shared = d->sharedRevision->loadRelaxed()};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VContainer::Modified()
+{
+    const quint64 revision = NextRevision();
+    d->revision = revision;
+    d->sharedRevision->storeRelaxed(revision);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 template <typename T> auto VContainer::DataVar(const VarType &type) const -> QMap<QString, QSharedPointer<T>>
 {
@@ -803,7 +848,7 @@ void VContainer::RemoveUniqueName(const QString &name) const
  * @brief data container with datagObjects return container of gObjects
  * @return pointer on container of gObjects
  */
-auto VContainer::CalculationGObjects() const -> const QHash<quint32, QSharedPointer<VGObject>> *
+auto VContainer::CalculationGObjects() const -> const VGObjectHash *
 {
     return &d->calculationObjects;
 }
@@ -815,7 +860,7 @@ auto VContainer::DataPieces() const -> QHash<quint32, VPiece> *
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VContainer::DataVariables() const -> const QHash<QString, QSharedPointer<VInternalVariable>> *
+auto VContainer::DataVariables() const -> const VInternalVariableHash *
 {
     return &d->variables;
 }
@@ -824,7 +869,25 @@ auto VContainer::DataVariables() const -> const QHash<QString, QSharedPointer<VI
 VContainerData::VContainerData(const VTranslateVars *trVars, const Unit *patternUnit, QString nspace)
   : trVars(trVars),
     patternUnit(patternUnit),
-    nspace(std::move(nspace))
+    nspace(std::move(nspace)),
+    revision(NextRevision()),
+    sharedRevision(QSharedPointer<QAtomicInteger<quint64>>::create(revision))
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VContainerData::VContainerData(const VContainerData &data)
+  : QSharedData(data),
+    calculationObjects(data.calculationObjects),
+    modelingObjects(data.modelingObjects),
+    variables(data.variables),
+    pieces(data.pieces),
+    piecePaths(data.piecePaths),
+    trVars(data.trVars),
+    patternUnit(data.patternUnit),
+    nspace(data.nspace),
+    revision(NextRevision()),
+    sharedRevision(data.sharedRevision)
 {
 }
 
@@ -34,6 +34,7 @@
 #include <QMap>
 #include <QMessageLogger>
 #include <QSet>
+#include <QAtomicInteger>
 #include <QSharedData>
 #include <QSharedDataPointer>
 #include <QSharedPointer>
@@ -48,6 +49,7 @@
 #include "../vgeometry/vabstractcurve.h"
 #include "../vgeometry/vgobject.h"
 #include "../vmisc/def.h"
+#include "../vmisc/vpersistenthash.h"
 #include "variables/vinternalvariable.h"
 #include "vpiece.h"
 #include "vpiecepath.h"
@@ -64,6 +66,33 @@ class VArcRadius;
 class VCurveAngle;
 class VPieceArea;
 
+using VGObjectHash = VPersistentHash<quint32, QSharedPointer<VGObject>>;
+
+/**
+ * @brief The VContainerRevision struct identifies a state of container data.
+ *
+ * Copies of a container share objects, pieces and piece paths, so a state is described by two numbers. The data
+ * revision changes when the container or its copy is detached and changed. The shared revision changes on any change
+ * made through any copy. Equal revisions mean equal content.
+ */
+struct VContainerRevision
+{
+    quint64 data{0};   // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 shared{0}; // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto operator==(const VContainerRevision &lhs, const VContainerRevision &rhs) -> bool
+{
+    return lhs.data == rhs.data && lhs.shared == rhs.shared;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto operator!=(const VContainerRevision &lhs, const VContainerRevision &rhs) -> bool
+{
+    return not(lhs == rhs);
+}
+
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_INTEL(2021)
@@ -73,11 +102,13 @@ class VContainerData final : public QSharedData //-V690
 {
 public:
     VContainerData(const VTranslateVars *trVars, const Unit *patternUnit, QString nspace);
-    VContainerData(const VContainerData &data) = default;
+    VContainerData(const VContainerData &data);
     ~VContainerData();
 
+    // Every tool keeps a copy of the data. Persistent hashes share their nodes with the copy, so a copy is cheap and
+    // a change after it copies only a few nodes instead of the whole hash.
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
-    QHash<quint32, QSharedPointer<VGObject>> calculationObjects{};
+    VGObjectHash calculationObjects{};
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     QSharedPointer<QHash<quint32, QSharedPointer<VGObject>>> modelingObjects{
         QSharedPointer<QHash<quint32, QSharedPointer<VGObject>>>::create()};
@@ -86,7 +117,7 @@ public:
      * @brief variables container for measurements, increments, lines lengths, lines angles, arcs lengths, curve lengths
      */
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
-    QHash<QString, QSharedPointer<VInternalVariable>> variables{};
+    VInternalVariableHash variables{};
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     QSharedPointer<QHash<quint32, VPiece>> pieces{QSharedPointer<QHash<quint32, VPiece>>::create()};
@@ -99,6 +130,12 @@ public:
     /** @brief nspace namespace for static variables */
     QString nspace; // NOLINT(misc-non-private-member-variables-in-classes)
 
+    /** @brief revision number of the last change of this data. A detached copy gets a new number. */
+    quint64 revision; // NOLINT(misc-non-private-member-variables-in-classes)
+    /** @brief sharedRevision number of the last change made through any copy. */
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    QSharedPointer<QAtomicInteger<quint64>> sharedRevision;
+
 private:
     Q_DISABLE_ASSIGN_MOVE(VContainerData) // NOLINT
 };
@@ -180,9 +217,9 @@ public:
 
     void FillPiecesAreas(Unit unit);
 
-    auto CalculationGObjects() const -> const QHash<quint32, QSharedPointer<VGObject>> *;
+    auto CalculationGObjects() const -> const VGObjectHash *;
     auto DataPieces() const -> QHash<quint32, VPiece> *;
-    auto DataVariables() const -> const QHash<QString, QSharedPointer<VInternalVariable>> *;
+    auto DataVariables() const -> const VInternalVariableHash *;
 
     auto DataMeasurements() const -> QMap<QString, QSharedPointer<VMeasurement>>;
     auto DataMeasurementsWithSeparators() const -> QMap<QString, QSharedPointer<VMeasurement>>;
@@ -207,6 +244,8 @@ public:
     auto GetPatternUnit() const -> const Unit *;
     auto GetTrVars() const -> const VTranslateVars *;
 
+    auto Revision() const -> VContainerRevision;
+
 private:
     /**
      * @brief _id current id. New object will have value +1. For empty class equal 0.
@@ -232,6 +271,8 @@ private:
     template <typename T> auto DataVar(const VarType &type) const -> QMap<QString, QSharedPointer<T>>;
 
     static void ClearNamespace(const QString &nspace);
+
+    void Modified();
 };
 
 Q_DECLARE_TYPEINFO(VContainer, Q_MOVABLE_TYPE); // NOLINT
@@ -385,6 +426,8 @@ void VContainer::AddVariable(const QSharedPointer<T> &var, const QString &name)
     {
         d->variables.insert(name, var);
     }
+
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -461,6 +504,7 @@ template <typename T> void VContainer::UpdateObject(const quint32 &id, const QSh
         return;
     }
 
+    Modified();
     UpdateId(id);
 }
 #endif // VCONTAINER_H
@@ -662,7 +662,18 @@ VPassmark::VPassmark(const VPiecePassmarkData &data)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VPassmark::FullPassmark(const VPiece &piece, const VContainer *data) const -> QVector<QLineF>
+/**
+ * @brief Options read settings full passmarks depend on. Call it on the GUI thread.
+ */
+auto VPassmark::Options() -> VPassmarkOptions
+{
+    const VCommonSettings *settings = VAbstractApplication::VApp()->Settings();
+    return {.doublePassmark = settings->IsDoublePassmark(), .pieceShowMainPath = settings->IsPieceShowMainPath()};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPassmark::FullPassmark(const VPiece &piece, const VContainer *data, const VPassmarkOptions &options) const
+    -> QVector<QLineF>
 {
     if (m_null)
     {
@@ -673,8 +684,7 @@ auto VPassmark::FullPassmark(const VPiece &piece, const VContainer *data) const
     {
         QVector<QLineF> lines;
         lines += SAPassmark(piece, data, PassmarkSide::All);
-        if (VAbstractApplication::VApp()->Settings()->IsDoublePassmark() &&
-            (VAbstractApplication::VApp()->Settings()->IsPieceShowMainPath() || not piece.IsHideMainPath()) &&
+        if (options.doublePassmark && (options.pieceShowMainPath || not piece.IsHideMainPath()) &&
             m_data.isMainPathNode && m_data.passmarkAngleType != PassmarkAngleType::Intersection &&
             m_data.passmarkAngleType != PassmarkAngleType::IntersectionOnlyLeft &&
             m_data.passmarkAngleType != PassmarkAngleType::IntersectionOnlyRight &&
@@ -75,6 +75,29 @@ Q_DECLARE_TYPEINFO(VPiecePassmarkData, Q_MOVABLE_TYPE); // NOLINT
 
 QT_WARNING_POP
 
+/**
+ * @brief The VPassmarkOptions struct keeps settings a full passmark depends on.
+ *
+ * Settings are not safe to read from several threads. Read them on the GUI thread with VPassmark::Options().
+ */
+struct VPassmarkOptions
+{
+    bool doublePassmark{false};    // NOLINT(misc-non-private-member-variables-in-classes)
+    bool pieceShowMainPath{false}; // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto operator==(const VPassmarkOptions &lhs, const VPassmarkOptions &rhs) -> bool
+{
+    return lhs.doublePassmark == rhs.doublePassmark && lhs.pieceShowMainPath == rhs.pieceShowMainPath;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline auto operator!=(const VPassmarkOptions &lhs, const VPassmarkOptions &rhs) -> bool
+{
+    return !(lhs == rhs);
+}
+
 enum class PassmarkSide : qint8
 {
     All = 0,
@@ -88,7 +111,10 @@ public:
     VPassmark() = default;
     explicit VPassmark(const VPiecePassmarkData &data);
 
-    auto FullPassmark(const VPiece &piece, const VContainer *data) const -> QVector<QLineF>;
+    static auto Options() -> VPassmarkOptions;
+
+    auto FullPassmark(const VPiece &piece, const VContainer *data, const VPassmarkOptions &options) const
+        -> QVector<QLineF>;
     auto SAPassmark(const VPiece &piece, const VContainer *data, PassmarkSide side) const -> QVector<QLineF>;
     auto SAPassmark(const QVector<QPointF> &seamAllowance, const QVector<QPointF> &rotatedSeamAllowance,
                     PassmarkSide side) const -> QVector<QLineF>;
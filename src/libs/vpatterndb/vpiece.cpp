@@ -44,10 +44,12 @@
 #include "vpassmark.h"
 #include "vpiece_p.h"
 
+#include <QAtomicInteger>
 #include <QDebug>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QMutexLocker>
 #include <QPainterPath>
 #include <QSharedPointer>
 #include <QTemporaryFile>
@@ -56,6 +58,67 @@ using namespace Qt::Literals::StringLiterals;
 
 namespace
 {
+QAtomicInteger<quint64> geometryCacheHits{0};   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+QAtomicInteger<quint64> geometryCacheMisses{0}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+QAtomicInteger<quint64> geometryEpoch{0};       // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Memoized returns a value from the piece geometry memo or builds and stores it.
+ *
+ * The memo is valid for one piece revision, one container revision and one geometry epoch. Any other state drops all
+ * stored values. The value is built outside the lock, building may ask the memo for other values. A stored value is
+ * used only if it matches other inputs of the value, for example settings.
+ */
+template <typename T, typename Builder, typename Matcher>
+auto Memoized(VPieceGeometryMemo &memo,
+              quint64 pieceRevision,
+              const VContainer *data,
+              std::optional<T> VPieceGeometryMemo::*slot,
+              Builder build,
+              Matcher matches) -> T
+{
+    if (data == nullptr)
+    {
+        return build();
+    }
+
+    const VContainerRevision containerRevision = data->Revision();
+    const quint64 epoch = geometryEpoch.loadAcquire();
+
+    {
+        QMutexLocker const locker(&memo.mutex);
+        if (memo.pieceRevision == pieceRevision && memo.containerRevision == containerRevision && memo.epoch == epoch &&
+            (memo.*slot).has_value() && matches(*(memo.*slot)))
+        {
+            ++geometryCacheHits;
+            return *(memo.*slot);
+        }
+    }
+
+    ++geometryCacheMisses;
+    T value = build();
+
+    QMutexLocker const locker(&memo.mutex);
+    if (memo.pieceRevision != pieceRevision || memo.containerRevision != containerRevision || memo.epoch != epoch)
+    {
+        memo.Reset(pieceRevision, containerRevision, epoch);
+    }
+    memo.*slot = value;
+    return value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T, typename Builder>
+auto Memoized(VPieceGeometryMemo &memo,
+              quint64 pieceRevision,
+              const VContainer *data,
+              std::optional<T> VPieceGeometryMemo::*slot,
+              Builder build) -> T
+{
+    return Memoized(memo, pieceRevision, data, slot, build, [](const T &) { return true; });
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 auto IsPassmarksPossible(const QVector<VPieceNode> &path) -> bool
 {
@@ -240,6 +303,7 @@ auto VPiece::GetPath() const -> VPiecePath
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::GetPath() -> VPiecePath &
 {
+    Modified();
     return d->m_path;
 }
 
@@ -247,10 +311,21 @@ auto VPiece::GetPath() -> VPiecePath &
 void VPiece::SetPath(const VPiecePath &path)
 {
     d->m_path = path;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::MainPathPoints(const VContainer *data) const -> QVector<VLayoutPoint>
+{
+    return Memoized(d->m_geometryMemo,
+                    Revision(),
+                    data,
+                    &VPieceGeometryMemo::mainPathPoints,
+                    [this, data]() { return BuildMainPathPoints(data); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPiece::BuildMainPathPoints(const VContainer *data) const -> QVector<VLayoutPoint>
 {
     //    DumpPiece(*this, data, QStringLiteral("input.json.XXXXXX"));  // Uncomment for dumping test data
 
@@ -312,7 +387,11 @@ auto VPiece::MainPathNodePoints(const VContainer *data, bool showExcluded) const
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::SeamAllowancePoints(const VContainer *data) const -> QVector<VLayoutPoint>
 {
-    return SeamAllowancePointsWithRotation(data, -1);
+    return Memoized(d->m_geometryMemo,
+                    Revision(),
+                    data,
+                    &VPieceGeometryMemo::seamAllowancePoints,
+                    [this, data]() { return SeamAllowancePointsWithRotation(data, -1); });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -336,7 +415,21 @@ auto VPiece::CuttingPathPoints(const VContainer *data) const -> QVector<QPointF>
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VPiece::PassmarksLines(const VContainer *data) const -> QVector<QLineF>
+auto VPiece::PassmarksLines(const VContainer *data, const VPassmarkOptions &options) const -> QVector<QLineF>
+{
+    // Lines depend on settings too, lines built for other settings are not reused
+    const VPassmarksLinesMemo memoized = Memoized(
+        d->m_geometryMemo,
+        Revision(),
+        data,
+        &VPieceGeometryMemo::passmarksLines,
+        [this, data, options]() { return VPassmarksLinesMemo{options, BuildPassmarksLines(data, options)}; },
+        [options](const VPassmarksLinesMemo &value) { return value.options == options; });
+    return memoized.lines;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPiece::BuildPassmarksLines(const VContainer *data, const VPassmarkOptions &options) const -> QVector<QLineF>
 {
     QVector<VPassmark> const passmarks = Passmarks(data);
     QVector<QLineF> lines;
@@ -344,7 +437,7 @@ auto VPiece::PassmarksLines(const VContainer *data) const -> QVector<QLineF>
     {
         if (not passmark.IsNull())
         {
-            lines += passmark.FullPassmark(*this, data);
+            lines += passmark.FullPassmark(*this, data, options);
         }
     }
 
@@ -353,6 +446,16 @@ auto VPiece::PassmarksLines(const VContainer *data) const -> QVector<QLineF>
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::Passmarks(const VContainer *data) const -> QVector<VPassmark>
+{
+    return Memoized(d->m_geometryMemo,
+                    Revision(),
+                    data,
+                    &VPieceGeometryMemo::passmarks,
+                    [this, data]() { return BuildPassmarks(data); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPiece::BuildPassmarks(const VContainer *data) const -> QVector<VPassmark>
 {
     const QVector<VPieceNode> unitedPath = GetUnitedPath(data);
     if (not IsSeamAllowance() || not IsPassmarksPossible(unitedPath))
@@ -388,9 +491,16 @@ auto VPiece::CurvesPainterPath(const VContainer *data) const -> QVector<QPainter
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::MainPathPath(const VContainer *data) const -> QPainterPath
 {
-    QVector<QPointF> points;
-    CastTo(MainPathPoints(data), points);
-    return VPiece::MainPathPath(points);
+    return Memoized(d->m_geometryMemo,
+                    Revision(),
+                    data,
+                    &VPieceGeometryMemo::mainPathPath,
+                    [this, data]()
+                    {
+                        QVector<QPointF> points;
+                        CastTo(MainPathPoints(data), points);
+                        return VPiece::MainPathPath(points);
+                    });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -451,9 +561,9 @@ auto VPiece::FullSeamAllowancePath(const VContainer *data) const -> QPainterPath
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VPiece::PassmarksPath(const VContainer *data) const -> QPainterPath
+auto VPiece::PassmarksPath(const VContainer *data, const VPassmarkOptions &options) const -> QPainterPath
 {
-    const QVector<QLineF> passmarks = PassmarksLines(data);
+    const QVector<QLineF> passmarks = PassmarksLines(data, options);
     QPainterPath path;
 
     // seam allowence
@@ -473,6 +583,16 @@ auto VPiece::PassmarksPath(const VContainer *data) const -> QPainterPath
 
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::PlaceLabelPath(const VContainer *data) const -> QPainterPath
+{
+    return Memoized(d->m_geometryMemo,
+                    Revision(),
+                    data,
+                    &VPieceGeometryMemo::placeLabelPath,
+                    [this, data]() { return BuildPlaceLabelPath(data); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPiece::BuildPlaceLabelPath(const VContainer *data) const -> QPainterPath
 {
     QPainterPath path;
     for (auto placeLabel : d->m_placeLabels)
@@ -541,6 +661,7 @@ auto VPiece::IsInLayout() const -> bool
 void VPiece::SetInLayout(bool inLayout)
 {
     d->m_inLayout = inLayout;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -553,6 +674,7 @@ auto VPiece::IsUnited() const -> bool
 void VPiece::SetUnited(bool united)
 {
     d->m_united = united;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -565,6 +687,7 @@ auto VPiece::GetShortName() const -> QString
 void VPiece::SetShortName(const QString &value)
 {
     d->m_shortName = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -579,6 +702,8 @@ void VPiece::SetFormulaSAWidth(const QString &formula, qreal value)
     SetSAWidth(value);
     const qreal width = GetSAWidth();
     width >= 0 ? d->m_formulaWidth = formula : d->m_formulaWidth = '0'_L1;
+
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -590,6 +715,7 @@ auto VPiece::GetInternalPaths() const -> QVector<quint32>
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::GetInternalPaths() -> QVector<quint32> &
 {
+    Modified();
     return d->m_internalPaths;
 }
 
@@ -597,6 +723,7 @@ auto VPiece::GetInternalPaths() -> QVector<quint32> &
 void VPiece::SetInternalPaths(const QVector<quint32> &iPaths)
 {
     d->m_internalPaths = iPaths;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -608,6 +735,7 @@ auto VPiece::GetCustomSARecords() const -> QVector<CustomSARecord>
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::GetCustomSARecords() -> QVector<CustomSARecord> &
 {
+    Modified();
     return d->m_customSARecords;
 }
 
@@ -615,6 +743,7 @@ auto VPiece::GetCustomSARecords() -> QVector<CustomSARecord> &
 void VPiece::SetCustomSARecords(const QVector<CustomSARecord> &records)
 {
     d->m_customSARecords = records;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -626,6 +755,7 @@ auto VPiece::GetPins() const -> QVector<quint32>
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::GetPins() -> QVector<quint32> &
 {
+    Modified();
     return d->m_pins;
 }
 
@@ -633,6 +763,7 @@ auto VPiece::GetPins() -> QVector<quint32> &
 void VPiece::SetPins(const QVector<quint32> &pins)
 {
     d->m_pins = pins;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -644,6 +775,7 @@ auto VPiece::GetPlaceLabels() const -> QVector<quint32>
 //---------------------------------------------------------------------------------------------------------------------
 auto VPiece::GetPlaceLabels() -> QVector<quint32> &
 {
+    Modified();
     return d->m_placeLabels;
 }
 
@@ -651,6 +783,7 @@ auto VPiece::GetPlaceLabels() -> QVector<quint32> &
 void VPiece::SetPlaceLabels(const QVector<quint32> &labels)
 {
     d->m_placeLabels = labels;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -688,6 +821,8 @@ void VPiece::SetPieceLabelData(const VPieceLabelData &data)
 {
     d->m_ppData = data;
     d->m_ppData.SetAreaShortName(VPieceArea::PieceShortName(*this));
+
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -697,6 +832,7 @@ void VPiece::SetPieceLabelData(const VPieceLabelData &data)
  */
 auto VPiece::GetPieceLabelData() -> VPieceLabelData &
 {
+    Modified();
     return d->m_ppData;
 }
 
@@ -714,6 +850,7 @@ auto VPiece::GetPieceLabelData() const -> const VPieceLabelData &
 void VPiece::SetPatternLabelData(const VPatternLabelData &info)
 {
     d->m_piPatternInfo = info;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -723,6 +860,7 @@ void VPiece::SetPatternLabelData(const VPatternLabelData &info)
  */
 auto VPiece::GetPatternLabelData() -> VPatternLabelData &
 {
+    Modified();
     return d->m_piPatternInfo;
 }
 
@@ -740,6 +878,7 @@ auto VPiece::GetPatternLabelData() const -> const VPatternLabelData &
 void VPiece::SetGrainlineGeometry(const VGrainlineData &data)
 {
     d->m_glGrainline = data;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -749,6 +888,7 @@ void VPiece::SetGrainlineGeometry(const VGrainlineData &data)
  */
 auto VPiece::GetGrainlineGeometry() -> VGrainlineData &
 {
+    Modified();
     return d->m_glGrainline;
 }
 
@@ -766,6 +906,7 @@ auto VPiece::GetGrainlineGeometry() const -> const VGrainlineData &
 void VPiece::SetMirrorLineStartPoint(quint32 id)
 {
     d->m_mirrorLineStartPoint = id;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -778,6 +919,7 @@ auto VPiece::GetMirrorLineStartPoint() const -> quint32
 void VPiece::SetMirrorLineEndPoint(quint32 id)
 {
     d->m_mirrorLineEndPoint = id;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -834,6 +976,7 @@ auto VPiece::FullSeamAllowancePointsWithRotation(const VContainer *data, vsizety
 void VPiece::SetGradationLabel(const QString &label)
 {
     d->m_gradationLabel = label;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -852,6 +995,7 @@ auto VPiece::IsManualFoldHeight() const -> bool
 void VPiece::SetManualFoldHeight(bool value)
 {
     d->m_manualFoldHeight = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -864,6 +1008,7 @@ auto VPiece::IsManualFoldWidth() const -> bool
 void VPiece::SetManualFoldWidth(bool value)
 {
     d->m_manualFoldWidth = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -876,6 +1021,7 @@ auto VPiece::IsManualFoldCenter() const -> bool
 void VPiece::SetManualFoldCenter(bool value)
 {
     d->m_manualFoldCenter = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -888,6 +1034,7 @@ auto VPiece::GetFormulaFoldHeight() const -> QString
 void VPiece::SetFormulaFoldHeight(const QString &value)
 {
     d->m_formulaFoldHeight = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -900,6 +1047,7 @@ auto VPiece::GetFormulaFoldWidth() const -> QString
 void VPiece::SetFormulaFoldWidth(const QString &value)
 {
     d->m_formulaFoldWidth = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -912,6 +1060,7 @@ auto VPiece::GetFormulaFoldCenter() const -> QString
 void VPiece::SetFormulaFoldCenter(const QString &value)
 {
     d->m_formulaFoldCenter = value;
+    Modified();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1429,7 +1578,7 @@ auto VPiece::GlobalPassmarkLength(const VContainer *data) const -> qreal
     try
     {
         QSharedPointer<VInternalVariable> const var = data->GetVariable<VInternalVariable>(passmarkLengthVariable);
-        length = *var->GetValue();
+        length = std::as_const(*var).GetValue();
 
         if (VAbstractValApplication::VApp()->toPixel(length) <= accuracyPointOnLine)
         {
@@ -1464,7 +1613,7 @@ auto VPiece::GlobalPassmarkWidth(const VContainer *data) const -> qreal
     try
     {
         QSharedPointer<VInternalVariable> const var = data->GetVariable<VInternalVariable>(passmarkWidthVariable);
-        width = *var->GetValue();
+        width = std::as_const(*var).GetValue();
 
         if (VAbstractValApplication::VApp()->toPixel(width) <= accuracyPointOnLine)
         {
@@ -1814,3 +1963,38 @@ auto VPiece::ShortNameRegExp() -> QString
 
     return regex;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+auto VPieceGeometryCacheStatistics::HitRate() const -> qreal
+{
+    const quint64 total = hits + misses;
+    return total > 0 ? static_cast<qreal>(hits) / static_cast<qreal>(total) : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GeometryCacheStatistics returns hits and misses of the derived geometry memo of all pieces.
+ */
+auto VPiece::GeometryCacheStatistics() -> VPieceGeometryCacheStatistics
+{
+    return {.hits = geometryCacheHits.loadRelaxed(), .misses = geometryCacheMisses.loadRelaxed()};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief InvalidateGeometryCache drops memoized geometry of all pieces.
+ *
+ * Call it when an input of piece geometry changes that is neither piece nor container data. For example, pattern
+ * properties that define global passmark length and width.
+ */
+void VPiece::InvalidateGeometryCache()
+{
+    geometryEpoch.fetchAndAddOrdered(1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPiece::ResetGeometryCacheStatistics()
+{
+    geometryCacheHits.storeRelaxed(0);
+    geometryCacheMisses.storeRelaxed(0);
+}
@@ -44,6 +44,15 @@ class VContainer;
 class QPainterPath;
 class VPointF;
 class VPassmark;
+struct VPassmarkOptions;
+
+struct VPieceGeometryCacheStatistics
+{
+    quint64 hits{0};   // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 misses{0}; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    auto HitRate() const -> qreal;
+};
 
 class VPiece : public VAbstractPiece
 {
@@ -71,7 +80,7 @@ public:
     auto SeamAllowancePoints(const VContainer *data) const -> QVector<VLayoutPoint>;
     auto FullSeamAllowancePoints(const VContainer *data) const -> QVector<VLayoutPoint>;
     auto CuttingPathPoints(const VContainer *data) const -> QVector<QPointF>;
-    auto PassmarksLines(const VContainer *data) const -> QVector<QLineF>;
+    auto PassmarksLines(const VContainer *data, const VPassmarkOptions &options) const -> QVector<QLineF>;
 
     auto Passmarks(const VContainer *data) const -> QVector<VPassmark>;
 
@@ -84,7 +93,7 @@ public:
     auto SeamAllowancePath(const VContainer *data) const -> QPainterPath;
     auto FullSeamAllowancePath(const VContainer *data) const -> QPainterPath;
     template <class T> auto SeamAllowancePath(const QVector<T> &points) const -> QPainterPath;
-    auto PassmarksPath(const VContainer *data) const -> QPainterPath;
+    auto PassmarksPath(const VContainer *data, const VPassmarkOptions &options) const -> QPainterPath;
     auto PlaceLabelPath(const VContainer *data) const -> QPainterPath;
 
     auto IsSeamAllowanceValid(const VContainer *data) const -> bool;
@@ -166,6 +175,10 @@ public:
 
     static void DumpPiece(const VPiece &piece, const VContainer *data, const QString &templateName = QString());
 
+    static auto GeometryCacheStatistics() -> VPieceGeometryCacheStatistics;
+    static void ResetGeometryCacheStatistics();
+    static void InvalidateGeometryCache();
+
     void TestInternalPaths(const VContainer *data) const;
 
     static auto ShortNameRegExp() -> QString;
@@ -179,6 +192,11 @@ public:
 private:
     QSharedDataPointer<VPieceData> d;
 
+    auto BuildMainPathPoints(const VContainer *data) const -> QVector<VLayoutPoint>;
+    auto BuildPassmarksLines(const VContainer *data, const VPassmarkOptions &options) const -> QVector<QLineF>;
+    auto BuildPassmarks(const VContainer *data) const -> QVector<VPassmark>;
+    auto BuildPlaceLabelPath(const VContainer *data) const -> QPainterPath;
+
     auto GetValidRecords() const -> QVector<CustomSARecord>;
     auto FilterRecords(QVector<CustomSARecord> records) const -> QVector<CustomSARecord>;
 
@@ -29,20 +29,65 @@
 #ifndef VPIECE_P_H
 #define VPIECE_P_H
 
+#include <QLineF>
+#include <QMutex>
+#include <QPainterPath>
 #include <QSharedData>
 #include <QVector>
+#include <optional>
 
+#include "../vlayout/vlayoutpoint.h"
 #include "../vmisc/def.h"
 #include "../vmisc/typedef.h"
 #include "floatItemData/vgrainlinedata.h"
 #include "floatItemData/vpatternlabeldata.h"
 #include "floatItemData/vpiecelabeldata.h"
+#include "vcontainer.h"
+#include "vpassmark.h"
 #include "vpiecepath.h"
 
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
 
+/** @brief The VPassmarksLinesMemo struct keeps passmark lines together with the options they were built with. */
+struct VPassmarksLinesMemo
+{
+    VPassmarkOptions options{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    QVector<QLineF> lines{};    // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+/**
+ * @brief The VPieceGeometryMemo class keeps geometry derived from a piece for one state of the piece and its data.
+ *
+ * A copy starts empty. Piece data is copied only before a change, and the changed copy must not return results of the
+ * original.
+ */
+class VPieceGeometryMemo
+{
+public:
+    VPieceGeometryMemo() = default;
+    VPieceGeometryMemo(const VPieceGeometryMemo & /*memo*/) {} // NOLINT(bugprone-copy-constructor-init)
+    ~VPieceGeometryMemo() = default;
+
+    void Reset(quint64 revision, const VContainerRevision &dataRevision, quint64 geometryEpoch);
+
+    QMutex mutex{};                         // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 pieceRevision{0};               // NOLINT(misc-non-private-member-variables-in-classes)
+    VContainerRevision containerRevision{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    quint64 epoch{0};                       // NOLINT(misc-non-private-member-variables-in-classes)
+
+    std::optional<QVector<VLayoutPoint>> mainPathPoints{};      // NOLINT(misc-non-private-member-variables-in-classes)
+    std::optional<QVector<VLayoutPoint>> seamAllowancePoints{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::optional<QVector<VPassmark>> passmarks{};              // NOLINT(misc-non-private-member-variables-in-classes)
+    std::optional<VPassmarksLinesMemo> passmarksLines{};        // NOLINT(misc-non-private-member-variables-in-classes)
+    std::optional<QPainterPath> mainPathPath{};                 // NOLINT(misc-non-private-member-variables-in-classes)
+    std::optional<QPainterPath> placeLabelPath{};               // NOLINT(misc-non-private-member-variables-in-classes)
+
+private:
+    Q_DISABLE_ASSIGN_MOVE(VPieceGeometryMemo) // NOLINT
+};
+
 class VPieceData : public QSharedData
 {
 public:
@@ -87,12 +132,28 @@ public:
     QString m_formulaFoldWidth{};  // NOLINT(misc-non-private-member-variables-in-classes)
     QString m_formulaFoldCenter{}; // NOLINT(misc-non-private-member-variables-in-classes)
 
+    mutable VPieceGeometryMemo m_geometryMemo{}; // NOLINT(misc-non-private-member-variables-in-classes)
+
 private:
     Q_DISABLE_ASSIGN_MOVE(VPieceData) // NOLINT
 };
 
 QT_WARNING_POP
 
+//---------------------------------------------------------------------------------------------------------------------
+inline void VPieceGeometryMemo::Reset(quint64 revision, const VContainerRevision &dataRevision, quint64 geometryEpoch)
+{
+    pieceRevision = revision;
+    containerRevision = dataRevision;
+    epoch = geometryEpoch;
+    mainPathPoints.reset();
+    seamAllowancePoints.reset();
+    passmarks.reset();
+    passmarksLines.reset();
+    mainPathPath.reset();
+    placeLabelPath.reset();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 inline VPieceData::VPieceData(PiecePathType type)
   : m_path(type)
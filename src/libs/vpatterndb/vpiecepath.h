@@ -34,6 +34,7 @@
 
 #include "../vgeometry/vabstractcurve.h"
 #include "../vmisc/def.h"
+#include "variables/vinternalvariable.h"
 
 class VPiecePathData;
 class VSAPoint;
@@ -41,7 +42,6 @@ class VContainer;
 class QPainterPath;
 class VPointF;
 class VPieceNode;
-class VInternalVariable;
 class VLayoutPoint;
 
 class VPiecePath
@@ -121,7 +121,7 @@ public:
     auto NodePreviousPoint(const VContainer *data, int i) const -> QPointF;
     auto NodeNextPoint(const VContainer *data, int i) const -> QPointF;
 
-    auto IsVisible(const QHash<QString, QSharedPointer<VInternalVariable>> *vars) const -> bool;
+    auto IsVisible(const VInternalVariableHash *vars) const -> bool;
 
     static auto indexOfNode(const QVector<VPieceNode> &nodes, quint32 id) -> int;
 
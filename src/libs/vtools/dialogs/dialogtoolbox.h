@@ -68,7 +68,7 @@ QT_WARNING_DISABLE_GCC("-Weffc++")
 struct FormulaData
 {
     QString formula;
-    const QHash<QString, QSharedPointer<VInternalVariable>> *variables{nullptr};
+    const VInternalVariableHash *variables{nullptr};
     QLabel *labelEditFormula{nullptr};
     QLabel *labelResult{nullptr};
     QString postfix{};
@@ -205,7 +205,7 @@ void DialogTool::FillComboBoxArcCurves(QComboBox *box, FillComboBox rule, quint3
     SCASSERT(box != nullptr)
     const QSignalBlocker blocker(box);
 
-    const QHash<quint32, QSharedPointer<VGObject>> *objs = data.CalculationGObjects();
+    const VGObjectHash *objs = data.CalculationGObjects();
     QMap<QString, quint32> list;
     for (auto i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
@@ -765,7 +765,7 @@ void DialogTool::FillCombo(QComboBox *box, GOType gType, FillComboBox rule, cons
     SCASSERT(box != nullptr)
     const QSignalBlocker blocker(box);
 
-    const QHash<quint32, QSharedPointer<VGObject>> *objs = data.CalculationGObjects();
+    const VGObjectHash *objs = data.CalculationGObjects();
     QMap<QString, quint32> list;
     for (auto i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
@@ -1824,7 +1824,7 @@ void DialogSeamAllowance::PlaceLabelDialogClosed(int result)
         {
             VPlaceLabelItem const currentLabel = CurrentPlaceLabel(dialogTool->GetToolId());
 
-            const QHash<QString, QSharedPointer<VInternalVariable>> *vars = data.DataVariables();
+            const VInternalVariableHash *vars = data.DataVariables();
 
             const qreal w = qAbs(Visualization::FindLengthFromUser(dialogTool->GetWidth(), vars, false));
             const qreal h = qAbs(Visualization::FindLengthFromUser(dialogTool->GetHeight(), vars, false));
@@ -2751,7 +2751,7 @@ void DialogSeamAllowance::EvalWidth()
 {
     // Avoid circular dependency. CurrentSeamAllowance value based on the width field value. On this stage, we must
     // hide from user the existence of CurrentSeamAllowance variable.
-    QHash<QString, QSharedPointer<VInternalVariable>> variables = *data.DataVariables();
+    VInternalVariableHash variables = *data.DataVariables();
     variables.remove(currentSeamAllowance);
 
     m_saWidth = Eval({.formula = uiTabPaths->plainTextEditFormulaWidth->toPlainText(),
@@ -143,7 +143,7 @@ auto EvalCachedFormula(const QString &formula, const VContainer *data) -> qreal
         }
     }
 
-    const QHash<QString, QSharedPointer<VInternalVariable>> *vars = data->DataVariables();
+    const VInternalVariableHash *vars = data->DataVariables();
     FormulaCache *cache = ThreadFormulaCache();
 
     if (const CachedFormula *entry = cache->object(formula);
@@ -395,7 +395,7 @@ auto VAbstractTool::ColorsList() -> QMap<QString, QString>
 // cppcheck-suppress unusedFunction
 auto VAbstractTool::PointsList() const -> QMap<QString, quint32>
 {
-    const QHash<quint32, QSharedPointer<VGObject>> *objs = data.CalculationGObjects();
+    const VGObjectHash *objs = data.CalculationGObjects();
     QMap<QString, quint32> list;
     for (auto i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
@@ -87,6 +87,7 @@
 #include <QMenu>
 #include <QMessageBox>
 #include <QPainterPath>
+#include <QScopeGuard>
 #include <QThread>
 #include <QTimer>
 #include <QUuid>
@@ -303,7 +304,7 @@ auto RenderSeamAllowancePath(const VPiece &detail, bool combineTogether, const V
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto RenderPassmarks(const VPiece &detail, const VContainer *data) -> QPainterPath
+auto RenderPassmarks(const VPiece &detail, const VContainer *data, const VPassmarkOptions &options) -> QPainterPath
 {
     if (const QLineF mirrorLine = detail.SeamMirrorLine(data); !mirrorLine.isNull() && detail.IsShowFullPiece())
     {
@@ -340,11 +341,12 @@ auto RenderPassmarks(const VPiece &detail, const VContainer *data) -> QPainterPa
 
         return path;
     }
-    return detail.PassmarksPath(data);
+    return detail.PassmarksPath(data, options);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto RenderFoldLine(const VPiece &detail, const VContainer *data) -> VFoldLine
+auto RenderFoldLine(const VPiece &detail, const VContainer *data, const VToolSeamAllowanceRenderOptions &options)
+    -> VFoldLine
 {
     QLineF const foldLine = detail.IsHideMainPath() ? detail.SeamAllowanceMirrorLine(data)
                                                     : detail.SeamMirrorLine(data);
@@ -356,11 +358,10 @@ auto RenderFoldLine(const VPiece &detail, const VContainer *data) -> VFoldLine
     fLine.SetLabelAlignment(detail.GetFoldLineLabelAlignment());
 
     {
-        const VCommonSettings *settings = VAbstractApplication::VApp()->Settings();
-        QFont font = settings->GetLabelFont();
+        QFont font = options.labelFont;
         font.setPointSize(static_cast<int>(detail.GetFoldLineSvgFontSize()));
         fLine.SetOutlineFont(font);
-        fLine.SetSvgFont(settings->GetLabelSVGFont());
+        fLine.SetSvgFont(options.labelSVGFont);
     }
 
     if (detail.IsManualFoldHeight())
@@ -1379,7 +1380,7 @@ void VToolSeamAllowance::UpdatePatternInfo()
 void VToolSeamAllowance::UpdatePassmarks()
 {
     const VPiece detail = VAbstractTool::data.GetPiece(m_id);
-    m_passmarks->setPath(RenderPassmarks(detail, getData()));
+    m_passmarks->setPath(RenderPassmarks(detail, getData(), VPassmark::Options()));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2133,41 +2134,68 @@ void VToolSeamAllowance::UpdateInternalPaths()
 void VToolSeamAllowance::RefreshGeometry(bool updateChildren)
 {
     qCDebug(vTool, "VToolSeamAllowance::RefreshGeometry: id=%u start.", m_id);
-    const VValentinaSettings *settings = VAbstractValApplication::VApp()->ValentinaSettings();
-    const bool combineTogether = settings->IsBoundaryTogetherWithNotches();
-    const bool pieceShowMainPath = VAbstractApplication::VApp()->Settings()->IsPieceShowMainPath();
-
-    ApplyPieceGeometry(ComputePieceGeometry(combineTogether, pieceShowMainPath), updateChildren);
+    ApplyPieceGeometry(ComputePieceGeometry(RenderOptions()), updateChildren);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VToolSeamAllowance::PrepareRefreshGeometry(bool combineTogether, bool pieceShowMainPath)
+void VToolSeamAllowance::PrepareRefreshGeometry(const VToolSeamAllowanceRenderOptions &options)
 {
     // Runs off the GUI thread (e.g. via QtConcurrent for several pieces at once). Must not touch any
     // QGraphicsItem; only ComputePieceGeometry() work happens here. The result is applied later by
-    // ApplyBatchGeometry() on the GUI thread.
+    // ApplyBatchGeometry() on the GUI thread. An exception must not leave the worker thread, the
+    // piece is skipped and reported when the geometry is applied.
+    m_batchGeometry = VToolSeamAllowanceGeometry(); // valid stays false -> piece skipped on apply
+    m_batchError.clear();
+
     try
     {
-        m_batchGeometry = ComputePieceGeometry(combineTogether, pieceShowMainPath);
+        m_batchGeometry = ComputePieceGeometry(options);
     }
     catch (const VExceptionBadId &)
     {
-        m_batchGeometry = VToolSeamAllowanceGeometry(); // valid stays false -> piece skipped on apply
+        // ignore
+    }
+    catch (const VException &e)
+    {
+        m_batchError = e.ErrorMessage();
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+auto VToolSeamAllowance::RenderOptions() -> VToolSeamAllowanceRenderOptions
+{
+    const VCommonSettings *settings = VAbstractApplication::VApp()->Settings();
+    return {.combineTogether = VAbstractValApplication::VApp()->ValentinaSettings()->IsBoundaryTogetherWithNotches(),
+            .pieceShowMainPath = settings->IsPieceShowMainPath(),
+            .passmarks = VPassmark::Options(),
+            .labelFont = settings->GetLabelFont(),
+            .labelSVGFont = settings->GetLabelSVGFont()};
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VToolSeamAllowance::ApplyBatchGeometry(bool updateChildren)
 {
+    auto Reset = qScopeGuard(
+        [this]() -> void
+        {
+            m_batchGeometry = VToolSeamAllowanceGeometry();
+            m_batchError.clear();
+        });
+
+    if (not m_batchError.isEmpty())
+    {
+        // Pedantic mode error raised on a worker thread
+        throw VException(m_batchError);
+    }
+
     if (m_batchGeometry.valid)
     {
         ApplyPieceGeometry(m_batchGeometry, updateChildren);
     }
-    m_batchGeometry = VToolSeamAllowanceGeometry();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto VToolSeamAllowance::ComputePieceGeometry(bool combineTogether, bool pieceShowMainPath) const
+auto VToolSeamAllowance::ComputePieceGeometry(const VToolSeamAllowanceRenderOptions &options) const
     -> VToolSeamAllowanceGeometry
 {
     // Pure geometry computation: safe to run on a worker thread and concurrently for different
@@ -2177,28 +2205,28 @@ auto VToolSeamAllowance::ComputePieceGeometry(bool combineTogether, bool pieceSh
     const VContainer *containerData = getData();
 
     VToolSeamAllowanceGeometry geom;
-    geom.combineTogether = combineTogether;
+    geom.combineTogether = options.combineTogether;
     geom.pos = QPointF(detail.GetMx(), detail.GetMy());
     geom.pieceName = detail.GetName();
 
-    geom.seamPath = RenderSeamPath(detail, combineTogether, containerData);
+    geom.seamPath = RenderSeamPath(detail, options.combineTogether, containerData);
 
-    if (!combineTogether)
+    if (!options.combineTogether)
     {
-        geom.passmarks = RenderPassmarks(detail, containerData);
+        geom.passmarks = RenderPassmarks(detail, containerData, options.passmarks);
     }
 
-    geom.foldLine = RenderFoldLine(detail, containerData);
-    geom.mirrorLine = RenderMirrorLine(detail, containerData, combineTogether);
+    geom.foldLine = RenderFoldLine(detail, containerData, options);
+    geom.mirrorLine = RenderMirrorLine(detail, containerData, options.combineTogether);
 
     geom.hasSeamAllowance = detail.IsSeamAllowance() && not detail.IsSeamAllowanceBuiltIn();
     if (geom.hasSeamAllowance)
     {
-        geom.seamAllowance = RenderSeamAllowancePath(detail, combineTogether, containerData);
+        geom.seamAllowance = RenderSeamAllowancePath(detail, options.combineTogether, containerData);
         geom.seamAllowanceValid = detail.IsSeamAllowanceValid(containerData);
     }
 
-    geom.showMainPath = pieceShowMainPath || not detail.IsHideMainPath() || not detail.IsSeamAllowance() ||
+    geom.showMainPath = options.pieceShowMainPath || not detail.IsHideMainPath() || not detail.IsSeamAllowance() ||
                         detail.IsSeamAllowanceBuiltIn();
 
     geom.placeLabels = detail.PlaceLabelPath(containerData);
@@ -3220,7 +3248,7 @@ auto VToolSeamAllowance::DuplicatePlaceLabels(const QVector<quint32> &placeLabel
 void VToolSeamAllowance::RefreshFoldLine()
 {
     const VPiece detail = VAbstractTool::data.GetPiece(m_id);
-    UpdateFoldLine(RenderFoldLine(detail, getData()));
+    UpdateFoldLine(RenderFoldLine(detail, getData(), RenderOptions()));
 
     // m_foldLineLabel's brush (filled glyph vs. stroke-only path) depends on the same
     // single-stroke/single-line font settings and is otherwise only refreshed by the full
@@ -29,11 +29,13 @@
 #ifndef VTOOLSEAMALLOWANCE_H
 #define VTOOLSEAMALLOWANCE_H
 
+#include <QFont>
 #include <QGraphicsPathItem>
 #include <QObject>
 #include <QtGlobal>
 
 #include "../vlayout/vfoldline.h"
+#include "../vpatterndb/vpassmark.h"
 #include "../vwidgets/vgrainlineitem.h"
 #include "../vwidgets/vtextgraphicsitem.h"
 #include "vinteractivetool.h"
@@ -70,6 +72,17 @@ struct VToolSeamAllowanceGeometry
     QString pieceName{};
 };
 
+// Settings the piece geometry depends on. Read once on the GUI thread before computing pieces in parallel, settings
+// are not safe to read from several threads.
+struct VToolSeamAllowanceRenderOptions
+{
+    bool combineTogether{false};
+    bool pieceShowMainPath{false};
+    VPassmarkOptions passmarks{};
+    QFont labelFont{};
+    QString labelSVGFont{};
+};
+
 class VToolSeamAllowance final : public VInteractiveTool, public QGraphicsPathItem
 {
     Q_OBJECT // NOLINT
@@ -138,9 +151,11 @@ public:
     // Two-phase refresh for batch updates. PrepareRefreshGeometry() computes the geometry off the
     // GUI thread (safe to call concurrently for different pieces); ApplyBatchGeometry() applies the
     // prepared result and must run on the GUI thread.
-    void PrepareRefreshGeometry(bool combineTogether, bool pieceShowMainPath);
+    void PrepareRefreshGeometry(const VToolSeamAllowanceRenderOptions &options);
     void ApplyBatchGeometry(bool updateChildren = true);
 
+    static auto RenderOptions() -> VToolSeamAllowanceRenderOptions;
+
     auto type() const -> int override { return Type; }
     enum
     {
@@ -237,6 +252,7 @@ private:
     /** @brief Geometry computed by PrepareRefreshGeometry() (off the GUI thread) and consumed by
      * ApplyBatchGeometry() (on the GUI thread). */
     VToolSeamAllowanceGeometry m_batchGeometry{};
+    QString m_batchError{};
 
     explicit VToolSeamAllowance(const VToolSeamAllowanceInitData &initData, QGraphicsItem *parent = nullptr);
 
@@ -296,7 +312,7 @@ private:
 
     void UpdateFoldLine(const VFoldLine &foldLine);
 
-    auto ComputePieceGeometry(bool combineTogether, bool pieceShowMainPath) const -> VToolSeamAllowanceGeometry;
+    auto ComputePieceGeometry(const VToolSeamAllowanceRenderOptions &options) const -> VToolSeamAllowanceGeometry;
     void ApplyPieceGeometry(const VToolSeamAllowanceGeometry &geom, bool updateChildren);
 };
 
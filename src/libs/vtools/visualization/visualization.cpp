@@ -133,16 +133,14 @@ auto Visualization::InitPoint(VColorRole role, QGraphicsItem *parent, qreal z) -
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto Visualization::FindLengthFromUser(const QString &expression,
-                                       const QHash<QString, QSharedPointer<VInternalVariable>> *vars, bool fromUser)
+auto Visualization::FindLengthFromUser(const QString &expression, const VInternalVariableHash *vars, bool fromUser)
     -> qreal
 {
     return VAbstractValApplication::VApp()->toPixel(FindValFromUser(expression, vars, fromUser));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-auto Visualization::FindValFromUser(const QString &expression,
-                                    const QHash<QString, QSharedPointer<VInternalVariable>> *vars, bool fromUser)
+auto Visualization::FindValFromUser(const QString &expression, const VInternalVariableHash *vars, bool fromUser)
     -> qreal
 {
     qreal val = 0;
@@ -37,6 +37,7 @@
 #include "../vgeometry/vabstractcurve.h"
 #include "../vmisc/def.h"
 #include "../vmisc/vabstractvalapplication.h"
+#include "../vpatterndb/variables/vinternalvariable.h"
 #include "../vwidgets/vcurvepathitem.h"
 #include "../vwidgets/vmaingraphicsscene.h"
 
@@ -45,7 +46,6 @@ Q_DECLARE_LOGGING_CATEGORY(vVis) // NOLINT
 class VScaledEllipse;
 class VScaledLine;
 class VContainer;
-class VInternalVariable;
 
 enum class Mode : qint8
 {
@@ -77,11 +77,9 @@ public:
     auto GetMode() const -> Mode;
     void SetMode(const Mode &value);
 
-    static auto FindLengthFromUser(const QString &expression,
-                                   const QHash<QString, QSharedPointer<VInternalVariable>> *vars, bool fromUser = true)
+    static auto FindLengthFromUser(const QString &expression, const VInternalVariableHash *vars, bool fromUser = true)
         -> qreal;
-    static auto FindValFromUser(const QString &expression,
-                                const QHash<QString, QSharedPointer<VInternalVariable>> *vars, bool fromUser = true)
+    static auto FindValFromUser(const QString &expression, const VInternalVariableHash *vars, bool fromUser = true)
         -> qreal;
     static auto CorrectAngle(qreal angle) -> qreal;
 
@@ -205,6 +205,72 @@ void TST_ValentinaCommandLine::TestMode()
     QVERIFY2(exit == exitCode, qUtf8Printable(error.right(350)));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IncrementalGradation check that switching size in batch export gives the same pieces as opening the pattern
+ * with this size.
+ *
+ * Batch export loads the pattern once and recalculates only tools that depend on changed measurements. Reference
+ * files are exported right after opening the pattern, which runs a full parse. issue_256_grading_170.vst holds the
+ * values of issue_256_grading.vst for height 170 as base values.
+ */
+// cppcheck-suppress unusedFunction
+void TST_ValentinaCommandLine::IncrementalGradation()
+{
+    const QString tmp = QCoreApplication::applicationDirPath() + QDir::separator() + *tmpTestFolder;
+    const QString pattern = tmp + QDir::separator() + "issue_256.val"_L1;
+    const QString batchDir = tmp + QDir::separator() + "gradation_batch"_L1;
+    const QString referenceDir = tmp + QDir::separator() + "gradation_reference"_L1;
+
+    QVERIFY(QDir().mkpath(batchDir));
+    QVERIFY(QDir().mkpath(referenceDir));
+
+    auto Export = [this, pattern, tmp](const QString &measurements, const QString &destination,
+                                       const QString &arguments, QString &error) -> int
+    {
+        const auto arg = QStringList() << pattern << u"-m;;%1;;--exportOnlyDetails;;-d;;%2;;%3"_s
+                                                          .arg(tmp + QDir::separator() + measurements, destination,
+                                                               arguments)
+                                                          .split(";;"_L1);
+        return Run(V_EX_OK, ValentinaPath(), arg, error);
+    };
+
+    QString error;
+    // Both sizes are reached by switching from the base size
+    QVERIFY2(Export(u"issue_256_grading.vst"_s, batchDir, u"-b;;output;;--dimensionAValues;;170-176"_s, error) ==
+                 V_EX_OK,
+             qUtf8Printable(error.right(350)));
+    QVERIFY2(Export(u"issue_256_grading.vst"_s, referenceDir, u"-b;;output_176"_s, error) == V_EX_OK,
+             qUtf8Printable(error.right(350)));
+    QVERIFY2(Export(u"issue_256_grading_170.vst"_s, referenceDir, u"-b;;output_170"_s, error) == V_EX_OK,
+             qUtf8Printable(error.right(350)));
+
+    auto ReadFile = [](const QString &path) -> QByteArray
+    {
+        QFile file(path);
+        if (not file.open(QIODevice::ReadOnly))
+        {
+            return {};
+        }
+        return file.readAll();
+    };
+
+    const QStringList references = QDir(referenceDir).entryList(QDir::Files, QDir::Name);
+    QVERIFY2(references.size() == 2, qUtf8Printable(references.join(", "_L1)));
+
+    // Guard against a test that passes because nothing changed
+    QVERIFY(ReadFile(referenceDir + QDir::separator() + references.at(0)) !=
+            ReadFile(referenceDir + QDir::separator() + references.at(1)));
+
+    for (const auto &name : references)
+    {
+        const QByteArray batch = ReadFile(batchDir + QDir::separator() + name);
+        QVERIFY2(not batch.isEmpty(), qUtf8Printable(u"Missing batch export file '%1'."_s.arg(name)));
+        QVERIFY2(batch == ReadFile(referenceDir + QDir::separator() + name),
+                 qUtf8Printable(u"File '%1' differs from the full parse."_s.arg(name)));
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_ValentinaCommandLine::TestOpenCollection_data() const
 {
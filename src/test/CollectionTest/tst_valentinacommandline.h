@@ -46,6 +46,7 @@ private slots:
     void ExportMode();
     void TestMode_data() const;
     void TestMode();
+    void IncrementalGradation();
     void TestOpenCollection_data() const;
     void TestOpenCollection();
     void cleanupTestCase();
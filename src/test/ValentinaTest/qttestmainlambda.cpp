@@ -39,6 +39,7 @@
 #include "tst_formulacache.h"
 #include "tst_misc.h"
 #include "tst_nameregexp.h"
+#include "tst_nestingbenchmark.h"
 #include "tst_qmutokenparser.h"
 #include "tst_readval.h"
 #include "tst_renametoken.h"
@@ -55,14 +56,23 @@
 #include "tst_vfoldline.h"
 #include "tst_vgobject.h"
 #include "tst_vlayoutdetail.h"
+#include "tst_vlayoutexporter.h"
+#include "tst_vlayoutgenerator.h"
 #include "tst_vlockguard.h"
 #include "tst_vmeasurements.h"
+#include "tst_vnofitpolygon.h"
+#include "tst_vpersistenthash.h"
 #include "tst_vpiece.h"
 #include "tst_vpointf.h"
+#include "tst_vpolygonintersection.h"
+#include "tst_vpositionsindex.h"
+#include "tst_vhpglpentravel.h"
 #include "tst_vposter.h"
 #include "tst_vspline.h"
 #include "tst_vsplinepath.h"
 #include "tst_vsvgpathtokenizer.h"
+#include "tst_vtextpathcache.h"
+#include "tst_vfileindexcache.h"
 #include "tst_vmaingraphicsscene.h"
 #include "tst_vtheme.h"
 #include "tst_vlabelarrangeengine.h"
@@ -131,11 +141,20 @@ auto main(int argc, char **argv) -> int
     ASSERT_TEST(new TST_FormulaCache());
     ASSERT_TEST(new TST_VPiece());
     ASSERT_TEST(new TST_VPoster());
+    ASSERT_TEST(new TST_VPositionsIndex());
+    ASSERT_TEST(new TST_VHPGLPenTravel());
+    ASSERT_TEST(new TST_VTextPathCache());
+    ASSERT_TEST(new TST_VPersistentHash());
+    ASSERT_TEST(new TST_VFileIndexCache());
+    ASSERT_TEST(new TST_VPolygonIntersection());
+    ASSERT_TEST(new TST_VNoFitPolygon());
     ASSERT_TEST(new TST_VAbstractPiece());
     ASSERT_TEST(new TST_VSpline());
     ASSERT_TEST(new TST_VSplinePath());
     ASSERT_TEST(new TST_NameRegExp());
     ASSERT_TEST(new TST_VLayoutDetail());
+    ASSERT_TEST(new TST_VLayoutGenerator());
+    ASSERT_TEST(new TST_VLayoutExporter());
     ASSERT_TEST(new TST_VFoldLine());
     ASSERT_TEST(new TST_VArc());
     ASSERT_TEST(new TST_VEllipticalArc());
@@ -174,6 +193,7 @@ auto main(int argc, char **argv) -> int
 #endif // QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
     ASSERT_TEST(new TST_VTheme());
     ASSERT_TEST(new TST_VMainGraphicsScene());
+    ASSERT_TEST(new TST_NestingBenchmark());
 
     return status;
 }
@@ -26,10 +26,140 @@
  **
  *************************************************************************/
 #include "tst_dxf.h"
+#include "../vdxf/vdxfpaintdevice.h"
+#include "../vlayout/vlayoutpiece.h"
+#include "../vlayout/vtextmanager.h"
+#include "../vmisc/def.h"
+
+#include <QFile>
+#include <QTemporaryDir>
 #include <QTest>
+#include <QtMath>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto TestPieces() -> QVector<VLayoutPiece>
+{
+    QVector<VLayoutPiece> pieces;
+    for (int i = 0; i < 3; ++i)
+    {
+        const qreal size = MmToPixel(100. + i * 10);
+        const qreal allowance = MmToPixel(10.);
+        const qreal margin = MmToPixel(10.);
+
+        VLayoutPiece piece;
+        piece.SetName(QStringLiteral("Piece %1").arg(i));
+        piece.SetContourPoints({VLayoutPoint(0, 0), VLayoutPoint(size, 0), VLayoutPoint(size, size),
+                                VLayoutPoint(0, size)});
+        piece.SetSeamAllowancePoints({VLayoutPoint(-allowance, -allowance), VLayoutPoint(size + allowance, -allowance),
+                                      VLayoutPoint(size + allowance, size + allowance),
+                                      VLayoutPoint(-allowance, size + allowance)});
+
+        TextLine title;
+        title.qsText = piece.GetName();
+        title.bold = true;
+        title.iFontSize = 2;
+
+        TextLine quantity;
+        quantity.qsText = QStringLiteral("Cut 2");
+        quantity.italic = true;
+
+        VTextManager label;
+        label.SetAllSourceLines({title, quantity});
+        piece.SetPieceLabelData(label);
+        piece.SetPieceLabelRect({QPointF(margin, margin), QPointF(size - margin, margin),
+                                 QPointF(size - margin, size / 2), QPointF(margin, size / 2)});
+
+        pieces.append(piece);
+    }
+    return pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto ExportPieces(const QString &fileName, DRW::Version version, bool astm, bool stream) -> bool
+{
+    VDxfPaintDevice generator;
+    generator.SetFileName(fileName);
+    generator.SetSize(QSize(qCeil(MmToPixel(500.)), qCeil(MmToPixel(500.))));
+    generator.SetResolution(PrintDPI);
+    generator.SetVersion(version);
+    generator.SetInsunits(VarInsunits::Millimeters);
+    generator.SetStreamBlocks(stream);
+
+    return astm ? generator.ExportToASTM(TestPieces()) : generator.ExportToAAMA(TestPieces());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadDxf reads an ASCII DXF file without the creation time, the only value that differs between two exports.
+ */
+auto ReadDxf(const QString &fileName) -> QByteArray
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return {};
+    }
+
+    QByteArray content;
+    int skip = 0;
+    while (not file.atEnd())
+    {
+        const QByteArray line = file.readLine();
+        if (skip > 0)
+        {
+            --skip;
+            continue;
+        }
+
+        if (line.trimmed() == "$TDCREATE")
+        {
+            skip = 2; // group code and value
+        }
+        content += line;
+    }
+    return content;
+}
+} // namespace
 
 //---------------------------------------------------------------------------------------------------------------------
 TST_DXF::TST_DXF(QObject *parent)
   : QObject(parent)
 {
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_DXF::StreamedBlocks_data() const
+{
+    QTest::addColumn<int>("version");
+    QTest::addColumn<bool>("astm");
+
+    QTest::newRow("AAMA R12") << static_cast<int>(DRW::AC1009) << false;
+    QTest::newRow("AAMA R2000") << static_cast<int>(DRW::AC1015) << false;
+    QTest::newRow("ASTM R12") << static_cast<int>(DRW::AC1009) << true;
+    QTest::newRow("ASTM R2000") << static_cast<int>(DRW::AC1015) << true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_DXF::StreamedBlocks() const
+{
+    QFETCH(int, version);
+    QFETCH(bool, astm);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QString streamedFile = dir.filePath(QStringLiteral("streamed.dxf"));
+    const QString collectedFile = dir.filePath(QStringLiteral("collected.dxf"));
+
+    QVERIFY(ExportPieces(streamedFile, static_cast<DRW::Version>(version), astm, true));
+    QVERIFY(ExportPieces(collectedFile, static_cast<DRW::Version>(version), astm, false));
+
+    const QByteArray streamed = ReadDxf(streamedFile);
+    const QByteArray collected = ReadDxf(collectedFile);
+
+    QVERIFY(not streamed.isEmpty());
+    QVERIFY2(streamed == collected, "Streamed blocks changed the output file.");
+}
@@ -39,6 +39,8 @@ public:
     ~TST_DXF() override = default;
 
 private slots:
+    void StreamedBlocks_data() const;
+    void StreamedBlocks() const;
 
 private:
     Q_DISABLE_COPY_MOVE(TST_DXF) // NOLINT
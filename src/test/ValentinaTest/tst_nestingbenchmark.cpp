@@ -0,0 +1,248 @@
+/************************************************************************
+ **
+ **  @file   tst_nestingbenchmark.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_nestingbenchmark.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+#include "../vlayout/vlayoutpoint.h"
+#include "../vmisc/def.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Fixed nesting settings. Change them only together with the corpus, otherwise reports become incomparable.
+constexpr qreal paperWidthMm = 1500;
+constexpr qreal paperHeightMm = 3000;
+constexpr qreal layoutWidthMm = 2;
+constexpr int nestingTimeMinutes = 5;
+
+struct VNestingCorpus
+{
+    QString name{};
+    QStringList folders{};
+    quint16 quantity{1};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// Seam allowance contours of real pieces from the test share folders.
+auto Corpus() -> QVector<VNestingCorpus>
+{
+    return {{.name = QStringLiteral("Jacket"),
+             .folders = {QStringLiteral("jacketv8"),
+                         QStringLiteral("women_jacket"),
+                         QStringLiteral("winter_coat"),
+                         QStringLiteral("hood_1"),
+                         QStringLiteral("full_seam_allowance_path_blazer_for_women_with_one_button_case_1"),
+                         QStringLiteral("Issue_767_Fabric_TopCollar"),
+                         QStringLiteral("DP_6")},
+             .quantity = 2},
+            {.name = QStringLiteral("Trousers"),
+             .folders = {QStringLiteral("full_seam_allowance_path_case_5"),
+                         QStringLiteral("smart_pattern_#58"),
+                         QStringLiteral("Issue_880_Detail"),
+                         QStringLiteral("Issue_687"),
+                         QStringLiteral("trousers_block"),
+                         QStringLiteral("panties_case1")},
+             .quantity = 2},
+            {.name = QStringLiteral("Small"),
+             .folders = {QStringLiteral("Issue_923_test1"),
+                         QStringLiteral("Issue_923_test2"),
+                         QStringLiteral("Issue_923_test3"),
+                         QStringLiteral("Issue_923_test4_4"),
+                         QStringLiteral("Issue_548_case3"),
+                         QStringLiteral("seamtest2"),
+                         QStringLiteral("smart_pattern_#112"),
+                         QStringLiteral("smart_pattern_#133")},
+             .quantity = 4}};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto EngineName(NestingEngine engine) -> QString
+{
+    return engine == NestingEngine::NoFitPolygon ? QStringLiteral("NoFitPolygon") : QStringLiteral("ContourSliding");
+}
+
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_NestingBenchmark::TST_NestingBenchmark(QObject *parent)
+  : AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief initTestCase the benchmark takes minutes. It runs only if VALENTINA_NESTING_BENCHMARK is set.
+ */
+void TST_NestingBenchmark::initTestCase() const
+{
+    if (qEnvironmentVariableIsEmpty("VALENTINA_NESTING_BENCHMARK"))
+    {
+        QSKIP("Set VALENTINA_NESTING_BENCHMARK to run the nesting benchmark.");
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_NestingBenchmark::Nesting_data() const
+{
+    QTest::addColumn<QString>("corpus");
+    QTest::addColumn<QStringList>("folders");
+    QTest::addColumn<int>("quantity");
+    QTest::addColumn<int>("engine");
+
+    const QVector<VNestingCorpus> corpus = Corpus();
+    for (const auto &item : corpus)
+    {
+        for (auto engine : {NestingEngine::ContourSliding, NestingEngine::NoFitPolygon})
+        {
+            QTest::newRow(qUtf8Printable(item.name + '/'_L1 + EngineName(engine)))
+                << item.name << item.folders << static_cast<int>(item.quantity) << static_cast<int>(engine);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Nesting runs the corpus through the layout generator with fixed settings and stores the numbers for the
+ * report.
+ *
+ * Multi-start mode is off, so every run does the same single greedy pass and the counters don't depend on the number
+ * of processor cores.
+ */
+void TST_NestingBenchmark::Nesting()
+{
+    QFETCH(QString, corpus);
+    QFETCH(QStringList, folders);
+    QFETCH(int, quantity);
+    QFETCH(int, engine);
+
+    QVector<VLayoutPiece> details;
+    details.reserve(folders.size());
+    vidtype id = 1;
+    for (const auto &folder : folders)
+    {
+        details.append(CorpusPiece(folder, static_cast<quint16>(quantity), id++));
+    }
+
+    VLayoutGenerator generator;
+    generator.SetDetails(details);
+    generator.SetLayoutWidth(ToPixel(layoutWidthMm, Unit::Mm));
+    generator.SetCaseType(Cases::CaseDesc);
+    generator.SetPaperWidth(ToPixel(paperWidthMm, Unit::Mm));
+    generator.SetPaperHeight(ToPixel(paperHeightMm, Unit::Mm));
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetNestingTime(nestingTimeMinutes);
+    generator.SetNestQuantity(true);
+    generator.SetRotate(true);
+    generator.SetRotationNumber(4);
+    generator.SetShift(-1); // Trigger first shift calulation
+    generator.SetNestingEngine(static_cast<NestingEngine>(engine));
+    generator.SetMultiStart(false);
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+
+    QBENCHMARK_ONCE
+    {
+        timer.start();
+        generator.Generate(timer, generator.GetNestingTimeMSecs());
+        elapsed = timer.elapsed();
+    }
+
+    QCOMPARE(generator.State(), LayoutErrors::NoError);
+    QVERIFY(generator.PapersCount() > 0);
+    QVERIFY(generator.PlacementsCount() > 0);
+
+    QJsonObject result;
+    result["corpus"_L1] = corpus;
+    result["engine"_L1] = EngineName(static_cast<NestingEngine>(engine));
+    result["pieces"_L1] = static_cast<int>(folders.size() * quantity);
+    result["wallTimeMs"_L1] = elapsed;
+    result["placements"_L1] = generator.PlacementsCount();
+    result["collisionChecks"_L1] = generator.CollisionChecksCount();
+    result["efficiency"_L1] = generator.LayoutEfficiency();
+    result["papers"_L1] = static_cast<qint64>(generator.PapersCount());
+    m_report.append(result);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief cleanupTestCase writes the report to the file VALENTINA_NESTING_REPORT points to, if it is set.
+ */
+void TST_NestingBenchmark::cleanupTestCase() const
+{
+    const QString reportPath = qEnvironmentVariable("VALENTINA_NESTING_REPORT");
+    if (reportPath.isEmpty() || m_report.isEmpty())
+    {
+        return;
+    }
+
+    QJsonObject settings;
+    settings["paperWidthMm"_L1] = paperWidthMm;
+    settings["paperHeightMm"_L1] = paperHeightMm;
+    settings["layoutWidthMm"_L1] = layoutWidthMm;
+    settings["rotationNumber"_L1] = 4;
+
+    QJsonObject report;
+    report["qtVersion"_L1] = QString::fromLatin1(qVersion());
+    report["threads"_L1] = QThread::idealThreadCount();
+    report["settings"_L1] = settings;
+    report["results"_L1] = m_report;
+
+    QFile file(reportPath);
+    QVERIFY2(file.open(QIODevice::WriteOnly | QIODevice::Truncate), qUtf8Printable(file.errorString()));
+    file.write(QJsonDocument(report).toJson());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto TST_NestingBenchmark::CorpusPiece(const QString &folder, quint16 quantity, vidtype id) -> VLayoutPiece
+{
+    const QVector<QPointF> points =
+        AbstractTest::VectorFromJson<QPointF>(QStringLiteral("://%1/output.json").arg(folder));
+
+    QVector<VLayoutPoint> contour;
+    contour.reserve(points.size());
+    for (const auto &point : points)
+    {
+        contour.append(VLayoutPoint(point));
+    }
+
+    VLayoutPiece piece;
+    piece.SetName(folder);
+    piece.SetId(id);
+    piece.SetContourPoints(contour);
+    piece.SetQuantity(quantity);
+    return piece;
+}
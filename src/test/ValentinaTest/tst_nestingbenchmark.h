@@ -0,0 +1,58 @@
+/************************************************************************
+ **
+ **  @file   tst_nestingbenchmark.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#ifndef TST_NESTINGBENCHMARK_H
+#define TST_NESTINGBENCHMARK_H
+
+#include <QJsonArray>
+
+#include "../vtest/abstracttest.h"
+
+class VLayoutPiece;
+
+class TST_NestingBenchmark : public AbstractTest
+{
+    Q_OBJECT // NOLINT
+
+public:
+    explicit TST_NestingBenchmark(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase() const;
+    void Nesting_data() const;
+    void Nesting();
+    void cleanupTestCase() const;
+
+private:
+    Q_DISABLE_COPY_MOVE(TST_NestingBenchmark) // NOLINT
+
+    QJsonArray m_report{};
+
+    static auto CorpusPiece(const QString &folder, quint16 quantity, vidtype id) -> VLayoutPiece;
+};
+
+#endif // TST_NESTINGBENCHMARK_H
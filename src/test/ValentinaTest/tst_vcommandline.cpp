@@ -30,6 +30,7 @@
 #include "../vmisc/commandoptions.h"
 
 #include <QtTest>
+#include <limits>
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 4, 0)
 #include "../vmisc/compatibility.h"
@@ -37,6 +38,8 @@
 
 using namespace Qt::Literals::StringLiterals;
 
+using DimensionRanges = QVector<QPair<int, int>>;
+
 //---------------------------------------------------------------------------------------------------------------------
 TST_VCommandLine::TST_VCommandLine(QObject *parent)
   : QObject(parent)
@@ -58,3 +61,42 @@ void TST_VCommandLine::UniqueKeys()
         unique.insert(str);
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VCommandLine::DimensionValues_data()
+{
+    QTest::addColumn<QString>("list");
+    QTest::addColumn<bool>("valid");
+    QTest::addColumn<DimensionRanges>("ranges");
+
+    const int max = std::numeric_limits<int>::max();
+
+    QTest::newRow("Single value") << u"40"_s << true << DimensionRanges{qMakePair(40, 40)};
+    QTest::newRow("Range") << u"44-50"_s << true << DimensionRanges{qMakePair(44, 50)};
+    QTest::newRow("Values and ranges") << u"40, 44-50,52"_s << true
+                                       << DimensionRanges{qMakePair(40, 40), qMakePair(44, 50), qMakePair(52, 52)};
+    QTest::newRow("All") << u"all"_s << true << DimensionRanges{qMakePair(1, max)};
+    QTest::newRow("Empty items") << u"40,,42,"_s << true << DimensionRanges{qMakePair(40, 40), qMakePair(42, 42)};
+    QTest::newRow("Empty list") << QString() << false << DimensionRanges();
+    QTest::newRow("Only commas") << u",,"_s << false << DimensionRanges();
+    QTest::newRow("Not a number") << u"40,abc"_s << false << DimensionRanges();
+    QTest::newRow("Zero") << u"0"_s << false << DimensionRanges();
+    QTest::newRow("Reversed range") << u"50-44"_s << false << DimensionRanges();
+    QTest::newRow("Open range") << u"44-"_s << false << DimensionRanges();
+    QTest::newRow("Too many bounds") << u"40-44-50"_s << false << DimensionRanges();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VCommandLine::DimensionValues()
+{
+    QFETCH(QString, list);
+    QFETCH(bool, valid);
+    QFETCH(DimensionRanges, ranges);
+
+    bool ok = false;
+    const DimensionRanges result = ParseDimensionValues(list, &ok);
+
+    QCOMPARE(ok, valid);
+    QVERIFY(result == ranges);
+}
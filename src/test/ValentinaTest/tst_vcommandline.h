@@ -40,6 +40,8 @@ public:
 
 private slots:
     void UniqueKeys();
+    void DimensionValues_data();
+    void DimensionValues();
 
 private:
     Q_DISABLE_COPY_MOVE(TST_VCommandLine) // NOLINT
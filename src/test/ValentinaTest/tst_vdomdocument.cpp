@@ -35,6 +35,8 @@
 #include <QFile>
 #include <QTemporaryDir>
 #include <QTest>
+#include <array>
+#include <thread>
 
 //---------------------------------------------------------------------------------------------------------------------
 TST_VDomDocument::TST_VDomDocument(QObject *parent)
@@ -81,6 +83,46 @@ void TST_VDomDocument::RejectInvalidDataAgainstSchema() const
     QVERIFY2(not error.isEmpty(), "Failed validation did not report an error.");
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Compiled schemas are shared between threads. Every thread must get the same verdict as a single validation.
+void TST_VDomDocument::ValidateConcurrently() const
+{
+    const auto invalid = QByteArrayLiteral("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<notapattern/>\n");
+
+    QString expectedError;
+    QVERIFY(not VDomDocument::ValidateXMLData(VPatternConverter::CurrentSchema, invalid, QStringLiteral("test"),
+                                              expectedError));
+
+    constexpr int threadsCount = 8;
+    std::array<QString, threadsCount> errors{};
+    std::array<bool, threadsCount> results{};
+    results.fill(true);
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount);
+
+    for (int i = 0; i < threadsCount; ++i)
+    {
+        threads.emplace_back(
+            [&invalid, &errors, &results, i]()
+            {
+                const auto index = static_cast<size_t>(i);
+                results[index] = VDomDocument::ValidateXMLData(VPatternConverter::CurrentSchema, invalid,
+                                                               QStringLiteral("test"), errors[index]);
+            });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < threadsCount; ++i)
+    {
+        QVERIFY(not results.at(static_cast<size_t>(i)));
+        QCOMPARE(errors.at(static_cast<size_t>(i)), expectedError);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VDomDocument::TestUniqueId_data() const
 {
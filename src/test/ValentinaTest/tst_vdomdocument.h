@@ -42,6 +42,7 @@ public:
 private slots:
     void RefuseEmptyDocumentSave() const;
     void RejectInvalidDataAgainstSchema() const;
+    void ValidateConcurrently() const;
     void TestUniqueId_data() const;
     void TestUniqueId() const;
     void FindElementByIdStepsOverNonElementNodes();
@@ -0,0 +1,167 @@
+/************************************************************************
+ **
+ **  @file   tst_vfileindexcache.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vfileindexcache.h"
+#include "../vmisc/vfileindexcache.h"
+
+#include <QAtomicInteger>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+void WriteFile(const QString &path, const QByteArray &content)
+{
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write(content);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Record is the file content. Files starting with "bad" are invalid.
+auto CountingParser(QAtomicInteger<int> &calls) -> VFileIndexCache::Parser
+{
+    return [&calls](const QString &filePath, QByteArray &record) -> bool
+    {
+        ++calls;
+        QFile file(filePath);
+        if (not file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+        record = file.readAll();
+        return not record.startsWith("bad");
+    };
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VFileIndexCache::TST_VFileIndexCache(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VFileIndexCache::ReuseUnchanged() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QDir(dir.path()).mkdir(QStringLiteral("sub"));
+    WriteFile(dir.filePath(QStringLiteral("a.vkm")), "a");
+    WriteFile(dir.filePath(QStringLiteral("sub/b.vkm")), "b");
+    WriteFile(dir.filePath(QStringLiteral("c.txt")), "c");
+
+    const QString indexPath = dir.filePath(QStringLiteral("index/test.idx"));
+    QAtomicInteger<int> calls{0};
+
+    VFileIndexCache first(indexPath, 1);
+    const QMap<QString, QByteArray> records = first.Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls));
+    QCOMPARE(records.size(), 2);
+    QCOMPARE(records.value(dir.filePath(QStringLiteral("sub/b.vkm"))), QByteArray("b"));
+    QCOMPARE(first.ParsedCount(), static_cast<vsizetype>(2));
+    QCOMPARE(calls.loadRelaxed(), 2);
+    QVERIFY(QFile::exists(indexPath));
+
+    VFileIndexCache second(indexPath, 1);
+    QCOMPARE(second.Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls)), records);
+    QCOMPARE(second.ReusedCount(), static_cast<vsizetype>(2));
+    QCOMPARE(second.ParsedCount(), static_cast<vsizetype>(0));
+    QCOMPARE(calls.loadRelaxed(), 2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VFileIndexCache::RescanChanged() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    WriteFile(dir.filePath(QStringLiteral("a.vkm")), "a");
+    WriteFile(dir.filePath(QStringLiteral("b.vkm")), "b");
+
+    const QString indexPath = dir.filePath(QStringLiteral("test.idx"));
+    QAtomicInteger<int> calls{0};
+
+    VFileIndexCache(indexPath, 1).Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls));
+
+    // Other size, so the change is visible even with a coarse modification time
+    WriteFile(dir.filePath(QStringLiteral("a.vkm")), "changed");
+    QVERIFY(QFile::remove(dir.filePath(QStringLiteral("b.vkm"))));
+    WriteFile(dir.filePath(QStringLiteral("c.vkm")), "c");
+
+    VFileIndexCache index(indexPath, 1);
+    const QMap<QString, QByteArray> records = index.Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls));
+    QCOMPARE(index.ParsedCount(), static_cast<vsizetype>(2));
+    QCOMPARE(index.ReusedCount(), static_cast<vsizetype>(0));
+    QCOMPARE(records.size(), 2);
+    QCOMPARE(records.value(dir.filePath(QStringLiteral("a.vkm"))), QByteArray("changed"));
+    QVERIFY(not records.contains(dir.filePath(QStringLiteral("b.vkm"))));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VFileIndexCache::RememberInvalid() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    WriteFile(dir.filePath(QStringLiteral("a.vkm")), "a");
+    WriteFile(dir.filePath(QStringLiteral("broken.vkm")), "bad");
+
+    const QString indexPath = dir.filePath(QStringLiteral("test.idx"));
+    QAtomicInteger<int> calls{0};
+
+    QCOMPARE(VFileIndexCache(indexPath, 1).Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls)).size(),
+             1);
+    QCOMPARE(VFileIndexCache(indexPath, 1).Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls)).size(),
+             1);
+    QCOMPARE(calls.loadRelaxed(), 2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VFileIndexCache::OutdatedIndex() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    WriteFile(dir.filePath(QStringLiteral("a.vkm")), "a");
+
+    const QString indexPath = dir.filePath(QStringLiteral("test.idx"));
+    QAtomicInteger<int> calls{0};
+
+    VFileIndexCache(indexPath, 1).Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls));
+
+    // New record format drops the whole index
+    VFileIndexCache index(indexPath, 2);
+    index.Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls));
+    QCOMPARE(index.ParsedCount(), static_cast<vsizetype>(1));
+
+    // Garbage in place of the index is ignored
+    WriteFile(indexPath, "garbage");
+    VFileIndexCache corrupted(indexPath, 2);
+    QCOMPARE(corrupted.Scan(dir.path(), {QStringLiteral("*.vkm")}, CountingParser(calls)).size(), 1);
+    QCOMPARE(corrupted.ParsedCount(), static_cast<vsizetype>(1));
+    QCOMPARE(calls.loadRelaxed(), 3);
+}
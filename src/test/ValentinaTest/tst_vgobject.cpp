@@ -28,11 +28,50 @@
 
 #include "tst_vgobject.h"
 
+#include <QBuffer>
+#include <QPainter>
+#include <QPdfWriter>
 #include <QtTest>
 
 #include "../vgeometry/vgobject.h"
 #include "../vmisc/def.h"
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto PathPoints(const QPainterPath &path) -> QVector<QPointF>
+{
+    QVector<QPointF> points;
+    points.reserve(path.elementCount());
+    for (int i = 0; i < path.elementCount(); ++i)
+    {
+        points.append(path.elementAt(i));
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Size of a PDF page that shows one tile of the path, like a page of a tiled export.
+auto TilePdfSize(const QPainterPath &path, const QRectF &tile) -> qint64
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    QPdfWriter writer(&buffer);
+    writer.setResolution(72);
+    writer.setPageSize(QPageSize(tile.size(), QPageSize::Point));
+    writer.setPageMargins(QMarginsF());
+
+    QPainter painter(&writer);
+    painter.setClipRect(QRectF(QPointF(), tile.size()));
+    painter.translate(-tile.topLeft());
+    painter.drawPath(path);
+    painter.end();
+
+    return buffer.size();
+}
+} // namespace
+
 //---------------------------------------------------------------------------------------------------------------------
 TST_VGObject::TST_VGObject(QObject *parent)
     :QObject(parent)
@@ -154,3 +193,63 @@ void TST_VGObject::TestIsPointOnLineviaPDP() const
     QCOMPARE(res, excpect);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VGObject::TestClipPathToRect_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("polyline");
+    QTest::addColumn<QVector<QPointF>>("expect");
+
+    QTest::newRow("Inside") << QVector<QPointF>{QPointF(2, 2), QPointF(8, 8)}
+                            << QVector<QPointF>{QPointF(2, 2), QPointF(8, 8)};
+    QTest::newRow("Outside") << QVector<QPointF>{QPointF(20, 2), QPointF(30, 8)} << QVector<QPointF>();
+    QTest::newRow("Horizontal line crosses the rect") << QVector<QPointF>{QPointF(-10, 5), QPointF(20, 5)}
+                                                      << QVector<QPointF>{QPointF(0, 5), QPointF(10, 5)};
+    QTest::newRow("Leaves and comes back")
+        << QVector<QPointF>{QPointF(5, 5), QPointF(15, 5), QPointF(15, 8), QPointF(5, 8)}
+        << QVector<QPointF>{QPointF(5, 5), QPointF(10, 5), QPointF(10, 8), QPointF(5, 8)};
+    QTest::newRow("Open polyline leaves the rect") << QVector<QPointF>{QPointF(2, 2), QPointF(8, 2), QPointF(8, 20)}
+                                                   << QVector<QPointF>{QPointF(2, 2), QPointF(8, 2), QPointF(8, 10)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VGObject::TestClipPathToRect() const
+{
+    QFETCH(QVector<QPointF>, polyline);
+    QFETCH(QVector<QPointF>, expect);
+
+    QPainterPath path;
+    path.addPolygon(QPolygonF(polyline));
+
+    const QPainterPath clipped = VGObject::ClipPathToRect(path, QRectF(0, 0, 10, 10));
+    QCOMPARE(PathPoints(clipped), expect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VGObject::TestClipPathToRectPdfSize() const
+{
+    // Long contour over 2x2 tiles, each page of a tiled export shows one tile
+    QPainterPath path;
+    path.moveTo(0, 500);
+    for (int i = 1; i <= 4000; ++i)
+    {
+        const qreal x = i / 2.;
+        path.lineTo(x, 1000 + 900 * qSin(x / 37.) * qCos(x / 113.));
+    }
+    path.closeSubpath();
+
+    const QVector<QRectF> tiles{QRectF(0, 0, 1000, 1000), QRectF(1000, 0, 1000, 1000), QRectF(0, 1000, 1000, 1000),
+                                QRectF(1000, 1000, 1000, 1000)};
+
+    qint64 fullSize = 0;
+    qint64 clippedSize = 0;
+    for (const auto &tile : tiles)
+    {
+        fullSize += TilePdfSize(path, tile);
+        clippedSize += TilePdfSize(VGObject::ClipPathToRect(path, tile), tile);
+    }
+
+    qInfo() << "Tiled PDF size, whole path on each page:" << fullSize << "bytes, clipped to tiles:" << clippedSize
+            << "bytes";
+    QVERIFY2(clippedSize * 2 < fullSize, "Tile pages must not contain geometry of the whole path.");
+}
+
@@ -40,6 +40,9 @@ public:
 private slots:
     void TestIsPointOnLineviaPDP_data();
     void TestIsPointOnLineviaPDP() const;
+    void TestClipPathToRect_data() const;
+    void TestClipPathToRect() const;
+    void TestClipPathToRectPdfSize() const;
 };
 
 #endif // TST_VGOBJECT_H
@@ -0,0 +1,161 @@
+/************************************************************************
+ **
+ **  @file   tst_vhpglpentravel.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vhpglpentravel.h"
+#include "../vhpgl/vhpglpentravel.h"
+
+#include <QRandomGenerator>
+#include <QtTest>
+#include <algorithm>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto Stroke(const QVector<QPoint> &points, const QString &mnemonic = QString()) -> VHPGLStroke
+{
+    VHPGLStroke stroke;
+    stroke.points = points;
+    stroke.mnemonic = mnemonic;
+    return stroke;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Key(const VHPGLStroke &stroke) -> QString
+{
+    QVector<QPoint> points = stroke.points;
+    if (points.size() > 1 && (points.constLast().x() < points.constFirst().x() ||
+                              (points.constLast().x() == points.constFirst().x() &&
+                               points.constLast().y() < points.constFirst().y())))
+    {
+        std::reverse(points.begin(), points.end());
+    }
+
+    QString key = stroke.mnemonic;
+    for (const auto &p : points)
+    {
+        key += QStringLiteral(" %1,%2").arg(p.x()).arg(p.y());
+    }
+    return key;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// The same strokes regardless of order and direction
+auto SameStrokes(const QVector<VHPGLStroke> &s1, const QVector<VHPGLStroke> &s2) -> bool
+{
+    QStringList keys1;
+    for (const auto &stroke : s1)
+    {
+        keys1.append(Key(stroke));
+    }
+
+    QStringList keys2;
+    for (const auto &stroke : s2)
+    {
+        keys2.append(Key(stroke));
+    }
+
+    keys1.sort();
+    keys2.sort();
+    return keys1 == keys2;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VHPGLPenTravel::TST_VHPGLPenTravel(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VHPGLPenTravel::Travel() const
+{
+    const QVector<VHPGLStroke> strokes{Stroke({QPoint(0, 100), QPoint(100, 100)}),
+                                       Stroke({QPoint(100, 400)}, QStringLiteral("CI"))};
+
+    QCOMPARE(VHPGLPenTravel::Travel(strokes, QPoint()), 400.);
+    QCOMPARE(VHPGLPenTravel::Travel({}, QPoint()), 0.);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VHPGLPenTravel::ReverseStrokes() const
+{
+    // Segments of one line in a mixed order, half of them backwards
+    const QVector<VHPGLStroke> strokes{
+        Stroke({QPoint(300, 0), QPoint(400, 0)}), Stroke({QPoint(100, 0), QPoint(0, 0)}),
+        Stroke({QPoint(500, 0), QPoint(600, 0)}), Stroke({QPoint(200, 0), QPoint(100, 0)}),
+        Stroke({QPoint(400, 0), QPoint(500, 0)}), Stroke({QPoint(300, 0), QPoint(200, 0)})};
+
+    const QVector<VHPGLStroke> optimized = VHPGLPenTravel::Optimize(strokes, QPoint());
+
+    QVERIFY(SameStrokes(strokes, optimized));
+    QCOMPARE(VHPGLPenTravel::Travel(optimized, QPoint()), 0.);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VHPGLPenTravel::KeepFixedDirection() const
+{
+    // A path that ends with an extra command cannot be plotted backwards
+    const VHPGLStroke fixed = Stroke({QPoint(1000, 0), QPoint(0, 0)}, QStringLiteral("PD"));
+    const QVector<VHPGLStroke> strokes{Stroke({QPoint(500, 500), QPoint(600, 500)}), fixed};
+
+    const QVector<VHPGLStroke> optimized = VHPGLPenTravel::Optimize(strokes, QPoint());
+
+    QCOMPARE(optimized.size(), strokes.size());
+    const auto it = std::find_if(optimized.cbegin(), optimized.cend(),
+                                 [](const VHPGLStroke &stroke) { return not stroke.mnemonic.isEmpty(); });
+    QVERIFY(it != optimized.cend());
+    QCOMPARE(it->points, fixed.points);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VHPGLPenTravel::RandomMarker() const
+{
+    // Fixed seed keeps the test reproducible
+    QRandomGenerator generator(2718);
+
+    QVector<VHPGLStroke> strokes;
+    for (int i = 0; i < 400; ++i)
+    {
+        const QPoint start(generator.bounded(40000), generator.bounded(8000));
+        const QPoint end = start + QPoint(generator.bounded(-400, 400), generator.bounded(-400, 400));
+        strokes.append(Stroke({start, end}));
+    }
+
+    const qreal before = VHPGLPenTravel::Travel(strokes, QPoint());
+
+    QVector<VHPGLStroke> optimized;
+    QBENCHMARK
+    {
+        optimized = VHPGLPenTravel::Optimize(strokes, QPoint());
+    }
+
+    const qreal after = VHPGLPenTravel::Travel(optimized, QPoint());
+
+    QVERIFY(SameStrokes(strokes, optimized));
+    QVERIFY2(after < before / 5,
+             qUtf8Printable(QStringLiteral("Pen up travel %1, optimized %2.").arg(before).arg(after)));
+}
@@ -28,9 +28,32 @@
 
 #include "tst_vlayoutdetail.h"
 #include "../vlayout/vlayoutpiece.h"
+#include "../vlayout/vlayoutpointarray.h"
+#include "../vlayout/vrawlayout.h"
 
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
 #include <QtDebug>
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto RawLayoutTestData() -> VRawLayoutData
+{
+    VRawLayoutData data;
+    for (int i = 0; i < 5; ++i)
+    {
+        VLayoutPiece piece;
+        piece.SetName(QStringLiteral("Piece %1").arg(i));
+        piece.SetContourPoints({VLayoutPoint(0, 0), VLayoutPoint(100 + i, 0), VLayoutPoint(100 + i, 100)});
+        data.pieces.append(piece);
+    }
+    return data;
+}
+} // namespace
+
 //---------------------------------------------------------------------------------------------------------------------
 TST_VLayoutDetail::TST_VLayoutDetail(QObject *parent)
   : AbstractTest(parent)
@@ -50,6 +73,196 @@ void TST_VLayoutDetail::RemoveDublicates() const
     Case3();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutDetail::MappedGeometryCache() const
+{
+    VLayoutPiece::ResetMappedCacheCounters();
+
+    VLayoutPiece det;
+    det.SetContourPoints({VLayoutPoint(0, 0), VLayoutPoint(100, 0), VLayoutPoint(100, 100), VLayoutPoint(0, 100)});
+
+    const QVector<VLayoutPoint> points = det.GetMappedContourPoints();
+    QCOMPARE(VLayoutPiece::MappedCacheMisses(), Q_UINT64_C(1));
+    QCOMPARE(det.GetMappedContourPoints(), points);
+    QCOMPARE(VLayoutPiece::MappedCacheHits(), Q_UINT64_C(1));
+
+    // Changing the transformation must drop the cached points
+    det.Translate(10, 20);
+    QCOMPARE(static_cast<QPointF>(det.GetMappedContourPoints().constFirst()), QPointF(10, 20));
+    QCOMPARE(VLayoutPiece::MappedCacheMisses(), Q_UINT64_C(2));
+
+    // A copy moved on its own must not touch the original cache
+    VLayoutPiece copy = det;
+    copy.Translate(5, 0);
+    QCOMPARE(static_cast<QPointF>(det.GetMappedContourPoints().constFirst()), QPointF(10, 20));
+    QCOMPARE(VLayoutPiece::MappedCacheHits(), Q_UINT64_C(2));
+    QCOMPARE(static_cast<QPointF>(copy.GetMappedContourPoints().constFirst()), QPointF(15, 20));
+    QCOMPARE(VLayoutPiece::MappedCacheMisses(), Q_UINT64_C(3));
+
+    const QRectF rect = det.MappedDetailBoundingRect();
+    QCOMPARE(rect, QRectF(10, 20, 100, 100));
+    const quint64 misses = VLayoutPiece::MappedCacheMisses();
+    QCOMPARE(det.MappedDetailBoundingRect(), rect);
+    QCOMPARE(VLayoutPiece::MappedCacheMisses(), misses);
+    QCOMPARE(VLayoutPiece::MappedCacheHits(), Q_UINT64_C(3));
+
+    // Setting the same matrix keeps the cache
+    det.SetMatrix(det.GetMatrix());
+    QCOMPARE(det.MappedDetailBoundingRect(), rect);
+    QCOMPARE(VLayoutPiece::MappedCacheHits(), Q_UINT64_C(4));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutDetail::PointArrayMapping() const
+{
+    QVector<VLayoutPoint> points{VLayoutPoint(0, 0), VLayoutPoint(120, 10), VLayoutPoint(90, 80), VLayoutPoint(5, 60)};
+    points[1].SetTurnPoint(true);
+    points[2].SetCurvePoint(true);
+
+    const VLayoutPointArray array(points);
+    QCOMPARE(array.Size(), points.size());
+
+    QTransform matrix;
+    matrix.translate(15, -40);
+    matrix.rotate(33);
+    matrix.scale(1.5, 1.5);
+
+    for (bool mirror : {false, true})
+    {
+        const QVector<VLayoutPoint> expected = VAbstractPiece::MapVector(points, matrix, mirror);
+        const QVector<VLayoutPoint> mapped = array.MappedLayoutPoints(matrix, mirror);
+
+        QCOMPARE(mapped.size(), expected.size());
+        for (int i = 0; i < expected.size(); ++i)
+        {
+            QCOMPARE(static_cast<QPointF>(mapped.at(i)), static_cast<QPointF>(expected.at(i)));
+            QCOMPARE(mapped.at(i).TurnPoint(), expected.at(i).TurnPoint());
+            QCOMPARE(mapped.at(i).CurvePoint(), expected.at(i).CurvePoint());
+        }
+
+        const QLineF edge = array.MappedEdge(1, 2, matrix, mirror);
+        QCOMPARE(edge, QLineF(expected.at(1), expected.at(2)));
+        QCOMPARE(array.MappedIndexOf(expected.at(2), matrix, mirror), static_cast<vsizetype>(2));
+    }
+
+    QVector<QPointF> mappedPoints;
+    CastTo(VAbstractPiece::MapVector(points, matrix), mappedPoints);
+    QCOMPARE(array.MappedBoundingRect(matrix), VLayoutPiece::BoundingRect(mappedPoints));
+    QCOMPARE(array.MappedIndexOf(QPointF(-1000, -1000), matrix, false), static_cast<vsizetype>(-1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutDetail::RawLayoutPieceIndex() const
+{
+    const VRawLayoutData data = RawLayoutTestData();
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("layout.rld"));
+
+    VRawLayout writer;
+    QVERIFY2(writer.WriteFile(fileName, data), qUtf8Printable(writer.ErrorString()));
+
+    VMappedRawLayout mapped(fileName);
+    QVERIFY2(mapped.Open(), qUtf8Printable(mapped.ErrorString()));
+    QCOMPARE(mapped.PieceCount(), data.pieces.size());
+
+    // Random access in reverse order
+    for (vsizetype i = data.pieces.size() - 1; i >= 0; --i)
+    {
+        VLayoutPiece piece;
+        QVERIFY2(mapped.Piece(i, piece), qUtf8Printable(mapped.ErrorString()));
+        QCOMPARE(piece.GetName(), data.pieces.at(i).GetName());
+        QCOMPARE(piece.GetContourPoints(), data.pieces.at(i).GetContourPoints());
+    }
+
+    VLayoutPiece piece;
+    QVERIFY(not mapped.Piece(data.pieces.size(), piece));
+
+    // Sequential reading of the same file
+    VRawLayout reader;
+    VRawLayoutData readData;
+    QVERIFY2(reader.ReadFile(fileName, readData), qUtf8Printable(reader.ErrorString()));
+    QCOMPARE(readData.pieces.size(), data.pieces.size());
+    QCOMPARE(readData.pieces.constLast().GetName(), data.pieces.constLast().GetName());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutDetail::RawLayoutFirstVersion() const
+{
+    const VRawLayoutData data = RawLayoutTestData();
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("layout.rld"));
+
+    {
+        // The first format version has no piece index
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QDataStream dataStream(&file);
+        dataStream.setVersion(QDataStream::Qt_5_15);
+        dataStream.writeRawData("RLD!...", 7);
+        dataStream << static_cast<quint16>(1) << data;
+    }
+
+    VMappedRawLayout mapped(fileName);
+    QVERIFY2(mapped.Open(), qUtf8Printable(mapped.ErrorString()));
+    QCOMPARE(mapped.PieceCount(), data.pieces.size());
+
+    for (vsizetype i = 0; i < data.pieces.size(); ++i)
+    {
+        VLayoutPiece piece;
+        QVERIFY2(mapped.Piece(i, piece), qUtf8Printable(mapped.ErrorString()));
+        QCOMPARE(piece.GetName(), data.pieces.at(i).GetName());
+        QCOMPARE(piece.GetContourPoints(), data.pieces.at(i).GetContourPoints());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutDetail::RawLayoutCorruptedIndex() const
+{
+    const VRawLayoutData data = RawLayoutTestData();
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("layout.rld"));
+
+    VRawLayout writer;
+    QVERIFY2(writer.WriteFile(fileName, data), qUtf8Printable(writer.ErrorString()));
+    const qint64 size = QFileInfo(fileName).size();
+
+    // The last piece is cut. The index is intact, but the piece cannot be decoded.
+    QVERIFY(QFile::resize(fileName, size - 1));
+    {
+        VMappedRawLayout mapped(fileName);
+        QVERIFY2(mapped.Open(), qUtf8Printable(mapped.ErrorString()));
+        QCOMPARE(mapped.PieceCount(), data.pieces.size());
+
+        VLayoutPiece piece;
+        QVERIFY2(mapped.Piece(0, piece), qUtf8Printable(mapped.ErrorString()));
+        QVERIFY(not mapped.Piece(data.pieces.size() - 1, piece));
+    }
+
+    // Offsets of the last pieces point outside of the file
+    QVERIFY(QFile::resize(fileName, size / 2));
+    {
+        VMappedRawLayout mapped(fileName);
+        QVERIFY(not mapped.Open());
+    }
+
+    // The file ends inside the index
+    QVERIFY(QFile::resize(fileName, 24));
+    {
+        VMappedRawLayout mapped(fileName);
+        QVERIFY(not mapped.Open());
+
+        VRawLayout reader;
+        VRawLayoutData readData;
+        QVERIFY(not reader.ReadFile(fileName, readData));
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VLayoutDetail::Case1() const
 {
@@ -39,6 +39,11 @@ public:
 
 private slots:
     void RemoveDublicates() const;
+    void MappedGeometryCache() const;
+    void PointArrayMapping() const;
+    void RawLayoutPieceIndex() const;
+    void RawLayoutFirstVersion() const;
+    void RawLayoutCorruptedIndex() const;
 
 private:
     void Case1() const;
@@ -0,0 +1,123 @@
+/************************************************************************
+ **
+ **  @file   tst_vlayoutexporter.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vlayoutexporter.h"
+#include "../vlayout/vlayoutexporter.h"
+
+#include <QGraphicsEllipseItem>
+#include <QGraphicsPathItem>
+#include <QGraphicsRectItem>
+#include <QGraphicsScene>
+#include <QImage>
+#include <QPainter>
+#include <QPainterPath>
+#include <QTemporaryDir>
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Biggest difference of a color channel between two images of the same size
+auto MaxPixelDifference(const QImage &image1, const QImage &image2) -> int
+{
+    int difference = 0;
+    for (int y = 0; y < image1.height(); ++y)
+    {
+        const auto *line1 = reinterpret_cast<const QRgb *>(image1.constScanLine(y));
+        const auto *line2 = reinterpret_cast<const QRgb *>(image2.constScanLine(y));
+        for (int x = 0; x < image1.width(); ++x)
+        {
+            difference = qMax(difference, qAbs(qRed(line1[x]) - qRed(line2[x])));
+            difference = qMax(difference, qAbs(qGreen(line1[x]) - qGreen(line2[x])));
+            difference = qMax(difference, qAbs(qBlue(line1[x]) - qBlue(line2[x])));
+            difference = qMax(difference, qAbs(qAlpha(line1[x]) - qAlpha(line2[x])));
+        }
+    }
+    return difference;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLayoutExporter::TST_VLayoutExporter(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutExporter::RenderImage() const
+{
+    // The sheet is high enough to be split in several bands. Shapes cross the borders of the bands.
+    QGraphicsScene scene;
+    scene.addRect(QRectF(20, 20, 240, 2560), QPen(Qt::black, 3));
+    scene.addEllipse(QRectF(40, 900, 200, 260), QPen(Qt::red, 2), QBrush(Qt::yellow));
+    scene.addEllipse(QRectF(60, 1950, 160, 200), QPen(Qt::blue, 5));
+
+    QPainterPath path;
+    path.moveTo(30, 30);
+    for (int i = 1; i <= 50; ++i)
+    {
+        path.lineTo(i % 2 == 0 ? 30 : 250, 30 + i * 50.7);
+    }
+    scene.addPath(path, QPen(Qt::darkGreen, 1.5));
+
+    const QRectF imageRect(0, 0, 280, 2600);
+    const QMarginsF margins(10, 15, 10, 15);
+    const qreal scale = 1.25;
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("sheet.png"));
+
+    VLayoutExporter exporter;
+    exporter.SetFileName(fileName);
+    exporter.SetImageRect(imageRect);
+    exporter.SetMargins(margins);
+    exporter.SetXScale(scale);
+    exporter.SetYScale(scale);
+    exporter.ExportToPNG(&scene, {});
+
+    const QImage exported = QImage(fileName).convertToFormat(QImage::Format_ARGB32);
+    QVERIFY(not exported.isNull());
+
+    // Reference is the whole scene rendered at once
+    QImage reference(qFloor(imageRect.width() * scale + margins.left() + margins.right()),
+                     qFloor(imageRect.height() * scale + margins.top() + margins.bottom()), QImage::Format_ARGB32);
+    reference.fill(Qt::white);
+
+    QPainter painter(&reference);
+    painter.translate(margins.left(), margins.top());
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setPen(exporter.Pen());
+    painter.setBrush(QBrush(Qt::NoBrush));
+    painter.scale(scale, scale);
+    scene.render(&painter, imageRect, imageRect, Qt::IgnoreAspectRatio);
+    painter.end();
+
+    QCOMPARE(exported.size(), reference.size());
+    QVERIFY2(MaxPixelDifference(exported, reference) <= 1, "Rendering in bands must not change the image.");
+}
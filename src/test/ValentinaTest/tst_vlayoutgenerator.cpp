@@ -0,0 +1,238 @@
+/************************************************************************
+ **
+ **  @file   tst_vlayoutgenerator.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vlayoutgenerator.h"
+#include "../vgeometry/vpolygonintersection.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+#include "../vlayout/vlayoutpoint.h"
+#include "../vmisc/def.h"
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <QtTest>
+#include <atomic>
+#include <thread>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestPieces makes rectangles and trapezoids of different sizes. The set is the same on every call.
+ */
+auto TestPieces(int count) -> QVector<VLayoutPiece>
+{
+    QVector<VLayoutPiece> pieces;
+    pieces.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal width = MmToPixel(40. + (i * 37) % 120);
+        const qreal height = MmToPixel(30. + (i * 53) % 90);
+        const qreal bevel = i % 2 == 0 ? 0 : width / 3;
+
+        VLayoutPiece piece;
+        piece.SetName(QStringLiteral("Piece %1").arg(i));
+        piece.SetId(static_cast<vidtype>(i + 1));
+        piece.SetContourPoints({VLayoutPoint(0, 0), VLayoutPoint(width, 0), VLayoutPoint(width - bevel, height),
+                                VLayoutPoint(bevel / 2, height)});
+        pieces.append(piece);
+    }
+
+    return pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SetupGenerator(VLayoutGenerator &generator, const QVector<VLayoutPiece> &pieces, qreal paperSizeMm,
+                    bool multiStart, NestingEngine engine = NestingEngine::ContourSliding)
+{
+    generator.SetDetails(pieces);
+    generator.SetLayoutWidth(MmToPixel(2.));
+    generator.SetCaseType(Cases::CaseDesc);
+    generator.SetPaperWidth(MmToPixel(paperSizeMm));
+    generator.SetPaperHeight(MmToPixel(paperSizeMm));
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetRotate(true);
+    generator.SetRotationNumber(4);
+    generator.SetShift(-1); // Trigger first shift calulation
+    generator.SetMultiStart(multiStart);
+    generator.SetNestingEngine(engine);
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLayoutGenerator::TST_VLayoutGenerator(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MultiStartNotWorse the first multi-start pass repeats the single pass, so the best of all passes cannot use
+ * more sheets or have lower efficiency.
+ */
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::MultiStartNotWorse() const
+{
+    const QVector<VLayoutPiece> pieces = TestPieces(12);
+
+    VLayoutGenerator single;
+    SetupGenerator(single, pieces, 1500, false);
+
+    QElapsedTimer timer;
+    timer.start();
+    single.Generate(timer, 60000);
+    QCOMPARE(single.State(), LayoutErrors::NoError);
+    QCOMPARE(single.PapersCount(), static_cast<vsizetype>(1));
+
+    VLayoutGenerator multi;
+    SetupGenerator(multi, pieces, 1500, true);
+
+    timer.restart();
+    multi.Generate(timer, 60000);
+    QCOMPARE(multi.State(), LayoutErrors::NoError);
+    QCOMPARE(multi.PapersCount(), static_cast<vsizetype>(1));
+
+    // Passes are compared by efficiency rounded to 0.001 percent
+    QVERIFY2(multi.LayoutEfficiency() >= single.LayoutEfficiency() - 0.001,
+             qUtf8Printable(QStringLiteral("Multi-start efficiency %1, single pass %2.")
+                                .arg(multi.LayoutEfficiency())
+                                .arg(single.LayoutEfficiency())));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MultiStartAbort all passes stop soon after the generation was aborted.
+ */
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::MultiStartAbort() const
+{
+    VLayoutGenerator generator;
+    SetupGenerator(generator, TestPieces(400), 1000, true);
+
+    QElapsedTimer timer;
+    timer.start();
+    std::atomic_bool finished{false};
+    std::thread worker(
+        [&generator, &timer, &finished]()
+        {
+            generator.Generate(timer, 600000);
+            finished.store(true);
+        });
+
+    // Abort only after passes started, otherwise Generate() resets the flag
+    while (generator.PlacementsCount() == 0 && not finished.load())
+    {
+        QThread::msleep(1);
+    }
+
+    const bool finishedEarly = finished.load();
+
+    QElapsedTimer stopTimer;
+    stopTimer.start();
+    generator.Abort();
+    worker.join();
+
+    QVERIFY2(not finishedEarly, "The layout is too simple to be aborted.");
+    QCOMPARE(generator.State(), LayoutErrors::ProcessStoped);
+    QVERIFY2(stopTimer.elapsed() < 10000, "Passes ignored the stop flag.");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MultiStartTimeout all passes stop soon after the nesting time has expired.
+ */
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::MultiStartTimeout() const
+{
+    VLayoutGenerator generator;
+    SetupGenerator(generator, TestPieces(400), 1000, true);
+
+    constexpr qint64 timeout = 500;
+
+    QElapsedTimer timer;
+    timer.start();
+    generator.Generate(timer, timeout);
+
+    QCOMPARE(generator.State(), LayoutErrors::Timeout);
+    QVERIFY2(timer.elapsed() < timeout + 10000, "Passes ignored the nesting time.");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief NoFitPolygonEngine the no-fit polygon engine places the same pieces as the contour sliding engine without
+ * overlaps and with comparable efficiency.
+ */
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::NoFitPolygonEngine() const
+{
+    const QVector<VLayoutPiece> pieces = TestPieces(12);
+
+    VLayoutGenerator sliding;
+    SetupGenerator(sliding, pieces, 1500, false);
+
+    QElapsedTimer timer;
+    timer.start();
+    sliding.Generate(timer, 60000);
+    QCOMPARE(sliding.State(), LayoutErrors::NoError);
+    QCOMPARE(sliding.PapersCount(), static_cast<vsizetype>(1));
+
+    VLayoutGenerator nfp;
+    SetupGenerator(nfp, pieces, 1500, false, NestingEngine::NoFitPolygon);
+
+    timer.restart();
+    nfp.Generate(timer, 60000);
+    QCOMPARE(nfp.State(), LayoutErrors::NoError);
+    QCOMPARE(nfp.PapersCount(), static_cast<vsizetype>(1));
+
+    const QVector<VLayoutPiece> placed = nfp.GetAllDetails().constFirst();
+    QCOMPARE(placed.size(), pieces.size());
+
+    QVector<VPolygonEdges> contours;
+    contours.reserve(placed.size());
+    for (const auto &piece : placed)
+    {
+        QVector<QPointF> points;
+        CastTo(piece.GetMappedContourPoints(), points);
+        contours.append(VPolygonEdges(points));
+    }
+
+    for (vsizetype i = 0; i < contours.size(); ++i)
+    {
+        for (vsizetype j = i + 1; j < contours.size(); ++j)
+        {
+            QVERIFY2(not PolygonsOverlap(contours.at(i), contours.at(j)),
+                     qUtf8Printable(QStringLiteral("Pieces %1 and %2 overlap.").arg(i).arg(j)));
+        }
+    }
+
+    // All pieces are convex here, so convex hulls lose nothing
+    QVERIFY2(nfp.LayoutEfficiency() >= sliding.LayoutEfficiency() * 0.9,
+             qUtf8Printable(QStringLiteral("No-fit polygon efficiency %1, contour sliding %2.")
+                                .arg(nfp.LayoutEfficiency())
+                                .arg(sliding.LayoutEfficiency())));
+}
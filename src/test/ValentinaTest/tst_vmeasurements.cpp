@@ -30,6 +30,7 @@
 #include "../ifc/xml/vvitconverter.h"
 #include "../ifc/xml/vvstconverter.h"
 #include "../vformat/vmeasurements.h"
+#include "../vpatterndb/variables/vmeasurement.h"
 #include "../vpatterndb/vcontainer.h"
 
 #include <QtTest>
@@ -40,6 +41,32 @@
 
 using namespace Qt::Literals::StringLiterals;
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MakeChain individual measurements where each formula depends on the previous measurement. Reading such file
+ * means evaluation of every formula.
+ */
+void MakeChain(VMeasurements &m, int count)
+{
+    m.AddSeparator(u"@separator"_s);
+    m.AddEmpty(u"@m0"_s, u"10"_s);
+    for (int i = 1; i < count; ++i)
+    {
+        m.AddEmpty(u"@m%1"_s.arg(i), u"@m%1 + 0.5"_s.arg(i - 1));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ReReadMeasurements(VContainer *data, const VMeasurements &m)
+{
+    data->ClearUniqueNames();
+    data->ClearVariables({VarType::Measurement, VarType::MeasurementSeparator});
+    m.ReadMeasurements(0);
+}
+} // namespace
+
 //---------------------------------------------------------------------------------------------------------------------
 TST_VMeasurements::TST_VMeasurements(QObject *parent)
   : QObject(parent)
@@ -177,3 +204,89 @@ void TST_VMeasurements::ReadMeasurementsUnknownType()
 
     QVERIFY(data->DataVariables()->contains(QStringLiteral("height")));
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadMeasurementTexts after an edit of texts updating one measurement must give the same result as reading the
+ * whole file again.
+ */
+void TST_VMeasurements::ReadMeasurementTexts()
+{
+    Unit const mUnit = Unit::Cm;
+    auto const data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit, VContainer::UniqueNamespace()));
+    VMeasurements m(mUnit, data.data());
+    MakeChain(m, 10);
+    m.ReadMeasurements(0);
+
+    const QString name = u"@m5"_s;
+    const QSharedPointer<VMeasurement> meash = data->GetVariable<VMeasurement>(name);
+    const qreal value = *meash->GetValue();
+
+    m.SetMDescription(name, u"Description"_s);
+    m.SetMFullName(name, u"Full name"_s);
+    m.SetMValueAlias(name, u"XL"_s);
+    m.SetMDescription(u"@separator"_s, u"Separator description"_s);
+
+    m.ReadMeasurementTexts(meash);
+    const QSharedPointer<VMeasurement> separator = data->GetVariable<VMeasurement>(u"@separator"_s);
+    m.ReadMeasurementTexts(separator);
+
+    // Same object, values were not touched
+    QVERIFY(data->GetVariable<VMeasurement>(name) == meash);
+    QCOMPARE(*meash->GetValue(), value);
+
+    ReReadMeasurements(data.data(), m);
+    const QSharedPointer<VMeasurement> fresh = data->GetVariable<VMeasurement>(name);
+
+    QCOMPARE(meash->GetDescription(), fresh->GetDescription());
+    QCOMPARE(meash->GetGuiText(), fresh->GetGuiText());
+    QCOMPARE(meash->GetValueAlias(), fresh->GetValueAlias());
+    QCOMPARE(*meash->GetValue(), *fresh->GetValue());
+    QCOMPARE(separator->GetDescription(), data->GetVariable<VMeasurement>(u"@separator"_s)->GetDescription());
+    QCOMPARE(meash->GetValueAlias(), u"XL"_s);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BenchmarkReadMeasurements cost of the full refresh Tape used to do after each keystroke in a text field.
+ */
+void TST_VMeasurements::BenchmarkReadMeasurements()
+{
+    Unit const mUnit = Unit::Cm;
+    auto const data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit, VContainer::UniqueNamespace()));
+    VMeasurements m(mUnit, data.data());
+    MakeChain(m, 500);
+    m.ReadMeasurements(0);
+
+    QBENCHMARK
+    {
+        m.SetMDescription(u"@m250"_s, u"Description"_s);
+        ReReadMeasurements(data.data(), m);
+    }
+
+    QCOMPARE(data->GetVariable<VMeasurement>(u"@m250"_s)->GetDescription(), u"Description"_s);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BenchmarkReadMeasurementTexts cost of the refresh Tape does now after each keystroke in a text field. Compare
+ * with BenchmarkReadMeasurements.
+ */
+void TST_VMeasurements::BenchmarkReadMeasurementTexts()
+{
+    Unit const mUnit = Unit::Cm;
+    auto const data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit, VContainer::UniqueNamespace()));
+    VMeasurements m(mUnit, data.data());
+    MakeChain(m, 500);
+    m.ReadMeasurements(0);
+
+    const QSharedPointer<VMeasurement> meash = data->GetVariable<VMeasurement>(u"@m250"_s);
+
+    QBENCHMARK
+    {
+        m.SetMDescription(u"@m250"_s, u"Description"_s);
+        m.ReadMeasurementTexts(meash);
+    }
+
+    QCOMPARE(meash->GetDescription(), u"Description"_s);
+}
@@ -42,6 +42,9 @@ private slots:
     void CreateEmptyMultisizeFile();
     void CreateEmptyIndividualFile();
     void ReadMeasurementsUnknownType();
+    void ReadMeasurementTexts();
+    void BenchmarkReadMeasurements();
+    void BenchmarkReadMeasurementTexts();
 };
 
 #endif // TST_VMEASUREMENTS_H
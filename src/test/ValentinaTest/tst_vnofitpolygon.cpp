@@ -0,0 +1,170 @@
+/************************************************************************
+ **
+ **  @file   tst_vnofitpolygon.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vnofitpolygon.h"
+#include "../vgeometry/vpolygonintersection.h"
+#include "../vlayout/vnofitpolygon.h"
+
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto Rectangle(qreal x, qreal y, qreal width, qreal height) -> QVector<QPointF>
+{
+    return {QPointF(x, y), QPointF(x + width, y), QPointF(x + width, y + height), QPointF(x, y + height)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Area(const QVector<QPointF> &polygon) -> qreal
+{
+    qreal area = 0;
+    for (vsizetype i = 0; i < polygon.size(); ++i)
+    {
+        const QPointF &p1 = polygon.at(i);
+        const QPointF &p2 = polygon.at((i + 1) % polygon.size());
+        area += p1.x() * p2.y() - p2.x() * p1.y();
+    }
+    return area / 2.;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Translated(QVector<QPointF> polygon, const QPointF &offset) -> QVector<QPointF>
+{
+    for (auto &p : polygon)
+    {
+        p += offset;
+    }
+    return polygon;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VNoFitPolygon::TST_VNoFitPolygon(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNoFitPolygon::ConvexHull_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("points");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<qreal>("area");
+
+    QTest::newRow("Square") << Rectangle(0, 0, 10, 10) << 4 << 100.;
+    QTest::newRow("Square clockwise") << QVector<QPointF>{QPointF(0, 0), QPointF(0, 10), QPointF(10, 10),
+                                                          QPointF(10, 0)}
+                                      << 4 << 100.;
+    QTest::newRow("Inner and collinear points")
+        << QVector<QPointF>{QPointF(0, 0), QPointF(5, 0),  QPointF(10, 0), QPointF(5, 5),
+                            QPointF(10, 10), QPointF(0, 10), QPointF(0, 0)}
+        << 4 << 100.;
+    QTest::newRow("Concave") << QVector<QPointF>{QPointF(0, 0), QPointF(10, 0), QPointF(10, 10), QPointF(5, 2),
+                                                 QPointF(0, 10)}
+                             << 4 << 100.;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNoFitPolygon::ConvexHull() const
+{
+    QFETCH(QVector<QPointF>, points);
+    QFETCH(int, count);
+    QFETCH(qreal, area);
+
+    const QVector<QPointF> hull = ::ConvexHull(points);
+    QCOMPARE(hull.size(), count);
+    QCOMPARE(Area(hull), area); // Positive area means counterclockwise
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNoFitPolygon::NoFitPolygon_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("fixed");
+    QTest::addColumn<QVector<QPointF>>("moving");
+
+    QTest::newRow("Two rectangles") << Rectangle(0, 0, 10, 10) << Rectangle(0, 0, 4, 2);
+    QTest::newRow("Triangle and rectangle")
+        << QVector<QPointF>{QPointF(0, 0), QPointF(8, 0), QPointF(0, 6)} << Rectangle(-1, -1, 3, 5);
+    QTest::newRow("Same triangle") << QVector<QPointF>{QPointF(0, 0), QPointF(8, 0), QPointF(0, 6)}
+                                   << QVector<QPointF>{QPointF(0, 0), QPointF(8, 0), QPointF(0, 6)};
+    QTest::newRow("Hexagon and diamond")
+        << QVector<QPointF>{QPointF(2, 0), QPointF(6, 0), QPointF(8, 4), QPointF(6, 8), QPointF(2, 8), QPointF(0, 4)}
+        << QVector<QPointF>{QPointF(0, 2), QPointF(2, 0), QPointF(4, 2), QPointF(2, 4)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNoFitPolygon::NoFitPolygon() const
+{
+    QFETCH(QVector<QPointF>, fixed);
+    QFETCH(QVector<QPointF>, moving);
+
+    const QVector<QPointF> fixedHull = ::ConvexHull(fixed);
+    const QVector<QPointF> movingHull = ::ConvexHull(moving);
+    const QVector<QPointF> nfp = MinkowskiNoFitPolygon(fixedHull, movingHull);
+
+    QVERIFY(Area(nfp) > 0);
+
+    // Translation inside the no-fit polygon is exactly the translation that makes polygons overlap. Touching pieces
+    // stay on its boundary.
+    for (int x = -20; x <= 20; ++x)
+    {
+        for (int y = -20; y <= 20; ++y)
+        {
+            const QPointF offset(x, y);
+            const bool overlap = PolygonsOverlap(VPolygonEdges(fixedHull),
+                                                 VPolygonEdges(Translated(movingHull, offset)));
+            QVERIFY2(NoFitPolygonContains(nfp, offset) == overlap,
+                     qPrintable(QStringLiteral("Offset (%1, %2)").arg(x).arg(y)));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNoFitPolygon::Cache() const
+{
+    const QVector<QPointF> hull1 = ::ConvexHull(Rectangle(0, 0, 10, 10));
+    const QVector<QPointF> hull2 = ::ConvexHull(Rectangle(0, 0, 4, 2));
+
+    VNoFitPolygonCache cache;
+    const QVector<QPointF> nfp = cache.NoFitPolygon(QStringLiteral("a"), hull1, QStringLiteral("b"), hull2);
+    QCOMPARE(cache.Misses(), 1ULL);
+    QCOMPARE(cache.Hits(), 0ULL);
+
+    QCOMPARE(cache.NoFitPolygon(QStringLiteral("a"), hull1, QStringLiteral("b"), hull2), nfp);
+    QCOMPARE(cache.Hits(), 1ULL);
+
+    // Order of pieces matters
+    cache.NoFitPolygon(QStringLiteral("b"), hull2, QStringLiteral("a"), hull1);
+    QCOMPARE(cache.Misses(), 2ULL);
+    QCOMPARE(cache.Count(), 2);
+
+    cache.Clear();
+    QCOMPARE(cache.Count(), 0);
+    QCOMPARE(cache.Hits(), 0ULL);
+}
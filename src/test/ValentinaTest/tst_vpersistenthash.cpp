@@ -0,0 +1,233 @@
+/************************************************************************
+ **
+ **  @file   tst_vpersistenthash.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vpersistenthash.h"
+#include "../vmisc/vpersistenthash.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../vpatterndb/vcontainer.h"
+
+#include <QSet>
+#include <QtTest>
+
+namespace
+{
+struct CollidingKey
+{
+    int value{0};
+
+    auto operator==(const CollidingKey &other) const -> bool { return value == other.value; }
+    auto operator!=(const CollidingKey &other) const -> bool { return value != other.value; }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// Only a few hash values for all keys, deep levels and collision nodes are used
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+auto qHash(const CollidingKey &key, uint seed = 0) -> uint
+#else
+auto qHash(const CollidingKey &key, size_t seed = 0) -> size_t
+#endif
+{
+    Q_UNUSED(seed)
+    return static_cast<uint>(key.value % 3);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Keys(const VPersistentHash<int, int> &hash) -> QSet<int>
+{
+    QSet<int> keys;
+    for (auto i = hash.constBegin(); i != hash.constEnd(); ++i)
+    {
+        keys.insert(i.key());
+    }
+    return keys;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPersistentHash::TST_VPersistentHash(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPersistentHash::InsertAndRemove() const
+{
+    VPersistentHash<int, int> hash;
+    QVERIFY(hash.isEmpty());
+    QVERIFY(hash.constBegin() == hash.constEnd());
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        hash.insert(i, i * 2);
+    }
+    QCOMPARE(hash.size(), static_cast<vsizetype>(5000));
+
+    hash.insert(10, -1);
+    QCOMPARE(hash.size(), static_cast<vsizetype>(5000));
+    QCOMPARE(hash.value(10), -1);
+    QCOMPARE(hash.value(4999), 9998);
+    QCOMPARE(hash.value(5000, 7), 7);
+    QVERIFY(not hash.contains(5000));
+
+    for (int i = 0; i < 5000; i += 2)
+    {
+        QVERIFY(hash.remove(i));
+    }
+    QVERIFY(not hash.remove(0));
+    QCOMPARE(hash.size(), static_cast<vsizetype>(2500));
+
+    int count = 0;
+    for (auto i = hash.constBegin(); i != hash.constEnd(); ++i)
+    {
+        QVERIFY(i.key() % 2 == 1);
+        QCOMPARE(i.value(), i.key() * 2);
+        ++count;
+    }
+    QCOMPARE(count, 2500);
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(not hash.contains(1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPersistentHash::CopiesAreIndependent() const
+{
+    VPersistentHash<int, int> hash;
+    for (int i = 0; i < 1000; ++i)
+    {
+        hash.insert(i, i);
+    }
+
+    const VPersistentHash<int, int> snapshot = hash;
+    QVERIFY(snapshot.IsSharedWith(hash));
+
+    hash.insert(1000, 1000);
+    hash.insert(5, -5);
+    hash.remove(6);
+    QVERIFY(not snapshot.IsSharedWith(hash));
+
+    QCOMPARE(snapshot.size(), static_cast<vsizetype>(1000));
+    QVERIFY(not snapshot.contains(1000));
+    QCOMPARE(snapshot.value(5), 5);
+    QVERIFY(snapshot.contains(6));
+
+    QCOMPARE(hash.size(), static_cast<vsizetype>(1000));
+    QCOMPARE(hash.value(5), -5);
+    QVERIFY(not hash.contains(6));
+
+    QSet<int> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        expected.insert(i);
+    }
+    QCOMPARE(Keys(snapshot), expected);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPersistentHash::HashCollisions() const
+{
+    VPersistentHash<CollidingKey, int> hash;
+    for (int i = 0; i < 100; ++i)
+    {
+        hash.insert(CollidingKey{i}, i);
+    }
+    QCOMPARE(hash.size(), static_cast<vsizetype>(100));
+
+    const VPersistentHash<CollidingKey, int> snapshot = hash;
+
+    for (int i = 0; i < 100; i += 3)
+    {
+        QVERIFY(hash.remove(CollidingKey{i}));
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        QCOMPARE(hash.contains(CollidingKey{i}), i % 3 != 0);
+        QCOMPARE(snapshot.value(CollidingKey{i}, -1), i);
+    }
+
+    int count = 0;
+    for (auto i = hash.constBegin(); i != hash.constEnd(); ++i)
+    {
+        QCOMPARE(i.value(), i.key().value);
+        ++count;
+    }
+    QCOMPARE(count, 66);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPersistentHash::IterateFromFound() const
+{
+    VPersistentHash<int, int> hash;
+    for (int i = 0; i < 300; ++i)
+    {
+        hash.insert(i * 7919, i);
+    }
+
+    QVector<int> order;
+    for (auto i = hash.constBegin(); i != hash.constEnd(); ++i)
+    {
+        order.append(i.key());
+    }
+
+    // An iterator from constFind() continues in the same order as a full walk
+    for (vsizetype p = 0; p < order.size(); p += 17)
+    {
+        vsizetype q = p;
+        for (auto i = hash.constFind(order.at(p)); i != hash.constEnd(); ++i, ++q)
+        {
+            QCOMPARE(i.key(), order.at(q));
+        }
+        QCOMPARE(q, order.size());
+    }
+
+    QVERIFY(hash.constFind(1) == hash.constEnd());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPersistentHash::ContainerSnapshot() const
+{
+    VContainer data(nullptr, nullptr, VContainer::UniqueNamespace());
+
+    auto *width = new VIncrement(&data, QStringLiteral("#width"));
+    width->SetFormula(10, QStringLiteral("10"), true);
+    data.AddVariable(width);
+
+    // A tool keeps a copy of the data it was created with
+    const VContainer snapshot = data;
+
+    auto *height = new VIncrement(&data, QStringLiteral("#height"));
+    height->SetFormula(20, QStringLiteral("20"), true);
+    data.AddVariable(height);
+    data.RemoveVariable(QStringLiteral("#width"));
+
+    QVERIFY(snapshot.DataVariables()->contains(QStringLiteral("#width")));
+    QVERIFY(not snapshot.DataVariables()->contains(QStringLiteral("#height")));
+    QVERIFY(data.DataVariables()->contains(QStringLiteral("#height")));
+    QVERIFY(not data.DataVariables()->contains(QStringLiteral("#width")));
+}
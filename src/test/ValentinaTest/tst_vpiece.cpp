@@ -27,6 +27,7 @@
  *************************************************************************/
 
 #include "tst_vpiece.h"
+#include "../vgeometry/vpointf.h"
 #include "../vmisc/vabstractvalapplication.h"
 #include "../vpatterndb/vcontainer.h"
 #include "../vpatterndb/vpassmark.h"
@@ -175,3 +176,98 @@ void TST_VPiece::TestSeamLineTurnPoints()
         QFAIL(qUtf8Printable(e.ErrorMessage()));
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPiece::TestGeometryMemo()
+{
+    try
+    {
+        const Unit unit = Unit::Cm;
+        QSharedPointer<VContainer> data(new VContainer(nullptr, &unit, VContainer::UniqueNamespace()));
+        VAbstractValApplication::VApp()->SetPatternUnits(unit);
+
+        VPiece detail;
+        AbstractTest::PieceFromJson(QStringLiteral("://Issue_620/input.json"), detail, data);
+
+        VPiece::ResetGeometryCacheStatistics();
+
+        const QVector<VLayoutPoint> points = detail.MainPathPoints(data.data());
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(1));
+
+        // A copy shares the memo until it is changed
+        const VPiece copy = detail;
+        QVERIFY(copy.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().hits, Q_UINT64_C(1));
+
+        // Main path path is built from the memoized main path points
+        detail.MainPathPath(data.data());
+        QCOMPARE(VPiece::GeometryCacheStatistics().hits, Q_UINT64_C(2));
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(2));
+
+        // Any change of the piece drops the memo
+        detail.SetName(QStringLiteral("Changed"));
+        QVERIFY(detail.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(3));
+
+        // The same for any change of the data
+        const VContainerRevision revision = data->Revision();
+        data->AddGObject(new VPointF(0, 0, QStringLiteral("X"), 0, 0));
+        QVERIFY(data->Revision() != revision);
+        QVERIFY(detail.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(4));
+
+        // The original piece keeps its own state
+        QVERIFY(copy.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(5));
+        QVERIFY(copy.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().hits, Q_UINT64_C(3));
+    }
+    catch (const VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPiece::TestGeometryMemoInputs()
+{
+    try
+    {
+        const Unit unit = Unit::Cm;
+        QSharedPointer<VContainer> data(new VContainer(nullptr, &unit, VContainer::UniqueNamespace()));
+        VAbstractValApplication::VApp()->SetPatternUnits(unit);
+
+        VPiece detail;
+        AbstractTest::PieceFromJson(QStringLiteral("://Issue_620/input.json"), detail, data);
+
+        const VPassmarkOptions options{.doublePassmark = true, .pieceShowMainPath = false};
+        const QVector<QLineF> lines = detail.PassmarksLines(data.data(), options);
+        const QVector<VLayoutPoint> points = detail.MainPathPoints(data.data());
+
+        VPiece::ResetGeometryCacheStatistics();
+
+        QVERIFY(detail.PassmarksLines(data.data(), options) == lines);
+        QCOMPARE(VPiece::GeometryCacheStatistics().hits, Q_UINT64_C(1));
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(0));
+
+        // Lines built for other settings are not reused
+        const VPassmarkOptions otherOptions{.doublePassmark = false, .pieceShowMainPath = true};
+        detail.PassmarksLines(data.data(), otherOptions);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(1));
+
+        QVERIFY(detail.PassmarksLines(data.data(), options) == lines);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(2));
+
+        // Other inputs of the geometry changed, nothing is reused
+        VPiece::InvalidateGeometryCache();
+        QVERIFY(detail.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(3));
+
+        QVERIFY(detail.MainPathPoints(data.data()) == points);
+        QCOMPARE(VPiece::GeometryCacheStatistics().misses, Q_UINT64_C(3));
+    }
+    catch (const VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
@@ -0,0 +1,238 @@
+/************************************************************************
+ **
+ **  @file   tst_vpolygonintersection.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vpolygonintersection.h"
+#include "../vgeometry/vgobject.h"
+#include "../vgeometry/vpolygonintersection.h"
+
+#include <QPainterPath>
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto Rectangle(qreal x, qreal y, qreal width, qreal height) -> QVector<QPointF>
+{
+    return {QPointF(x, y), QPointF(x + width, y), QPointF(x + width, y + height), QPointF(x, y + height)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto Star(const QPointF &center, qreal radius, int rays) -> QVector<QPointF>
+{
+    QVector<QPointF> points;
+    points.reserve(rays * 2);
+    for (int i = 0; i < rays * 2; ++i)
+    {
+        const qreal r = i % 2 == 0 ? radius : radius / 2.;
+        const qreal angle = M_PI * i / rays;
+        points.append(center + QPointF(r * qCos(angle), r * qSin(angle)));
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Row of detailed star shaped pieces, every second one overlaps its neighbour
+auto BenchmarkPieces() -> QVector<QVector<QPointF>>
+{
+    QVector<QVector<QPointF>> pieces;
+    for (int i = 0; i < 40; ++i)
+    {
+        pieces.append(Star(QPointF(i * (i % 2 == 0 ? 150. : 180.), 0), 100, 60));
+    }
+    return pieces;
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPolygonIntersection::TST_VPolygonIntersection(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::Orientation() const
+{
+    QVERIFY(Orient2D(QPointF(0, 0), QPointF(10, 0), QPointF(5, 5)) > 0);
+    QVERIFY(Orient2D(QPointF(0, 0), QPointF(10, 0), QPointF(5, -5)) < 0);
+    QCOMPARE(Orient2D(QPointF(0, 0), QPointF(10, 10), QPointF(5, 5)), 0.0);
+
+    // Exactly collinear points and points one ulp away from the line
+    const QPointF a(0.5, 0.5);
+    const QPointF b(12, 12);
+    const QPointF c(24, 24);
+    QCOMPARE(Orient2D(a, b, c), 0.0);
+    QVERIFY(Orient2D(a, b, QPointF(24, std::nextafter(24., 25.))) > 0);
+    QVERIFY(Orient2D(a, b, QPointF(24, std::nextafter(24., 23.))) < 0);
+
+    // Point a moved a few ulps off the line. Naive evaluation of (b - a) x (c - a) in doubles gives -2^-44 here,
+    // while the exact value is positive.
+    const qreal ulp = std::ldexp(1., -53); // ulp of 0.5
+    const QPointF d(0.5 + 41 * ulp, 0.5 + 48 * ulp);
+    QVERIFY(Orient2D(d, b, c) > 0);
+    QVERIFY(Orient2D(d, c, b) < 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::Overlap_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("polygon1");
+    QTest::addColumn<QVector<QPointF>>("polygon2");
+    QTest::addColumn<bool>("overlap");
+
+    QTest::newRow("Crossing") << Rectangle(0, 0, 10, 10) << Rectangle(5, 5, 10, 10) << true;
+    QTest::newRow("Cross shape") << Rectangle(0, 0, 10, 10) << Rectangle(4, -5, 2, 20) << true;
+    QTest::newRow("Disjoint") << Rectangle(0, 0, 10, 10) << Rectangle(11, 0, 10, 10) << false;
+    QTest::newRow("Shared edge") << Rectangle(0, 0, 10, 10) << Rectangle(10, 0, 10, 10) << false;
+    QTest::newRow("Shared corner") << Rectangle(0, 0, 10, 10) << Rectangle(10, 10, 10, 10) << false;
+    QTest::newRow("Inside") << Rectangle(0, 0, 10, 10) << Rectangle(2, 2, 3, 3) << true;
+    QTest::newRow("Outside") << Rectangle(2, 2, 3, 3) << Rectangle(0, 0, 10, 10) << true;
+    QTest::newRow("Same polygon") << Rectangle(0, 0, 10, 10) << Rectangle(0, 0, 10, 10) << true;
+    QTest::newRow("Closed polygon") << Rectangle(0, 0, 10, 10) << (Rectangle(5, 5, 10, 10) << QPointF(5, 5)) << true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::Overlap() const
+{
+    QFETCH(QVector<QPointF>, polygon1);
+    QFETCH(QVector<QPointF>, polygon2);
+    QFETCH(bool, overlap);
+
+    QCOMPARE(PolygonsOverlap(VPolygonEdges(polygon1), VPolygonEdges(polygon2)), overlap);
+    QCOMPARE(PolygonsOverlap(VPolygonEdges(polygon2), VPolygonEdges(polygon1)), overlap);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::Contains_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("outer");
+    QTest::addColumn<QVector<QPointF>>("inner");
+    QTest::addColumn<bool>("contains");
+
+    QTest::newRow("Inside") << Rectangle(0, 0, 10, 10) << Rectangle(2, 2, 3, 3) << true;
+    QTest::newRow("Outside") << Rectangle(2, 2, 3, 3) << Rectangle(0, 0, 10, 10) << false;
+    QTest::newRow("Crossing") << Rectangle(0, 0, 10, 10) << Rectangle(5, 5, 10, 10) << false;
+    QTest::newRow("Touching from inside") << Rectangle(0, 0, 10, 10) << Rectangle(0, 0, 5, 5) << true;
+    QTest::newRow("Concave outer") << QVector<QPointF>{QPointF(0, 0), QPointF(10, 0), QPointF(10, 10), QPointF(5, 2),
+                                                       QPointF(0, 10)}
+                                   << QVector<QPointF>{QPointF(1, 9), QPointF(9, 9), QPointF(5, 5)} << false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::Contains() const
+{
+    QFETCH(QVector<QPointF>, outer);
+    QFETCH(QVector<QPointF>, inner);
+    QFETCH(bool, contains);
+
+    QCOMPARE(PolygonContains(VPolygonEdges(outer), VPolygonEdges(inner)), contains);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::BoundariesIntersect_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("polygon1");
+    QTest::addColumn<QVector<QPointF>>("polygon2");
+    QTest::addColumn<bool>("cross");
+    QTest::addColumn<bool>("intersect");
+
+    // Pieces placed edge to edge
+    QTest::newRow("Shared edge") << Rectangle(0, 0, 10, 10) << Rectangle(10, 0, 10, 10) << false << true;
+    QTest::newRow("Partly shared edge") << Rectangle(0, 0, 10, 10) << Rectangle(10, 5, 10, 10) << false << true;
+    QTest::newRow("Shared corner") << Rectangle(0, 0, 10, 10) << Rectangle(10, 10, 10, 10) << false << true;
+    QTest::newRow("Shared slanted edge") << QVector<QPointF>{QPointF(0, 0), QPointF(10, 0), QPointF(0, 10)}
+                                         << QVector<QPointF>{QPointF(10, 0), QPointF(10, 10), QPointF(0, 10)} << false
+                                         << true;
+
+    QTest::newRow("Crossing") << Rectangle(0, 0, 10, 10) << Rectangle(5, 5, 10, 10) << true << true;
+    QTest::newRow("Disjoint") << Rectangle(0, 0, 10, 10) << Rectangle(11, 0, 10, 10) << false << false;
+    QTest::newRow("Inside") << Rectangle(0, 0, 10, 10) << Rectangle(2, 2, 3, 3) << false << false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::BoundariesIntersect() const
+{
+    QFETCH(QVector<QPointF>, polygon1);
+    QFETCH(QVector<QPointF>, polygon2);
+    QFETCH(bool, cross);
+    QFETCH(bool, intersect);
+
+    const VPolygonEdges edges1(polygon1);
+    const VPolygonEdges edges2(polygon2);
+
+    QCOMPARE(PolygonBoundariesCross(edges1, edges2), cross);
+    QCOMPARE(PolygonBoundariesCross(edges2, edges1), cross);
+    QCOMPARE(PolygonBoundariesIntersect(edges1, edges2), intersect);
+    QCOMPARE(PolygonBoundariesIntersect(edges2, edges1), intersect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::BenchmarkPainterPath() const
+{
+    const QVector<QVector<QPointF>> pieces = BenchmarkPieces();
+
+    int overlaps = 0;
+    QBENCHMARK
+    {
+        overlaps = 0;
+        for (int i = 1; i < pieces.size(); ++i)
+        {
+            const QPainterPath path1 = VGObject::PainterPath(pieces.at(i - 1));
+            const QPainterPath path2 = VGObject::PainterPath(pieces.at(i));
+            if (path1.contains(path2) || path2.contains(path1) || path1.intersects(path2))
+            {
+                ++overlaps;
+            }
+        }
+    }
+
+    QVERIFY(overlaps > 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPolygonIntersection::BenchmarkPolygonEdges() const
+{
+    const QVector<QVector<QPointF>> pieces = BenchmarkPieces();
+
+    int overlaps = 0;
+    QBENCHMARK
+    {
+        overlaps = 0;
+        for (int i = 1; i < pieces.size(); ++i)
+        {
+            const VPolygonEdges polygon1(pieces.at(i - 1));
+            const VPolygonEdges polygon2(pieces.at(i));
+            if (PolygonContains(polygon1, polygon2) || PolygonContains(polygon2, polygon1) ||
+                PolygonsOverlap(polygon1, polygon2))
+            {
+                ++overlaps;
+            }
+        }
+    }
+
+    QVERIFY(overlaps > 0);
+}
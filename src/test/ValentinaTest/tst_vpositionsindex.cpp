@@ -0,0 +1,165 @@
+/************************************************************************
+ **
+ **  @file   tst_vpositionsindex.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   17 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vpositionsindex.h"
+#include "../vlayout/vpositionsindex.h"
+
+#include <QRandomGenerator>
+#include <QtTest>
+#include <algorithm>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Emulates a sheet densely packed with pieces of different size. Fixed seed keeps the benchmark reproducible.
+auto PackedSheet(int count) -> QVector<QRectF>
+{
+    QRandomGenerator generator(1429);
+    QVector<QRectF> rects;
+    rects.reserve(count);
+
+    const int columns = 12;
+    const qreal cell = 300;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal x = (i % columns) * cell + generator.bounded(50.0);
+        const qreal y = (i / columns) * cell + generator.bounded(50.0);
+        rects.append(QRectF(x, y, 100 + generator.bounded(250.0), 100 + generator.bounded(250.0)));
+    }
+
+    return rects;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+auto BoundingRectTest(const QRectF &position, const QRectF &probe) -> bool
+{
+    return position.intersects(probe) || position.contains(probe) || probe.contains(position);
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPositionsIndex::TST_VPositionsIndex(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPositionsIndex::Candidates_data() const
+{
+    QTest::addColumn<QRectF>("probe");
+
+    QTest::newRow("Top left corner") << QRectF(0, 0, 150, 150);
+    QTest::newRow("Inside sheet") << QRectF(1200, 2100, 420, 310);
+    QTest::newRow("Whole sheet") << QRectF(-10, -10, 5000, 10000);
+    QTest::newRow("Outside sheet") << QRectF(10000, 10000, 100, 100);
+    QTest::newRow("Negative coordinates") << QRectF(-400, -400, 450, 450);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPositionsIndex::Candidates() const
+{
+    QFETCH(QRectF, probe);
+
+    const QVector<QRectF> rects = PackedSheet(300);
+
+    VPositionsIndex index;
+    for (const auto &rect : rects)
+    {
+        index.Append({.boundingRect = rect, .layoutAllowance = VPolygonEdges()});
+    }
+
+    QCOMPARE(index.Count(), rects.size());
+
+    const QVector<vsizetype> candidates = index.Candidates(probe);
+
+    for (vsizetype i = 0; i < rects.size(); ++i)
+    {
+        if (BoundingRectTest(rects.at(i), probe))
+        {
+            QVERIFY2(candidates.contains(i), qUtf8Printable(QStringLiteral("Missed position %1.").arg(i)));
+        }
+    }
+
+    QVERIFY(std::is_sorted(candidates.cbegin(), candidates.cend()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPositionsIndex::BenchmarkLinearScan() const
+{
+    const QVector<QRectF> rects = PackedSheet(300);
+    const QVector<QRectF> probes = PackedSheet(1000);
+
+    int hits = 0;
+    QBENCHMARK
+    {
+        hits = 0;
+        for (const auto &probe : probes)
+        {
+            for (const auto &rect : rects)
+            {
+                if (BoundingRectTest(rect, probe))
+                {
+                    ++hits;
+                }
+            }
+        }
+    }
+
+    QVERIFY(hits > 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPositionsIndex::BenchmarkIndex() const
+{
+    const QVector<QRectF> rects = PackedSheet(300);
+    const QVector<QRectF> probes = PackedSheet(1000);
+
+    VPositionsIndex index;
+    for (const auto &rect : rects)
+    {
+        index.Append({.boundingRect = rect, .layoutAllowance = VPolygonEdges()});
+    }
+
+    int hits = 0;
+    QBENCHMARK
+    {
+        hits = 0;
+        for (const auto &probe : probes)
+        {
+            const QVector<vsizetype> candidates = index.Candidates(probe);
+            for (auto i : candidates)
+            {
+                if (BoundingRectTest(index.At(i).boundingRect, probe))
+                {
+                    ++hits;
+                }
+            }
+        }
+    }
+
+    QVERIFY(hits > 0);
+}
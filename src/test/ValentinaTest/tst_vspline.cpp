@@ -919,6 +919,83 @@ void TST_VSpline::TestCutSpline()
     QVERIFY(UnitConvertor(spline1.GetLength(), Unit::Px, Unit::Cm) - result < eps);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestParametrTChangedCurve()
+{
+    const VPointF p1(30, 39.999874015748034, QStringLiteral("p1"), 15, 30);
+    const VPointF p4(2883.86674323853821, 805.33182541168674, QStringLiteral("p4"), 9.9999874015748045, 15);
+
+    const VSpline spl(p1, QPointF(500, -300), QPointF(2000, 1500), p4);
+    CompareParametrTWithBisection(spl);
+
+    // The copy shares the length table with the original until it is changed
+    VSpline changed(spl);
+    changed.SetP3(QPointF(100, 1500));
+    CompareParametrTWithBisection(changed);
+
+    CompareParametrTWithBisection(spl);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::BenchmarkCutPoints() const
+{
+    const VPointF p1(30, 39.999874015748034, QStringLiteral("p1"), 15, 30);
+    const VPointF p4(2883.86674323853821, 805.33182541168674, QStringLiteral("p4"), 9.9999874015748045, 15);
+
+    const VSpline spl(p1, p4, 240.60499999999999, QStringLiteral("240.605"), 260.36399999999998,
+                      QStringLiteral("260.364"), 6614.8535433070883, QStringLiteral("175.018"), 10695.382677165355,
+                      QStringLiteral("282.982"));
+    const qreal base = spl.GetLength();
+    constexpr int cutPoints = 100;
+
+    QPointF spl1p2, spl1p3, spl2p2, spl2p3;
+    QBENCHMARK
+    {
+        for (int i = 0; i <= cutPoints; ++i)
+        {
+            spl.CutSpline(base * i / cutPoints, spl1p2, spl1p3, spl2p2, spl2p3, QStringLiteral("X"));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::CompareParametrTWithBisection(const VSpline &spl) const
+{
+    // Same precision as VAbstractCubicBezier::GetParmT
+    const qreal eps = UnitConvertor(0.00001, Unit::Mm, Unit::Px);
+
+    // Reference result of a plain bisection over the whole curve
+    auto Bisection = [&spl, eps](qreal length) -> qreal
+    {
+        qreal low = 0;
+        qreal high = 1;
+        qreal parT = 0.5;
+        qreal diff = spl.RealLengthByT(parT) - length;
+        while (qAbs(diff) > eps && not qFuzzyIsNull(high - low))
+        {
+            diff > 0 ? high = parT : low = parT;
+            parT = (low + high) / 2.;
+            diff = spl.RealLengthByT(parT) - length;
+        }
+        return parT;
+    };
+
+    const qreal splLength = spl.GetLength();
+    for (int i = 1; i < 10; ++i)
+    {
+        const qreal length = splLength * i / 10.;
+        const qreal expected = spl.RealLengthByT(Bisection(length));
+        QVERIFY2(qAbs(expected - length) <= eps,
+                 qUtf8Printable(QStringLiteral("Bisection failed for length %1.").arg(length)));
+
+        const qreal actual = spl.RealLengthByT(spl.GetParmT(length));
+        QVERIFY2(qAbs(actual - length) <= eps, qUtf8Printable(QStringLiteral("Length %1, error %2.")
+                                                                  .arg(length)
+                                                                  .arg(actual - length)));
+        QVERIFY(qAbs(actual - expected) <= 2 * eps);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VSpline::CompareSplines(const VSpline &spl1, const VSpline &spl2) const
 {
@@ -56,11 +56,14 @@ private slots:
     void TestFlip();
     void TestCutSpline_data();
     void TestCutSpline();
+    void TestParametrTChangedCurve();
+    void BenchmarkCutPoints() const;
 
 private:
     // cppcheck-suppress unknownMacro
     Q_DISABLE_COPY_MOVE(TST_VSpline) // NOLINT
     void CompareSplines(const VSpline &spl1, const VSpline &spl2) const;
+    void CompareParametrTWithBisection(const VSpline &spl) const;
 };
 
 #endif // TST_VSPLINE_H
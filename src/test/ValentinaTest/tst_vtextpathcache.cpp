@@ -0,0 +1,161 @@
+/************************************************************************
+ **
+ **  @file   tst_vtextpathcache.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+#include "tst_vtextpathcache.h"
+#include "../vmisc/vtextpathcache.h"
+
+#include <QFont>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+auto Square(int &builds) -> VTextPathCache::PathBuilder
+{
+    return [&builds]()
+    {
+        ++builds;
+        QPainterPath path;
+        path.addRect(0, 0, 10, 10);
+        return path;
+    };
+}
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VTextPathCache::TST_VTextPathCache(QObject *parent)
+  : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextPathCache::init()
+{
+    VTextPathCache::SetCapacity(VTextPathCache::defaultGlyphCapacity, VTextPathCache::defaultLineCapacity);
+    VTextPathCache::Clear();
+    VTextPathCache::ResetStatistics();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextPathCache::cleanupTestCase()
+{
+    init();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextPathCache::ReuseLine() const
+{
+    int builds = 0;
+    const QString font = QStringLiteral("font");
+
+    const QPainterPath first = VTextPathCache::Line(font, QStringLiteral("Line"), 0, Square(builds));
+    const QPainterPath second = VTextPathCache::Line(font, QStringLiteral("Line"), 0, Square(builds));
+    QCOMPARE(builds, 1);
+    QCOMPARE(first, second);
+
+    // Pen width and string are parts of the key
+    VTextPathCache::Line(font, QStringLiteral("Line"), 1, Square(builds));
+    VTextPathCache::Line(font, QStringLiteral("Line 2"), 0, Square(builds));
+    VTextPathCache::Line(QStringLiteral("font 2"), QStringLiteral("Line"), 0, Square(builds));
+    QCOMPARE(builds, 4);
+
+    const VTextPathCacheStatistics statistics = VTextPathCache::Statistics();
+    QCOMPARE(statistics.lineHits, Q_UINT64_C(1));
+    QCOMPARE(statistics.lineMisses, Q_UINT64_C(4));
+    QCOMPARE(statistics.glyphHits, Q_UINT64_C(0));
+    QCOMPARE(statistics.LineHitRate(), 0.2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextPathCache::ReuseGlyph() const
+{
+    int builds = 0;
+    const QString font = QStringLiteral("font");
+
+    for (int i = 0; i < 10; ++i)
+    {
+        VTextPathCache::Glyph(font, QChar(u'A'), Square(builds));
+        VTextPathCache::Glyph(font, QChar(u'B'), Square(builds));
+    }
+    QCOMPARE(builds, 2);
+
+    const VTextPathCacheStatistics statistics = VTextPathCache::Statistics();
+    QCOMPARE(statistics.glyphHits, Q_UINT64_C(18));
+    QCOMPARE(statistics.glyphMisses, Q_UINT64_C(2));
+    QCOMPARE(statistics.GlyphHitRate(), 0.9);
+    QCOMPARE(statistics.lineMisses, Q_UINT64_C(0));
+
+    VTextPathCache::Clear();
+    VTextPathCache::Glyph(font, QChar(u'A'), Square(builds));
+    QCOMPARE(builds, 3);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextPathCache::Capacity() const
+{
+    VTextPathCache::SetCapacity(2, 1);
+    QCOMPARE(VTextPathCache::GlyphCapacity(), 2);
+    QCOMPARE(VTextPathCache::LineCapacity(), 1);
+
+    int builds = 0;
+    const QString font = QStringLiteral("font");
+
+    VTextPathCache::Glyph(font, QChar(u'A'), Square(builds));
+    VTextPathCache::Glyph(font, QChar(u'B'), Square(builds));
+    VTextPathCache::Glyph(font, QChar(u'C'), Square(builds));
+    QCOMPARE(builds, 3);
+
+    // The least recently used glyph was dropped
+    VTextPathCache::Glyph(font, QChar(u'C'), Square(builds));
+    QCOMPARE(builds, 3);
+    VTextPathCache::Glyph(font, QChar(u'A'), Square(builds));
+    QCOMPARE(builds, 4);
+
+    builds = 0;
+    VTextPathCache::Line(font, QStringLiteral("1"), 0, Square(builds));
+    VTextPathCache::Line(font, QStringLiteral("2"), 0, Square(builds));
+    VTextPathCache::Line(font, QStringLiteral("1"), 0, Square(builds));
+    QCOMPARE(builds, 3);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextPathCache::OutlineText() const
+{
+    QFont font;
+    font.setPointSize(12);
+    const QString text = QStringLiteral("Piece 1");
+    const QPointF point(15, 30);
+
+    QPainterPath expected;
+    expected.addText(point, font, text);
+
+    QCOMPARE(VTextPathCache::OutlineText(point, font, text), expected);
+    QCOMPARE(VTextPathCache::OutlineText(point, font, text), expected);
+    QCOMPARE(VTextPathCache::Statistics().lineHits, Q_UINT64_C(1));
+
+    QVERIFY(VTextPathCache::OutlineText(point, font, QString()).isEmpty());
+}